@@ -1,10 +1,13 @@
-QT += core gui widgets multimedia multimediawidgets
+QT += core gui widgets network multimedia multimediawidgets
 
 CONFIG += c++17
 
 TARGET = AuroraPlayer
 TEMPLATE = app
 
+# Per-stage tracing (remove to compile the trace macros out)
+DEFINES += AURORAPLAYER_ENABLE_TRACING
+
 # Define the library paths
 LIBS += -lffmpeg -lsdl2
 
@@ -15,19 +18,85 @@ INCLUDEPATH += include
 HEADERS += \
     include/CommonState.h \
     include/CommonUtils.h \
+    src/core/DecodeScheduler.h \
+    src/core/DecoderPool.h \
+    src/core/FFmpegHandles.h \
+    src/core/LibraryIndex.h \
+    src/core/MediaClock.h \
+    src/core/MediaMetadata.h \
     src/core/MediaPlayer.h \
+    src/core/Metrics.h \
+    src/core/PacketQueue.h \
+    src/core/PcmSource.h \
+    src/core/PlaybackBackend.h \
+    src/core/PlaybackStats.h \
+    src/core/PositionNotifier.h \
+    src/core/QtMultimediaBackend.h \
+    src/core/SingleInstance.h \
+    src/core/StartupTimeline.h \
+    src/core/TaskScheduler.h \
+    src/core/Tracer.h \
+    src/player/DuplicateFinder.h \
+    src/player/FolderImporter.h \
+    src/player/HeadlessPlayer.h \
+    src/player/MetadataService.h \
+    src/player/PathArena.h \
     src/player/PlayerController.h \
+    src/player/PlaylistFormat.h \
+    src/player/PlaylistLoader.h \
     src/player/PlaylistManager.h \
+    src/player/PlaylistStorage.h \
+    src/player/PlaylistWriter.h \
+    src/player/ShuffleBag.h \
+    src/player/TrigramIndex.h \
+    src/player/VideoWall.h \
     src/ui/MainWindow.h \
+    src/ui/PlaylistModel.h \
+    src/ui/StatsOverlay.h \
+    src/ui/VideoWallWindow.h \
+    src/utils/ContentHash.h \
+    src/utils/MediaSniffer.h \
+    src/utils/ParallelSort.h \
     src/utils/Utils.h
 
 # Source files
 SOURCES += \
     src/main.cpp \
+    src/core/DecodeScheduler.cpp \
+    src/core/DecoderPool.cpp \
+    src/core/LibraryIndex.cpp \
+    src/core/MediaClock.cpp \
+    src/core/MediaMetadata.cpp \
     src/core/MediaPlayer.cpp \
+    src/core/Metrics.cpp \
+    src/core/PacketQueue.cpp \
+    src/core/PcmSource.cpp \
+    src/core/PlaybackBackend.cpp \
+    src/core/PositionNotifier.cpp \
+    src/core/QtMultimediaBackend.cpp \
+    src/core/SingleInstance.cpp \
+    src/core/StartupTimeline.cpp \
+    src/core/TaskScheduler.cpp \
+    src/core/Tracer.cpp \
+    src/player/DuplicateFinder.cpp \
+    src/player/FolderImporter.cpp \
+    src/player/HeadlessPlayer.cpp \
+    src/player/MetadataService.cpp \
+    src/player/PathArena.cpp \
     src/player/PlayerController.cpp \
+    src/player/PlaylistLoader.cpp \
     src/player/PlaylistManager.cpp \
+    src/player/PlaylistStorage.cpp \
+    src/player/PlaylistWriter.cpp \
+    src/player/ShuffleBag.cpp \
+    src/player/TrigramIndex.cpp \
+    src/player/VideoWall.cpp \
     src/ui/MainWindow.cpp \
+    src/ui/PlaylistModel.cpp \
+    src/ui/StatsOverlay.cpp \
+    src/ui/VideoWallWindow.cpp \
+    src/utils/ContentHash.cpp \
+    src/utils/MediaSniffer.cpp \
     src/utils/Utils.cpp
 
 # UI files (if any)
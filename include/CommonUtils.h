@@ -12,6 +12,7 @@
 #define AURORAPLAYER_COMMONUTILS_H
 
 #include <QString>
+#include <QStringView>
 
 /**
  * @namespace AuroraPlayer::Utils
@@ -36,6 +37,13 @@ namespace AuroraPlayer {
          */
         QString getFileNameFromPath(const QString& filePath);
 
+        /**
+         * @brief 获取文件名在路径中的起始位置（'/' 和 '\' 都视为分隔符）
+         * @param filePath 文件路径
+         * @return qsizetype 文件名第一个字符的下标，没有分隔符时为 0
+         */
+        qsizetype fileNameOffset(QStringView filePath);
+
         /**
          * @brief 获取 FFmpeg 错误信息
          * @param errorCode 错误码
@@ -0,0 +1,139 @@
+/********************************************************************************
+ * @file   : DecodeScheduler.cpp
+ * @brief  : 实现了 DecodeScheduler 类。
+ *
+ * @author : polarours
+ * @date   : 2026/10/18
+ ********************************************************************************/
+
+#include "DecodeScheduler.h"
+#include "Metrics.h"
+#include "Tracer.h"
+
+#include <QMutexLocker>
+#include <QThread>
+
+/**
+ * @brief 领取执行槽
+ *
+ * @param scheduler 调度器，可为 nullptr
+ */
+DecodeScheduler::Slot::Slot(DecodeScheduler* scheduler)
+    : m_scheduler(scheduler)
+{
+    if (m_scheduler) {
+        m_scheduler->acquire();
+    }
+}
+
+/**
+ * @brief 归还执行槽
+ */
+DecodeScheduler::Slot::~Slot()
+{
+    if (m_scheduler) {
+        m_scheduler->release();
+    }
+}
+
+/**
+ * @brief 获取进程内唯一的调度器
+ *
+ * @return DecodeScheduler& 调度器
+ */
+DecodeScheduler& DecodeScheduler::instance()
+{
+    static DecodeScheduler scheduler;
+    return scheduler;
+}
+
+/**
+ * @brief 构造函数（槽数为 CPU 核心数）
+ */
+DecodeScheduler::DecodeScheduler()
+    : m_concurrency(qMax(QThread::idealThreadCount(), 1))
+    , m_active(0)
+    , m_waiting(0)
+{
+}
+
+/**
+ * @brief 设置执行槽数量
+ *
+ * @param count 槽数，0 表示 CPU 核心数
+ */
+void DecodeScheduler::setConcurrency(int count)
+{
+    QMutexLocker locker(&m_mutex);
+    m_concurrency = count > 0 ? count : qMax(QThread::idealThreadCount(), 1);
+    m_slotFree.wakeAll();
+}
+
+/**
+ * @brief 获取执行槽数量
+ */
+int DecodeScheduler::concurrency() const
+{
+    QMutexLocker locker(&m_mutex);
+    return m_concurrency;
+}
+
+/**
+ * @brief 获取正在执行的解码步骤数
+ */
+int DecodeScheduler::active() const
+{
+    QMutexLocker locker(&m_mutex);
+    return m_active;
+}
+
+/**
+ * @brief 获取等待执行槽的解码步骤数
+ */
+int DecodeScheduler::waiting() const
+{
+    QMutexLocker locker(&m_mutex);
+    return m_waiting;
+}
+
+/**
+ * @brief 获取等待执行槽的累计时间（微秒）
+ */
+qint64 DecodeScheduler::totalWaitUs() const
+{
+    return m_totalWaitUs.load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief 领取执行槽
+ */
+void DecodeScheduler::acquire()
+{
+    QMutexLocker locker(&m_mutex);
+    if (m_active < m_concurrency) {
+        m_active += 1;
+        return;
+    }
+
+    AURORA_TRACE_SCOPE("decode", "waitSlot");
+    const qint64 startUs = PlayerMetrics::nowUs();
+    m_waiting += 1;
+    while (m_active >= m_concurrency) {
+        m_slotFree.wait(&m_mutex);
+    }
+    m_waiting -= 1;
+    m_active += 1;
+    m_totalWaitUs.fetch_add(PlayerMetrics::nowUs() - startUs, std::memory_order_relaxed);
+}
+
+/**
+ * @brief 归还执行槽
+ */
+void DecodeScheduler::release()
+{
+    QMutexLocker locker(&m_mutex);
+    m_active -= 1;
+    if (m_waiting > 0) {
+        m_slotFree.wakeOne();
+    }
+}
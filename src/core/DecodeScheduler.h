@@ -0,0 +1,110 @@
+/********************************************************************************
+ * @file   : DecodeScheduler.h
+ * @brief  : 声明了 DecodeScheduler 类。
+ *
+ * 该文件声明了进程内共享的解码调度器。同时播放多路媒体（视频墙）时，每个解码器
+ * 只用一个线程，所有播放器的解码步骤（送包、取帧、像素转换）先从调度器领取一个
+ * 执行槽；槽数等于 CPU 核心数，因此无论播放多少路，同时占用 CPU 的解码工作
+ * 不超过核心数，不会因 N 路 × 每路 FFmpeg 线程池而过度订阅。
+ * 等待显示时刻等阻塞操作不占用执行槽。
+ *
+ * @author : polarours
+ * @date   : 2026/10/18
+ ********************************************************************************/
+
+#ifndef AURORAPLAYER_DECODESCHEDULER_H
+#define AURORAPLAYER_DECODESCHEDULER_H
+
+#include <QMutex>
+#include <QWaitCondition>
+#include <QtGlobal>
+
+#include <atomic>
+
+class DecodeScheduler
+{
+public:
+    /**
+     * @class Slot
+     * @brief 执行槽（RAII）：构造时领取，析构时归还
+     *
+     * 调度器为 nullptr 时不做任何事，便于未共享解码的播放器使用同一段代码。
+     */
+    class Slot
+    {
+    public:
+        explicit Slot(DecodeScheduler* scheduler);
+        ~Slot();
+
+        Slot(const Slot&) = delete;
+        Slot& operator=(const Slot&) = delete;
+
+    private:
+        DecodeScheduler* m_scheduler; ///< 所属调度器
+    };
+
+    /**
+     * @brief 获取进程内唯一的调度器
+     *
+     * @return DecodeScheduler& 调度器
+     */
+    static DecodeScheduler& instance();
+
+    /**
+     * @brief 设置执行槽数量
+     *
+     * @param count 槽数，0 表示 CPU 核心数
+     */
+    void setConcurrency(int count);
+
+    /**
+     * @brief 获取执行槽数量
+     *
+     * @return int 槽数
+     */
+    int concurrency() const;
+
+    /**
+     * @brief 获取正在执行的解码步骤数
+     *
+     * @return int 占用的槽数
+     */
+    int active() const;
+
+    /**
+     * @brief 获取等待执行槽的解码步骤数
+     *
+     * @return int 等待数
+     */
+    int waiting() const;
+
+    /**
+     * @brief 获取等待执行槽的累计时间
+     *
+     * @return qint64 累计等待时间（微秒）
+     */
+    qint64 totalWaitUs() const;
+
+private:
+    DecodeScheduler();
+
+    /**
+     * @brief 领取执行槽，没有空闲槽时阻塞
+     */
+    void acquire();
+
+    /**
+     * @brief 归还执行槽
+     */
+    void release();
+
+private:
+    mutable QMutex m_mutex;          ///< 保护以下成员
+    QWaitCondition m_slotFree;       ///< 有空闲槽
+    int m_concurrency;               ///< 槽数
+    int m_active;                    ///< 占用的槽数
+    int m_waiting;                   ///< 等待数
+    std::atomic<qint64> m_totalWaitUs{0}; ///< 累计等待时间
+};
+
+#endif // AURORAPLAYER_DECODESCHEDULER_H
@@ -0,0 +1,352 @@
+/********************************************************************************
+ * @file   : DecoderPool.cpp
+ * @brief  : 实现了 DecoderPool 类。
+ *
+ * @author : polarours
+ * @date   : 2026/10/18
+ ********************************************************************************/
+
+#include "DecoderPool.h"
+#include "Tracer.h"
+#include "../utils/Utils.h"
+
+#include <QDebug>
+#include <QMutexLocker>
+
+#include <iterator>
+
+namespace {
+
+    constexpr int kDefaultCapacity = 4; ///< 默认保留的空闲解码器数量
+
+    /**
+     * @brief 获取流参数的声道数
+     */
+    int channelCount(const AVCodecParameters* parameters)
+    {
+#if LIBAVUTIL_VERSION_INT >= AV_VERSION_INT(57, 28, 100)
+        return parameters->ch_layout.nb_channels;
+#else
+        return parameters->channels;
+#endif
+    }
+
+    /**
+     * @brief 打开流对应的解码器
+     *
+     * @param stream  媒体流
+     * @param threads 解码线程数，0 表示自动
+     * @return CodecContextPtr 解码器上下文，失败时为空
+     */
+    CodecContextPtr openDecoder(const AVStream* stream, int threads)
+    {
+        AURORA_TRACE_SCOPE("decode", "openDecoder");
+
+        const AVCodec* codec = avcodec_find_decoder(stream->codecpar->codec_id);
+        if (!codec) {
+            qWarning() << "No decoder for codec:" << avcodec_get_name(stream->codecpar->codec_id);
+            return nullptr;
+        }
+
+        CodecContextPtr context(avcodec_alloc_context3(codec));
+        if (!context) {
+            return nullptr;
+        }
+        if (avcodec_parameters_to_context(context.get(), stream->codecpar) < 0) {
+            return nullptr;
+        }
+        context->pkt_timebase = stream->time_base;
+        context->thread_count = threads;
+        context->thread_type = FF_THREAD_FRAME | FF_THREAD_SLICE;
+
+        const int result = avcodec_open2(context.get(), codec, nullptr);
+        if (result < 0) {
+            qWarning() << "Failed to open decoder:" << AuroraPlayer::Utils::getErrorMessage(result);
+            return nullptr;
+        }
+        return context;
+    }
+
+} // namespace
+
+// --- Key --- //
+
+/**
+ * @brief 由流参数生成键
+ *
+ * @param stream  媒体流
+ * @param threads 解码线程数设置
+ * @return Key 键
+ */
+DecoderPool::Key DecoderPool::Key::fromStream(const AVStream* stream, int threads)
+{
+    const AVCodecParameters* parameters = stream->codecpar;
+
+    Key key;
+    key.codecId = parameters->codec_id;
+    key.codecType = parameters->codec_type;
+    key.codecTag = parameters->codec_tag;
+    key.format = parameters->format;
+    key.profile = parameters->profile;
+    key.level = parameters->level;
+    key.width = parameters->width;
+    key.height = parameters->height;
+    key.colorRange = parameters->color_range;
+    key.colorSpace = parameters->color_space;
+    key.sampleRate = parameters->sample_rate;
+    key.channels = channelCount(parameters);
+    key.blockAlign = parameters->block_align;
+    key.bitsPerCodedSample = parameters->bits_per_coded_sample;
+    key.timeBaseNum = stream->time_base.num;
+    key.timeBaseDen = stream->time_base.den;
+    key.threads = threads;
+    if (parameters->extradata && parameters->extradata_size > 0) {
+        key.extradata = QByteArray(reinterpret_cast<const char*>(parameters->extradata), parameters->extradata_size);
+    }
+    return key;
+}
+
+bool DecoderPool::Key::operator==(const Key& other) const
+{
+    return codecId == other.codecId
+        && codecType == other.codecType
+        && codecTag == other.codecTag
+        && format == other.format
+        && profile == other.profile
+        && level == other.level
+        && width == other.width
+        && height == other.height
+        && colorRange == other.colorRange
+        && colorSpace == other.colorSpace
+        && sampleRate == other.sampleRate
+        && channels == other.channels
+        && blockAlign == other.blockAlign
+        && bitsPerCodedSample == other.bitsPerCodedSample
+        && timeBaseNum == other.timeBaseNum
+        && timeBaseDen == other.timeBaseDen
+        && threads == other.threads
+        && extradata == other.extradata;
+}
+
+// --- Lease --- //
+
+DecoderPool::Lease::Lease()
+    : m_pool(nullptr)
+    , m_reused(false)
+{
+}
+
+DecoderPool::Lease::Lease(DecoderPool* pool, Key key, CodecContextPtr context, bool reused)
+    : m_pool(pool)
+    , m_key(std::move(key))
+    , m_context(std::move(context))
+    , m_reused(reused)
+{
+}
+
+DecoderPool::Lease::~Lease()
+{
+    reset();
+}
+
+DecoderPool::Lease::Lease(Lease&& other) noexcept
+    : m_pool(other.m_pool)
+    , m_key(std::move(other.m_key))
+    , m_context(std::move(other.m_context))
+    , m_reused(other.m_reused)
+{
+    other.m_pool = nullptr;
+    other.m_reused = false;
+}
+
+DecoderPool::Lease& DecoderPool::Lease::operator=(Lease&& other) noexcept
+{
+    if (this != &other) {
+        reset();
+        m_pool = other.m_pool;
+        m_key = std::move(other.m_key);
+        m_context = std::move(other.m_context);
+        m_reused = other.m_reused;
+        other.m_pool = nullptr;
+        other.m_reused = false;
+    }
+    return *this;
+}
+
+/**
+ * @brief 获取解码器上下文
+ */
+AVCodecContext* DecoderPool::Lease::get() const
+{
+    return m_context.get();
+}
+
+AVCodecContext* DecoderPool::Lease::operator->() const
+{
+    return m_context.get();
+}
+
+DecoderPool::Lease::operator bool() const
+{
+    return m_context != nullptr;
+}
+
+/**
+ * @brief 是否为池中复用的解码器
+ */
+bool DecoderPool::Lease::reused() const
+{
+    return m_reused;
+}
+
+/**
+ * @brief 归还解码器
+ */
+void DecoderPool::Lease::reset()
+{
+    if (m_pool && m_context) {
+        m_pool->release(std::move(m_key), std::move(m_context));
+    }
+    m_pool = nullptr;
+    m_context.reset();
+    m_reused = false;
+}
+
+// --- DecoderPool --- //
+
+/**
+ * @brief 获取进程内唯一的解码器池
+ *
+ * @return DecoderPool& 解码器池
+ */
+DecoderPool& DecoderPool::instance()
+{
+    static DecoderPool pool;
+    return pool;
+}
+
+/**
+ * @brief 构造函数
+ */
+DecoderPool::DecoderPool()
+    : m_capacity(kDefaultCapacity)
+    , m_hits(0)
+    , m_misses(0)
+    , m_evictions(0)
+{
+}
+
+/**
+ * @brief 借用与流参数一致的解码器，没有则打开一个新的
+ *
+ * @param stream  媒体流
+ * @param threads 解码线程数
+ * @return Lease 借出的解码器
+ */
+DecoderPool::Lease DecoderPool::acquire(const AVStream* stream, int threads)
+{
+    Key key = Key::fromStream(stream, threads);
+    {
+        QMutexLocker locker(&m_mutex);
+        // 从最近归还的找起
+        for (auto it = m_idle.rbegin(); it != m_idle.rend(); ++it) {
+            if (it->key == key) {
+                CodecContextPtr context = std::move(it->context);
+                m_idle.erase(std::next(it).base());
+                m_hits.fetch_add(1, std::memory_order_relaxed);
+                AURORA_TRACE_INSTANT("decode", "decoderReused");
+                return Lease(this, std::move(key), std::move(context), true);
+            }
+        }
+    }
+
+    m_misses.fetch_add(1, std::memory_order_relaxed);
+    CodecContextPtr context = openDecoder(stream, threads);
+    if (!context) {
+        return Lease();
+    }
+    return Lease(this, std::move(key), std::move(context), false);
+}
+
+/**
+ * @brief 设置保留的空闲解码器数量
+ *
+ * @param count 数量
+ */
+void DecoderPool::setCapacity(int count)
+{
+    // 帧线程解码器释放时要等待其线程退出：先声明的 evicted 后析构，在解锁之后才释放
+    std::deque<Entry> evicted;
+    QMutexLocker locker(&m_mutex);
+    m_capacity = qMax(count, 0);
+    while (static_cast<int>(m_idle.size()) > m_capacity) {
+        evicted.push_back(std::move(m_idle.front()));
+        m_idle.pop_front();
+        m_evictions.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+/**
+ * @brief 释放所有空闲解码器
+ */
+void DecoderPool::clear()
+{
+    std::deque<Entry> evicted;
+    QMutexLocker locker(&m_mutex);
+    evicted.swap(m_idle);
+}
+
+/**
+ * @brief 获取空闲解码器数量
+ */
+int DecoderPool::idleCount() const
+{
+    QMutexLocker locker(&m_mutex);
+    return static_cast<int>(m_idle.size());
+}
+
+/**
+ * @brief 将统计序列化为 JSON
+ */
+QJsonObject DecoderPool::toJson() const
+{
+    QJsonObject object;
+    {
+        QMutexLocker locker(&m_mutex);
+        object["idle"] = static_cast<int>(m_idle.size());
+        object["capacity"] = m_capacity;
+    }
+    object["reused"] = static_cast<qint64>(m_hits.load(std::memory_order_relaxed));
+    object["opened"] = static_cast<qint64>(m_misses.load(std::memory_order_relaxed));
+    object["evicted"] = static_cast<qint64>(m_evictions.load(std::memory_order_relaxed));
+    return object;
+}
+
+/**
+ * @brief 冲刷解码器并放回池中
+ *
+ * 冲刷后解码器回到刚打开时的状态，下一个文件从关键帧开始送包即可；
+ * 超出容量时释放最久未用的一个。
+ *
+ * @param key     解码器参数
+ * @param context 解码器上下文
+ */
+void DecoderPool::release(Key key, CodecContextPtr context)
+{
+    avcodec_flush_buffers(context.get());
+
+    // 同 setCapacity()：evicted 在解锁之后才释放
+    CodecContextPtr evicted;
+    QMutexLocker locker(&m_mutex);
+    if (m_capacity <= 0) {
+        evicted = std::move(context);
+        return;
+    }
+
+    m_idle.push_back(Entry{std::move(key), std::move(context)});
+    if (static_cast<int>(m_idle.size()) > m_capacity) {
+        evicted = std::move(m_idle.front().context);
+        m_idle.pop_front();
+        m_evictions.fetch_add(1, std::memory_order_relaxed);
+    }
+}
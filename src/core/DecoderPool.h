@@ -0,0 +1,191 @@
+/********************************************************************************
+ * @file   : DecoderPool.h
+ * @brief  : 声明了 DecoderPool 类。
+ *
+ * 该文件声明了进程内共享的解码器池。会话结束时解码器冲刷后归还到池中，
+ * 下一个文件的流参数（编码、格式、尺寸/采样率、extradata、线程数等）完全一致
+ * 时直接借用，省去 avcodec_open2 和解码线程池的启动；参数不同则新开一个。
+ * 池中只保留少量空闲解码器，最久未用的先释放。
+ *
+ * @author : polarours
+ * @date   : 2026/10/18
+ ********************************************************************************/
+
+#ifndef AURORAPLAYER_DECODERPOOL_H
+#define AURORAPLAYER_DECODERPOOL_H
+
+#include <QByteArray>
+#include <QJsonObject>
+#include <QMutex>
+#include <QtGlobal>
+
+#include <atomic>
+#include <deque>
+
+#include "FFmpegHandles.h"
+
+class DecoderPool
+{
+public:
+    /**
+     * @struct Key
+     * @brief 可互换的解码器所需一致的参数
+     */
+    struct Key {
+        int codecId = 0;            ///< AVCodecID
+        int codecType = 0;          ///< AVMediaType
+        quint32 codecTag = 0;       ///< 编码标签
+        int format = -1;            ///< 像素格式或采样格式
+        int profile = 0;            ///< 编码档次
+        int level = 0;              ///< 编码级别
+        int width = 0;              ///< 视频宽度
+        int height = 0;             ///< 视频高度
+        int colorRange = 0;         ///< 色彩范围
+        int colorSpace = 0;         ///< 色彩空间
+        int sampleRate = 0;         ///< 采样率
+        int channels = 0;           ///< 声道数
+        int blockAlign = 0;         ///< 音频块对齐
+        int bitsPerCodedSample = 0; ///< 每个编码采样的位数
+        int timeBaseNum = 0;        ///< 流时间基分子
+        int timeBaseDen = 0;        ///< 流时间基分母
+        int threads = 0;            ///< 解码线程数设置
+        QByteArray extradata;       ///< 编码器私有数据（如 SPS/PPS）
+
+        /**
+         * @brief 由流参数生成
+         *
+         * @param stream  媒体流
+         * @param threads 解码线程数设置
+         * @return Key 键
+         */
+        static Key fromStream(const AVStream* stream, int threads);
+
+        bool operator==(const Key& other) const;
+    };
+
+    /**
+     * @class Lease
+     * @brief 借出的解码器（RAII）：析构或 reset() 时冲刷后归还到池中
+     */
+    class Lease
+    {
+    public:
+        Lease();
+        ~Lease();
+
+        Lease(Lease&& other) noexcept;
+        Lease& operator=(Lease&& other) noexcept;
+
+        Lease(const Lease&) = delete;
+        Lease& operator=(const Lease&) = delete;
+
+        /**
+         * @brief 获取解码器上下文
+         *
+         * @return AVCodecContext* 上下文，未持有时为 nullptr
+         */
+        AVCodecContext* get() const;
+
+        AVCodecContext* operator->() const;
+        explicit operator bool() const;
+
+        /**
+         * @brief 是否为池中复用的解码器
+         *
+         * @return bool 是否复用
+         */
+        bool reused() const;
+
+        /**
+         * @brief 归还解码器
+         */
+        void reset();
+
+    private:
+        friend class DecoderPool;
+
+        Lease(DecoderPool* pool, Key key, CodecContextPtr context, bool reused);
+
+    private:
+        DecoderPool* m_pool;       ///< 所属池
+        Key m_key;                 ///< 解码器参数
+        CodecContextPtr m_context; ///< 解码器上下文
+        bool m_reused;             ///< 是否复用
+    };
+
+    /**
+     * @brief 获取进程内唯一的解码器池
+     *
+     * @return DecoderPool& 解码器池
+     */
+    static DecoderPool& instance();
+
+    DecoderPool(const DecoderPool&) = delete;
+    DecoderPool& operator=(const DecoderPool&) = delete;
+
+    /**
+     * @brief 借用与流参数一致的解码器，没有则打开一个新的
+     *
+     * @param stream  媒体流
+     * @param threads 解码线程数，0 表示由 FFmpeg 按核心数决定
+     * @return Lease 借出的解码器，打开失败时为空
+     */
+    Lease acquire(const AVStream* stream, int threads);
+
+    /**
+     * @brief 设置保留的空闲解码器数量（多出的立即释放）
+     *
+     * @param count 数量，0 表示不保留
+     */
+    void setCapacity(int count);
+
+    /**
+     * @brief 释放所有空闲解码器
+     */
+    void clear();
+
+    /**
+     * @brief 获取空闲解码器数量
+     *
+     * @return int 数量
+     */
+    int idleCount() const;
+
+    /**
+     * @brief 将统计序列化为 JSON
+     *
+     * @return QJsonObject JSON 对象
+     */
+    QJsonObject toJson() const;
+
+private:
+    /**
+     * @brief 池中的空闲解码器
+     */
+    struct Entry {
+        Key key;                 ///< 解码器参数
+        CodecContextPtr context; ///< 已冲刷的解码器上下文
+    };
+
+    DecoderPool();
+
+    /**
+     * @brief 冲刷解码器并放回池中
+     *
+     * @param key     解码器参数
+     * @param context 解码器上下文
+     */
+    void release(Key key, CodecContextPtr context);
+
+private:
+    mutable QMutex m_mutex;     ///< 保护 m_idle 和 m_capacity
+    std::deque<Entry> m_idle;   ///< 空闲解码器，队尾最近归还
+    int m_capacity;             ///< 保留的空闲解码器数量
+
+    // --- 统计 --- //
+    std::atomic<quint64> m_hits;      ///< 复用次数
+    std::atomic<quint64> m_misses;    ///< 新开次数
+    std::atomic<quint64> m_evictions; ///< 因超出容量释放的次数
+};
+
+#endif // AURORAPLAYER_DECODERPOOL_H
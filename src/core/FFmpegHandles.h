@@ -0,0 +1,64 @@
+/********************************************************************************
+ * @file   : FFmpegHandles.h
+ * @brief  : 定义了 FFmpeg 对象的 RAII 句柄。
+ *
+ * 该文件为播放引擎用到的 FFmpeg 对象定义 std::unique_ptr 别名及对应的释放器，
+ * 对象随句柄离开作用域自动释放，错误分支不再需要逐个调用 *_free。
+ *
+ * @author : polarours
+ * @date   : 2026/10/18
+ ********************************************************************************/
+
+#ifndef AURORAPLAYER_FFMPEGHANDLES_H
+#define AURORAPLAYER_FFMPEGHANDLES_H
+
+#include <memory>
+
+extern "C" {
+#include <libavcodec/avcodec.h>
+#include <libavformat/avformat.h>
+#include <libswscale/swscale.h>
+}
+
+/**
+ * @brief 关闭格式上下文（avformat_close_input）
+ */
+struct FormatContextDeleter {
+    void operator()(AVFormatContext* context) const { avformat_close_input(&context); }
+};
+
+/**
+ * @brief 释放解码器上下文（avcodec_free_context）
+ */
+struct CodecContextDeleter {
+    void operator()(AVCodecContext* context) const { avcodec_free_context(&context); }
+};
+
+/**
+ * @brief 释放压缩包（av_packet_free）
+ */
+struct PacketDeleter {
+    void operator()(AVPacket* packet) const { av_packet_free(&packet); }
+};
+
+/**
+ * @brief 释放帧（av_frame_free）
+ */
+struct FrameDeleter {
+    void operator()(AVFrame* frame) const { av_frame_free(&frame); }
+};
+
+/**
+ * @brief 释放像素格式转换上下文（sws_freeContext）
+ */
+struct SwsContextDeleter {
+    void operator()(SwsContext* context) const { sws_freeContext(context); }
+};
+
+using FormatContextPtr = std::unique_ptr<AVFormatContext, FormatContextDeleter>; ///< 格式上下文句柄
+using CodecContextPtr = std::unique_ptr<AVCodecContext, CodecContextDeleter>;    ///< 解码器上下文句柄
+using PacketPtr = std::unique_ptr<AVPacket, PacketDeleter>;                      ///< 压缩包句柄
+using FramePtr = std::unique_ptr<AVFrame, FrameDeleter>;                         ///< 帧句柄
+using SwsContextPtr = std::unique_ptr<SwsContext, SwsContextDeleter>;            ///< 像素格式转换上下文句柄
+
+#endif // AURORAPLAYER_FFMPEGHANDLES_H
@@ -0,0 +1,480 @@
+/********************************************************************************
+ * @file   : LibraryIndex.cpp
+ * @brief  : 实现了 LibraryIndex 类。
+ *
+ * @author : polarours
+ * @date   : 2026/10/18
+ ********************************************************************************/
+
+#include "LibraryIndex.h"
+#include "Tracer.h"
+
+#include <QDateTime>
+#include <QDebug>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QReadLocker>
+#include <QSaveFile>
+#include <QStandardPaths>
+#include <QWriteLocker>
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+namespace {
+
+    constexpr char kMagic[8] = {'A', 'U', 'R', 'L', 'I', 'B', '\0', '\0'}; ///< 文件魔数
+    constexpr quint32 kByteOrderMark = 0x01020304;                         ///< 字节序标记
+    constexpr quint32 kFlagValid = 1u << 0;                                ///< 探测成功
+
+    /**
+     * @brief 字符串区中的一段 UTF-8 字符串
+     */
+    struct StringRef {
+        quint32 offset; ///< 相对字符串区起始的偏移
+        quint32 length; ///< 字节数
+    };
+
+    /**
+     * @brief FNV-1a 64 位哈希（格式的一部分，不能随 Qt 版本变化）
+     */
+    quint64 pathHash(const QByteArray& utf8Path)
+    {
+        quint64 hash = 14695981039346656037ull;
+        for (const char c : utf8Path) {
+            hash ^= static_cast<uchar>(c);
+            hash *= 1099511628211ull;
+        }
+        return hash;
+    }
+
+} // namespace
+
+/**
+ * @brief 文件头（64 字节）
+ */
+struct LibraryIndex::Header {
+    char magic[8];          ///< 文件魔数
+    quint32 version;        ///< 格式版本
+    quint32 byteOrder;      ///< 写入时的字节序标记
+    quint32 recordSize;     ///< 单条记录字节数
+    quint32 recordCount;    ///< 记录数量
+    quint64 stringsOffset;  ///< 字符串区偏移
+    quint64 stringsSize;    ///< 字符串区大小
+    quint8 reserved[24];    ///< 保留
+};
+
+/**
+ * @brief 定长记录（96 字节），按 pathHash 升序排列
+ */
+struct LibraryIndex::Record {
+    quint64 pathHash;       ///< 路径哈希
+    qint64 durationMs;      ///< 时长（毫秒）
+    qint64 fileSize;        ///< 文件大小（缓存键）
+    qint64 modifiedMs;      ///< 修改时间（缓存键）
+    StringRef path;         ///< 文件路径
+    StringRef title;        ///< 标题
+    StringRef artist;       ///< 艺术家
+    StringRef album;        ///< 专辑
+    StringRef videoCodec;   ///< 视频编码
+    StringRef audioCodec;   ///< 音频编码
+    qint32 width;           ///< 视频宽度
+    qint32 height;          ///< 视频高度
+    quint32 flags;          ///< 标志位
+    quint32 reserved;       ///< 保留
+};
+
+/**
+ * @brief 构造函数
+ */
+LibraryIndex::LibraryIndex()
+    : m_data(nullptr)
+    , m_dataSize(0)
+    , m_records(nullptr)
+    , m_recordCount(0)
+    , m_strings(nullptr)
+    , m_stringsSize(0)
+{
+    static_assert(sizeof(Header) == 64, "LibraryIndex header layout changed");
+    static_assert(sizeof(Record) == 96, "LibraryIndex record layout changed");
+}
+
+/**
+ * @brief 析构函数
+ */
+LibraryIndex::~LibraryIndex()
+{
+    unmapFile();
+}
+
+/**
+ * @brief 映射索引文件
+ *
+ * @param filePath 索引文件路径
+ * @return bool 是否成功映射了已有索引
+ */
+bool LibraryIndex::open(const QString& filePath)
+{
+    AURORA_TRACE_SCOPE("library", "open");
+
+    QWriteLocker locker(&m_lock);
+    unmapFile();
+    m_pending.clear();
+    m_filePath = filePath;
+    return mapFile();
+}
+
+/**
+ * @brief 获取条目数量
+ *
+ * @return int 条目数量
+ */
+int LibraryIndex::size() const
+{
+    QReadLocker locker(&m_lock);
+    return static_cast<int>(m_recordCount) + m_pending.size();
+}
+
+/**
+ * @brief 查找文件的元数据
+ *
+ * @param filePath 文件路径
+ * @param metadata 输出元数据
+ * @return bool 是否找到
+ */
+bool LibraryIndex::lookup(const QString& filePath, MediaMetadata* metadata) const
+{
+    const QByteArray utf8Path = filePath.toUtf8();
+
+    QReadLocker locker(&m_lock);
+    const auto it = m_pending.constFind(utf8Path);
+    if (it != m_pending.constEnd()) {
+        *metadata = it.value();
+        return true;
+    }
+
+    const Record* record = findRecord(utf8Path, pathHash(utf8Path));
+    if (!record) {
+        return false;
+    }
+    *metadata = readRecord(*record);
+    return true;
+}
+
+/**
+ * @brief 查找文件的元数据，并确认文件自记录以来未被修改
+ *
+ * @param filePath 文件路径
+ * @param metadata 输出元数据
+ * @return bool 是否找到且仍然有效
+ */
+bool LibraryIndex::lookupFresh(const QString& filePath, MediaMetadata* metadata) const
+{
+    if (!lookup(filePath, metadata)) {
+        return false;
+    }
+
+    const QFileInfo fileInfo(filePath);
+    return fileInfo.exists()
+           && metadata->fileSize == fileInfo.size()
+           && metadata->modifiedMs == fileInfo.lastModified().toMSecsSinceEpoch();
+}
+
+/**
+ * @brief 获取索引中全部文件路径
+ *
+ * @return QStringList 文件路径列表
+ */
+QStringList LibraryIndex::filePaths() const
+{
+    QReadLocker locker(&m_lock);
+
+    QStringList paths;
+    paths.reserve(static_cast<qsizetype>(m_recordCount) + m_pending.size());
+    for (quint32 i = 0; i < m_recordCount; ++i) {
+        const Record& record = m_records[i];
+        if (quint64(record.path.offset) + record.path.length > m_stringsSize) {
+            continue;
+        }
+        const QByteArray key = QByteArray::fromRawData(m_strings + record.path.offset, record.path.length);
+        if (!m_pending.contains(key)) {
+            paths.append(QString::fromUtf8(key));
+        }
+    }
+    for (auto it = m_pending.constBegin(); it != m_pending.constEnd(); ++it) {
+        paths.append(QString::fromUtf8(it.key()));
+    }
+    return paths;
+}
+
+/**
+ * @brief 插入或更新条目
+ *
+ * @param filePath 文件路径
+ * @param metadata 元数据
+ */
+void LibraryIndex::insert(const QString& filePath, const MediaMetadata& metadata)
+{
+    const QByteArray utf8Path = filePath.toUtf8();
+
+    QWriteLocker locker(&m_lock);
+    m_pending.insert(utf8Path, metadata);
+}
+
+/**
+ * @brief 将未保存的条目与映射区合并，写出新索引并重新映射
+ *
+ * 映射区中的记录直接按字节复制（包括字符串），不经过 QString。
+ *
+ * @return bool 是否保存成功
+ */
+bool LibraryIndex::save()
+{
+    AURORA_TRACE_SCOPE("library", "save");
+
+    QWriteLocker locker(&m_lock);
+    if (m_pending.isEmpty()) {
+        return true;
+    }
+    if (m_filePath.isEmpty()) {
+        return false;
+    }
+
+    // --- 合并：被更新的旧记录跳过，按哈希排序 --- //
+    struct Item {
+        quint64 hash;
+        const Record* mapped;
+        QHash<QByteArray, MediaMetadata>::const_iterator pending;
+    };
+
+    std::vector<Item> items;
+    items.reserve(m_recordCount + static_cast<size_t>(m_pending.size()));
+    for (quint32 i = 0; i < m_recordCount; ++i) {
+        const Record& record = m_records[i];
+        if (quint64(record.path.offset) + record.path.length > m_stringsSize) {
+            continue;
+        }
+        const QByteArray key = QByteArray::fromRawData(m_strings + record.path.offset, record.path.length);
+        if (!m_pending.contains(key)) {
+            items.push_back({record.pathHash, &record, m_pending.constEnd()});
+        }
+    }
+    for (auto it = m_pending.constBegin(); it != m_pending.constEnd(); ++it) {
+        items.push_back({pathHash(it.key()), nullptr, it});
+    }
+    std::stable_sort(items.begin(), items.end(),
+                     [](const Item& a, const Item& b) { return a.hash < b.hash; });
+
+    // --- 生成记录和字符串区 --- //
+    QByteArray strings;
+    strings.reserve(static_cast<qsizetype>(m_stringsSize) + m_pending.size() * 128);
+    auto appendString = [&strings](const char* data, quint32 length) -> StringRef {
+        const StringRef ref{static_cast<quint32>(strings.size()), length};
+        strings.append(data, length);
+        return ref;
+    };
+    auto copyString = [&](const StringRef& ref) -> StringRef {
+        if (quint64(ref.offset) + ref.length > m_stringsSize) {
+            return StringRef{0, 0};
+        }
+        return appendString(m_strings + ref.offset, ref.length);
+    };
+    auto encodeString = [&](const QString& value) -> StringRef {
+        const QByteArray utf8 = value.toUtf8();
+        return appendString(utf8.constData(), static_cast<quint32>(utf8.size()));
+    };
+
+    std::vector<Record> records;
+    records.reserve(items.size());
+    for (const Item& item : items) {
+        Record record{};
+        if (item.mapped) {
+            record = *item.mapped;
+            record.path = copyString(item.mapped->path);
+            record.title = copyString(item.mapped->title);
+            record.artist = copyString(item.mapped->artist);
+            record.album = copyString(item.mapped->album);
+            record.videoCodec = copyString(item.mapped->videoCodec);
+            record.audioCodec = copyString(item.mapped->audioCodec);
+        } else {
+            const QByteArray& path = item.pending.key();
+            const MediaMetadata& metadata = item.pending.value();
+            record.pathHash = item.hash;
+            record.durationMs = metadata.durationMs;
+            record.fileSize = metadata.fileSize;
+            record.modifiedMs = metadata.modifiedMs;
+            record.path = appendString(path.constData(), static_cast<quint32>(path.size()));
+            record.title = encodeString(metadata.title);
+            record.artist = encodeString(metadata.artist);
+            record.album = encodeString(metadata.album);
+            record.videoCodec = encodeString(metadata.videoCodec);
+            record.audioCodec = encodeString(metadata.audioCodec);
+            record.width = metadata.width;
+            record.height = metadata.height;
+            record.flags = metadata.valid ? kFlagValid : 0;
+        }
+        records.push_back(record);
+    }
+
+    if (static_cast<quint64>(strings.size()) > std::numeric_limits<quint32>::max()) {
+        qWarning() << "Library index too large:" << strings.size() << "bytes of strings";
+        return false;
+    }
+
+    Header header{};
+    std::memcpy(header.magic, kMagic, sizeof(kMagic));
+    header.version = kVersion;
+    header.byteOrder = kByteOrderMark;
+    header.recordSize = sizeof(Record);
+    header.recordCount = static_cast<quint32>(records.size());
+    header.stringsOffset = sizeof(Header) + records.size() * sizeof(Record);
+    header.stringsSize = static_cast<quint64>(strings.size());
+
+    // --- 写出 --- //
+    QDir().mkpath(QFileInfo(m_filePath).absolutePath());
+    QSaveFile file(m_filePath);
+    if (!file.open(QIODevice::WriteOnly)) {
+        qWarning() << "Failed to write library index:" << m_filePath;
+        return false;
+    }
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(reinterpret_cast<const char*>(records.data()),
+               static_cast<qint64>(records.size() * sizeof(Record)));
+    file.write(strings);
+
+    // 某些平台上无法替换仍被映射的文件，提交前先解除映射
+    unmapFile();
+    if (!file.commit()) {
+        qWarning() << "Failed to commit library index:" << m_filePath;
+        mapFile();
+        return false;
+    }
+
+    m_pending.clear();
+    mapFile();
+    return true;
+}
+
+/**
+ * @brief 获取默认索引文件路径
+ *
+ * @return QString 文件路径
+ */
+QString LibraryIndex::defaultPath()
+{
+    return QStandardPaths::writableLocation(QStandardPaths::AppDataLocation) + QStringLiteral("/library.idx");
+}
+
+/**
+ * @brief 在映射区中查找记录
+ */
+const LibraryIndex::Record* LibraryIndex::findRecord(const QByteArray& utf8Path, quint64 hash) const
+{
+    const Record* end = m_records + m_recordCount;
+    const Record* it = std::lower_bound(m_records, end, hash,
+                                        [](const Record& record, quint64 value) { return record.pathHash < value; });
+
+    // 哈希冲突时逐条比较路径字节
+    for (; it != end && it->pathHash == hash; ++it) {
+        if (it->path.length == static_cast<quint32>(utf8Path.size())
+            && quint64(it->path.offset) + it->path.length <= m_stringsSize
+            && std::memcmp(m_strings + it->path.offset, utf8Path.constData(), it->path.length) == 0) {
+            return it;
+        }
+    }
+    return nullptr;
+}
+
+/**
+ * @brief 从记录构造元数据
+ */
+MediaMetadata LibraryIndex::readRecord(const Record& record) const
+{
+    // 越界的字符串视为空，文件损坏时不会读出映射区
+    auto readString = [this](const StringRef& ref) -> QString {
+        if (ref.length == 0 || quint64(ref.offset) + ref.length > m_stringsSize) {
+            return QString();
+        }
+        return QString::fromUtf8(m_strings + ref.offset, ref.length);
+    };
+
+    MediaMetadata metadata;
+    metadata.valid = record.flags & kFlagValid;
+    metadata.durationMs = record.durationMs;
+    metadata.title = readString(record.title);
+    metadata.artist = readString(record.artist);
+    metadata.album = readString(record.album);
+    metadata.videoCodec = readString(record.videoCodec);
+    metadata.audioCodec = readString(record.audioCodec);
+    metadata.width = record.width;
+    metadata.height = record.height;
+    metadata.fileSize = record.fileSize;
+    metadata.modifiedMs = record.modifiedMs;
+    return metadata;
+}
+
+/**
+ * @brief 映射当前文件
+ *
+ * 只校验文件头和各区域边界，记录本身在访问时才读取。
+ */
+bool LibraryIndex::mapFile()
+{
+    auto file = std::make_unique<QFile>(m_filePath);
+    if (!file->open(QIODevice::ReadOnly)) {
+        return false;
+    }
+
+    const qint64 size = file->size();
+    if (size < static_cast<qint64>(sizeof(Header))) {
+        return false;
+    }
+
+    uchar* data = file->map(0, size);
+    if (!data) {
+        return false;
+    }
+
+    const Header* header = reinterpret_cast<const Header*>(data);
+    const quint64 recordsEnd = sizeof(Header) + quint64(header->recordCount) * sizeof(Record);
+    if (std::memcmp(header->magic, kMagic, sizeof(kMagic)) != 0
+        || header->version != kVersion
+        || header->byteOrder != kByteOrderMark
+        || header->recordSize != sizeof(Record)
+        || header->stringsOffset != recordsEnd
+        || header->stringsOffset > static_cast<quint64>(size)
+        || header->stringsSize > static_cast<quint64>(size) - header->stringsOffset) {
+        qWarning() << "Ignoring incompatible library index:" << m_filePath;
+        file->unmap(data);
+        return false;
+    }
+
+    m_file = std::move(file);
+    m_data = data;
+    m_dataSize = size;
+    m_records = reinterpret_cast<const Record*>(data + sizeof(Header));
+    m_recordCount = header->recordCount;
+    m_strings = reinterpret_cast<const char*>(data + header->stringsOffset);
+    m_stringsSize = header->stringsSize;
+    return true;
+}
+
+/**
+ * @brief 解除映射
+ */
+void LibraryIndex::unmapFile()
+{
+    if (m_file && m_data) {
+        m_file->unmap(const_cast<uchar*>(m_data));
+    }
+    m_file.reset();
+    m_data = nullptr;
+    m_dataSize = 0;
+    m_records = nullptr;
+    m_recordCount = 0;
+    m_strings = nullptr;
+    m_stringsSize = 0;
+}
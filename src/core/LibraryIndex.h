@@ -0,0 +1,162 @@
+/********************************************************************************
+ * @file   : LibraryIndex.h
+ * @brief  : 声明了 LibraryIndex 类。
+ *
+ * 该文件声明了持久化的媒体库索引：播放或导入过的文件的路径、探测元数据和
+ * 缓存键，以带版本号的二进制格式保存，启动时整体内存映射。
+ *
+ * @author : polarours
+ * @date   : 2026/10/18
+ ********************************************************************************/
+
+#ifndef AURORAPLAYER_LIBRARYINDEX_H
+#define AURORAPLAYER_LIBRARYINDEX_H
+
+#include <QByteArray>
+#include <QHash>
+#include <QReadWriteLock>
+#include <QString>
+#include <QStringList>
+
+#include <memory>
+
+#include "MediaMetadata.h"
+
+class QFile;
+
+/**
+ * @class LibraryIndex
+ * @brief 内存映射的媒体库索引
+ *
+ * 文件布局：64 字节文件头、按路径哈希排序的定长记录、UTF-8 字符串区。
+ * 打开时只校验文件头，不解析任何记录；lookup() 在映射区上二分查找，
+ * 命中后才构造 QString。新增或更新的条目先放在内存中，save() 时与映射区
+ * 合并写出新文件。
+ *
+ * 索引只是缓存：版本、字节序不符或文件损坏时视为空索引，下次保存时重建。
+ * 所有方法线程安全。
+ */
+class LibraryIndex
+{
+public:
+    static constexpr quint32 kVersion = 1; ///< 当前格式版本
+
+    /**
+     * @brief 构造函数
+     */
+    LibraryIndex();
+
+    /**
+     * @brief 析构函数
+     */
+    ~LibraryIndex();
+
+    LibraryIndex(const LibraryIndex&) = delete;
+    LibraryIndex& operator=(const LibraryIndex&) = delete;
+
+    /**
+     * @brief 映射索引文件
+     *
+     * 文件不存在或格式不符时返回 false，索引保持为空但仍可写入和保存。
+     *
+     * @param filePath 索引文件路径
+     * @return bool 是否成功映射了已有索引
+     */
+    bool open(const QString& filePath);
+
+    /**
+     * @brief 获取条目数量（映射区与未保存条目之和，可能含重复）
+     *
+     * @return int 条目数量
+     */
+    int size() const;
+
+    /**
+     * @brief 查找文件的元数据
+     *
+     * @param filePath 文件路径
+     * @param metadata 输出元数据
+     * @return bool 是否找到
+     */
+    bool lookup(const QString& filePath, MediaMetadata* metadata) const;
+
+    /**
+     * @brief 查找文件的元数据，并确认文件自记录以来未被修改
+     *
+     * 缓存键为文件大小和修改时间。
+     *
+     * @param filePath 文件路径
+     * @param metadata 输出元数据
+     * @return bool 是否找到且仍然有效
+     */
+    bool lookupFresh(const QString& filePath, MediaMetadata* metadata) const;
+
+    /**
+     * @brief 获取索引中全部文件路径（映射区与未保存条目，已去重）
+     *
+     * @return QStringList 文件路径列表
+     */
+    QStringList filePaths() const;
+
+    /**
+     * @brief 插入或更新条目
+     *
+     * @param filePath 文件路径
+     * @param metadata 元数据
+     */
+    void insert(const QString& filePath, const MediaMetadata& metadata);
+
+    /**
+     * @brief 将未保存的条目与映射区合并，写出新索引并重新映射
+     *
+     * 没有未保存的条目时直接返回 true。
+     *
+     * @return bool 是否保存成功
+     */
+    bool save();
+
+    /**
+     * @brief 获取默认索引文件路径（应用数据目录下的 library.idx）
+     *
+     * @return QString 文件路径
+     */
+    static QString defaultPath();
+
+private:
+    struct Header;
+    struct Record;
+
+    /**
+     * @brief 在映射区中查找记录
+     */
+    const Record* findRecord(const QByteArray& utf8Path, quint64 hash) const;
+
+    /**
+     * @brief 从记录构造元数据
+     */
+    MediaMetadata readRecord(const Record& record) const;
+
+    /**
+     * @brief 映射当前文件（调用方持有写锁）
+     */
+    bool mapFile();
+
+    /**
+     * @brief 解除映射（调用方持有写锁）
+     */
+    void unmapFile();
+
+private:
+    mutable QReadWriteLock m_lock;                 ///< 保护以下全部成员
+    QString m_filePath;                            ///< 索引文件路径
+    std::unique_ptr<QFile> m_file;                 ///< 映射中的文件
+    const uchar* m_data;                           ///< 映射区起始地址
+    qint64 m_dataSize;                             ///< 映射区大小
+    const Record* m_records;                       ///< 记录数组
+    quint32 m_recordCount;                         ///< 记录数量
+    const char* m_strings;                         ///< 字符串区
+    quint64 m_stringsSize;                         ///< 字符串区大小
+    QHash<QByteArray, MediaMetadata> m_pending;    ///< 未保存的条目（键为 UTF-8 路径）
+};
+
+#endif // AURORAPLAYER_LIBRARYINDEX_H
@@ -0,0 +1,77 @@
+/********************************************************************************
+ * @file   : MediaClock.cpp
+ * @brief  : 实现了 MediaClock 类。
+ *
+ * @author : polarours
+ * @date   : 2026/10/18
+ ********************************************************************************/
+
+#include "MediaClock.h"
+#include "Metrics.h"
+
+#include <QMutexLocker>
+
+/**
+ * @brief 构造函数
+ */
+MediaClock::MediaClock()
+    : m_baseUs(0)
+    , m_wallUs(PlayerMetrics::nowUs())
+    , m_running(false)
+{
+}
+
+/**
+ * @brief 获取当前媒体时间
+ *
+ * @return qint64 媒体时间（微秒）
+ */
+qint64 MediaClock::timeUs() const
+{
+    const qint64 nowUs = PlayerMetrics::nowUs();
+    QMutexLocker locker(&m_mutex);
+    return m_running ? m_baseUs + (nowUs - m_wallUs) : m_baseUs;
+}
+
+/**
+ * @brief 设置当前媒体时间
+ *
+ * @param mediaUs 媒体时间（微秒）
+ */
+void MediaClock::setTimeUs(qint64 mediaUs)
+{
+    const qint64 nowUs = PlayerMetrics::nowUs();
+    QMutexLocker locker(&m_mutex);
+    m_baseUs = mediaUs;
+    m_wallUs = nowUs;
+}
+
+/**
+ * @brief 启动或冻结时钟
+ *
+ * @param running 是否走时
+ */
+void MediaClock::setRunning(bool running)
+{
+    const qint64 nowUs = PlayerMetrics::nowUs();
+    QMutexLocker locker(&m_mutex);
+    if (running == m_running) {
+        return;
+    }
+    if (!running) {
+        m_baseUs += nowUs - m_wallUs;
+    }
+    m_wallUs = nowUs;
+    m_running = running;
+}
+
+/**
+ * @brief 时钟是否在走
+ *
+ * @return bool 是否走时
+ */
+bool MediaClock::isRunning() const
+{
+    QMutexLocker locker(&m_mutex);
+    return m_running;
+}
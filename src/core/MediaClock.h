@@ -0,0 +1,65 @@
+/********************************************************************************
+ * @file   : MediaClock.h
+ * @brief  : 声明了 MediaClock 类。
+ *
+ * 该文件声明了播放时钟：由系统时钟推进的媒体时间，可暂停、可设置。有音频输出时
+ * 音频线程不断把它校正到音频实际播放到的位置。多个 MediaPlayer 共享同一个时钟时
+ * （视频墙），所有画面按同一时间轴显示。
+ *
+ * @author : polarours
+ * @date   : 2026/10/18
+ ********************************************************************************/
+
+#ifndef AURORAPLAYER_MEDIACLOCK_H
+#define AURORAPLAYER_MEDIACLOCK_H
+
+#include <QMutex>
+#include <QtGlobal>
+
+class MediaClock
+{
+public:
+    /**
+     * @brief 构造函数（时间为 0，暂停状态）
+     */
+    MediaClock();
+
+    MediaClock(const MediaClock&) = delete;
+    MediaClock& operator=(const MediaClock&) = delete;
+
+    /**
+     * @brief 获取当前媒体时间（线程安全）
+     *
+     * @return qint64 媒体时间（微秒）
+     */
+    qint64 timeUs() const;
+
+    /**
+     * @brief 设置当前媒体时间（跳转或按音频校正，线程安全）
+     *
+     * @param mediaUs 媒体时间（微秒）
+     */
+    void setTimeUs(qint64 mediaUs);
+
+    /**
+     * @brief 启动或冻结时钟（线程安全）
+     *
+     * @param running 是否走时
+     */
+    void setRunning(bool running);
+
+    /**
+     * @brief 时钟是否在走
+     *
+     * @return bool 是否走时
+     */
+    bool isRunning() const;
+
+private:
+    mutable QMutex m_mutex; ///< 保护以下成员
+    qint64 m_baseUs;        ///< 基准媒体时间
+    qint64 m_wallUs;        ///< 基准对应的系统时间
+    bool m_running;         ///< 是否走时
+};
+
+#endif // AURORAPLAYER_MEDIACLOCK_H
@@ -0,0 +1,104 @@
+/********************************************************************************
+ * @file   : MediaMetadata.cpp
+ * @brief  : 实现了媒体元数据探测。
+ *
+ * @author : polarours
+ * @date   : 2026/10/18
+ ********************************************************************************/
+
+#include "MediaMetadata.h"
+#include "FFmpegHandles.h"
+#include "Tracer.h"
+
+#include <QDateTime>
+#include <QFileInfo>
+
+extern "C" {
+#include <libavutil/dict.h>
+}
+
+namespace {
+
+    /**
+     * @brief 读取标签（键名精确匹配、不区分大小写），先查容器级再查各流（Ogg/FLAC 的标签在流上）
+     */
+    QString readTag(const AVFormatContext* formatContext, const char* key)
+    {
+        const AVDictionaryEntry* entry = av_dict_get(formatContext->metadata, key, nullptr, 0);
+        for (unsigned int i = 0; !entry && i < formatContext->nb_streams; ++i) {
+            entry = av_dict_get(formatContext->streams[i]->metadata, key, nullptr, 0);
+        }
+        return entry ? QString::fromUtf8(entry->value).trimmed() : QString();
+    }
+
+} // namespace
+
+/**
+ * @brief 使用 FFmpeg 探测文件元数据
+ *
+ * @param filePath 文件路径
+ * @return MediaMetadata 元数据
+ */
+MediaMetadata MediaMetadata::probe(const QString& filePath)
+{
+    AURORA_TRACE_SCOPE("metadata", "probe");
+
+    MediaMetadata metadata;
+
+    const QFileInfo fileInfo(filePath);
+    metadata.fileSize = fileInfo.size();
+    metadata.modifiedMs = fileInfo.lastModified().toMSecsSinceEpoch();
+
+    // 限制探测量：只需要流参数和标签，不需要精确的码率估计
+    AVDictionary* options = nullptr;
+    av_dict_set(&options, "probesize", "1048576", 0);
+    av_dict_set(&options, "analyzeduration", "1000000", 0);
+
+    AVFormatContext* context = nullptr;
+    const int openResult = avformat_open_input(&context, filePath.toUtf8().constData(), nullptr, &options);
+    av_dict_free(&options);
+    if (openResult < 0) {
+        return metadata;
+    }
+
+    const FormatContextPtr formatContext(context);
+    if (avformat_find_stream_info(formatContext.get(), nullptr) < 0) {
+        return metadata;
+    }
+
+    metadata.valid = true;
+    if (formatContext->duration != AV_NOPTS_VALUE) {
+        metadata.durationMs = formatContext->duration / 1000;
+    }
+    metadata.title = readTag(formatContext.get(), "title");
+    metadata.artist = readTag(formatContext.get(), "artist");
+    metadata.album = readTag(formatContext.get(), "album");
+
+    for (unsigned int i = 0; i < formatContext->nb_streams; ++i) {
+        const AVStream* stream = formatContext->streams[i];
+        const AVCodecParameters* codecpar = stream->codecpar;
+        if (codecpar->codec_type == AVMEDIA_TYPE_VIDEO && metadata.videoCodec.isEmpty()
+            && !(stream->disposition & AV_DISPOSITION_ATTACHED_PIC)) {
+            metadata.videoCodec = QString::fromLatin1(avcodec_get_name(codecpar->codec_id));
+            metadata.width = codecpar->width;
+            metadata.height = codecpar->height;
+        } else if (codecpar->codec_type == AVMEDIA_TYPE_AUDIO && metadata.audioCodec.isEmpty()) {
+            metadata.audioCodec = QString::fromLatin1(avcodec_get_name(codecpar->codec_id));
+        }
+    }
+
+    return metadata;
+}
+
+/**
+ * @brief 生成列表显示文本
+ *
+ * @return QString 显示文本
+ */
+QString MediaMetadata::displayTitle() const
+{
+    if (title.isEmpty()) {
+        return QString();
+    }
+    return artist.isEmpty() ? title : artist + QStringLiteral(" - ") + title;
+}
@@ -0,0 +1,51 @@
+/********************************************************************************
+ * @file   : MediaMetadata.h
+ * @brief  : 定义了 MediaMetadata 结构体。
+ *
+ * 该文件定义了媒体文件的探测元数据（时长、标签、编码、分辨率），
+ * 以及使用 FFmpeg 探测元数据的函数。
+ *
+ * @author : polarours
+ * @date   : 2026/10/18
+ ********************************************************************************/
+
+#ifndef AURORAPLAYER_MEDIAMETADATA_H
+#define AURORAPLAYER_MEDIAMETADATA_H
+
+#include <QString>
+
+/**
+ * @struct MediaMetadata
+ * @brief 媒体文件元数据
+ */
+struct MediaMetadata
+{
+    bool valid = false;      ///< 是否探测成功
+    qint64 durationMs = -1;  ///< 时长（毫秒），-1 表示未知
+    QString title;           ///< 标题
+    QString artist;          ///< 艺术家
+    QString album;           ///< 专辑
+    QString videoCodec;      ///< 视频编码名称，无视频时为空
+    QString audioCodec;      ///< 音频编码名称，无音频时为空
+    int width = 0;           ///< 视频宽度
+    int height = 0;          ///< 视频高度
+    qint64 fileSize = -1;    ///< 文件大小（字节）
+    qint64 modifiedMs = -1;  ///< 修改时间（Unix 毫秒）
+
+    /**
+     * @brief 使用 FFmpeg 探测文件元数据（耗时操作，应在工作线程调用）
+     *
+     * @param filePath 文件路径
+     * @return MediaMetadata 元数据，失败时 valid 为 false
+     */
+    static MediaMetadata probe(const QString& filePath);
+
+    /**
+     * @brief 生成列表显示文本（“艺术家 - 标题”，无标签时返回空）
+     *
+     * @return QString 显示文本
+     */
+    QString displayTitle() const;
+};
+
+#endif // AURORAPLAYER_MEDIAMETADATA_H
@@ -4,22 +4,1305 @@
  *
  * 该文件实现了程序的 MediaPlayer 类，用于处理媒体播放。
  *
+ * 每打开一次媒体创建一个会话（Session）：
+ *  - 解复用线程：打开输入、打开解码器和音频设备，随后读取压缩包分发到队列，
+ *    按缓存上限暂停读取，并执行跳转请求；
+ *  - 视频解码线程：解码、按主时钟决定丢弃或等待，转换为 QVideoFrame 后投递到
+ *    界面线程显示；
+ *  - 音频解码线程：解码并转换为交错 float，排入 SDL 音频队列。
+ * 有音频时主时钟取自 SDL 已播放到的位置，否则取墙上时钟。跳转时递增会话的
+ * serial，解码线程据此丢弃跳转前的帧。
+ *
  * @author : polarours
  * @date   : 2025/08/29
  ********************************************************************************/
 
 #include "MediaPlayer.h"
+#include "DecodeScheduler.h"
+#include "DecoderPool.h"
+#include "MediaClock.h"
+#include "PacketQueue.h"
+#include "PcmSource.h"
+#include "Tracer.h"
 #include "../utils/Utils.h"
-#include <QVideoWidget>
-#include <QAudioOutput>
-#include <QFile>
-#include <QTimer>
+
 #include <QDebug>
+#include <QMutex>
+#include <QMutexLocker>
+#include <QThread>
+#include <QTimer>
+#include <QVideoFrame>
+#include <QVideoFrameFormat>
+#include <QVideoSink>
+#include <QVideoWidget>
+#include <QWaitCondition>
+
+#include <deque>
+#include <vector>
+
+#define SDL_MAIN_HANDLED
+#include <SDL.h>
 
 extern "C" {
+#include <libavcodec/avcodec.h>
+#include <libavformat/avformat.h>
 #include <libavutil/imgutils.h>
 #include <libavutil/samplefmt.h>
-#include <libavutil/timestamp.h>
+#include <libswscale/swscale.h>
+}
+
+namespace {
+
+    constexpr int kPositionIntervalMs = 50;                       ///< 播放中发布位置的间隔
+    constexpr qint64 kDefaultPacketCacheBytes = 16 * 1024 * 1024; ///< 默认预读缓存上限
+    constexpr int kMinQueuedPackets = 25;                         ///< 每个队列至少缓存的压缩包数
+    constexpr qint64 kMinQueuedUs = 1000000;                      ///< 每个队列至少缓存的时长
+    constexpr int kDemuxIdleMs = 10;                              ///< 缓存已满或已读到结尾时的等待
+    constexpr qint64 kAudioBufferUs = 200000;                     ///< SDL 音频队列的目标深度
+    constexpr int kAudioPollMs = 10;                              ///< 等待音频队列腾出空间的间隔
+    constexpr Uint16 kAudioDeviceSamples = 1024;                  ///< SDL 音频设备缓冲（采样数）
+    constexpr qint64 kLateDropThresholdUs = 100000;               ///< 落后主时钟超过该值的视频帧不转换直接丢弃
+    constexpr qint64 kPresentEarlyUs = 2000;                      ///< 距显示时刻不足该值时立即显示
+    constexpr qint64 kMaxWaitSliceUs = 10000;                     ///< 等待显示时刻的最长单次睡眠
+    constexpr int kPausePollMs = 10;                              ///< 暂停时视频线程的轮询间隔
+    constexpr int kMaxFramesInFlight = 2;                         ///< 界面线程积压的最大视频帧数
+    constexpr qint64 kDefaultFrameDurationUs = 40000;             ///< 无法得知帧率时的帧时长
+    constexpr qint64 kMaxHiddenPacketBytes = 32 * 1024 * 1024;    ///< 画面不可见时缓存的视频包上限，超出后恢复时等待下一个关键帧
+
+    // --- 纯音频文件：以延迟换取更少的唤醒 --- //
+    constexpr qint64 kAudioOnlyBufferUs = 1000000;                ///< 纯音频时 SDL 队列补满到该深度
+    constexpr qint64 kAudioOnlyRefillUs = 500000;                 ///< 纯音频时队列降到该深度才再次解码
+    constexpr Uint16 kAudioOnlyDeviceSamples = 4096;              ///< 纯音频时的 SDL 设备缓冲（采样数）
+    constexpr int kAudioOnlyDemuxIdleMs = 100;                    ///< 纯音频时解复用线程的空闲等待
+    constexpr int kAudioOnlyPositionIntervalMs = 250;             ///< 纯音频时发布位置的间隔
+    constexpr qint64 kPcmChunkUs = 100000;                        ///< PCM 直读时每次排入 SDL 的时长
+
+    /**
+     * @brief 初始化 SDL 音频子系统（进程内只做一次）
+     *
+     * @return bool 是否可用
+     */
+    bool initializeAudioOutput()
+    {
+        static const bool initialized = [] {
+            SDL_SetMainReady();
+            if (SDL_InitSubSystem(SDL_INIT_AUDIO) != 0) {
+                qWarning() << "Failed to initialize SDL audio:" << SDL_GetError();
+                return false;
+            }
+            return true;
+        }();
+        return initialized;
+    }
+
+    /**
+     * @brief 获取解码器上下文的声道数
+     */
+    int channelCount(const AVCodecContext* codec)
+    {
+#if LIBAVUTIL_VERSION_INT >= AV_VERSION_INT(57, 28, 100)
+        return codec->ch_layout.nb_channels;
+#else
+        return codec->channels;
+#endif
+    }
+
+    /**
+     * @brief 获取音频帧的声道数
+     */
+    int channelCount(const AVFrame* frame)
+    {
+#if LIBAVUTIL_VERSION_INT >= AV_VERSION_INT(57, 28, 100)
+        return frame->ch_layout.nb_channels;
+#else
+        return frame->channels;
+#endif
+    }
+
+    /**
+     * @brief 获取流参数的声道数
+     */
+    int channelCount(const AVCodecParameters* parameters)
+    {
+#if LIBAVUTIL_VERSION_INT >= AV_VERSION_INT(57, 28, 100)
+        return parameters->ch_layout.nb_channels;
+#else
+        return parameters->channels;
+#endif
+    }
+
+    /**
+     * @brief 是否为未压缩的 PCM 编码（可由 PcmSource 直读）
+     */
+    bool isPcmCodec(AVCodecID codecId)
+    {
+        switch (codecId) {
+            case AV_CODEC_ID_PCM_U8:
+            case AV_CODEC_ID_PCM_S8:
+            case AV_CODEC_ID_PCM_S16LE:
+            case AV_CODEC_ID_PCM_S16BE:
+            case AV_CODEC_ID_PCM_S24LE:
+            case AV_CODEC_ID_PCM_S24BE:
+            case AV_CODEC_ID_PCM_S32LE:
+            case AV_CODEC_ID_PCM_S32BE:
+            case AV_CODEC_ID_PCM_S64LE:
+            case AV_CODEC_ID_PCM_S64BE:
+            case AV_CODEC_ID_PCM_F32LE:
+            case AV_CODEC_ID_PCM_F32BE:
+            case AV_CODEC_ID_PCM_F64LE:
+            case AV_CODEC_ID_PCM_F64BE:
+                return true;
+            default:
+                return false;
+        }
+    }
+
+    /**
+     * @brief 选择 SDL 支持的输出声道数（1/2/4/6/8），多出的声道被舍弃
+     */
+    int outputChannels(int inputChannels)
+    {
+        if (inputChannels <= 0) {
+            return 2;
+        }
+        if (inputChannels >= 8) {
+            return 8;
+        }
+        return inputChannels <= 2 ? inputChannels : inputChannels & ~1;
+    }
+
+    /**
+     * @brief 读取一个采样并归一化为 [-1, 1]
+     *
+     * @param data   采样地址
+     * @param format 打包后的采样格式
+     */
+    float readSample(const uint8_t* data, AVSampleFormat format)
+    {
+        switch (format) {
+            case AV_SAMPLE_FMT_U8:  return (static_cast<int>(*data) - 128) / 128.0f;
+            case AV_SAMPLE_FMT_S16: return *reinterpret_cast<const int16_t*>(data) / 32768.0f;
+            case AV_SAMPLE_FMT_S32: return static_cast<float>(*reinterpret_cast<const int32_t*>(data) / 2147483648.0);
+            case AV_SAMPLE_FMT_S64: return static_cast<float>(*reinterpret_cast<const int64_t*>(data) / 9223372036854775808.0);
+            case AV_SAMPLE_FMT_FLT: return *reinterpret_cast<const float*>(data);
+            case AV_SAMPLE_FMT_DBL: return static_cast<float>(*reinterpret_cast<const double*>(data));
+            default:                return 0.0f;
+        }
+    }
+
+    /**
+     * @brief 将解码后的音频帧转换为交错 float 并乘以增益
+     *
+     * 声道数少于输出时重复最后一个声道，多于输出时舍弃多出的声道（单声道输出取平均）。
+     *
+     * @param frame          音频帧
+     * @param outputChannels 输出声道数
+     * @param gain           增益
+     * @param samples        输出：交错采样
+     */
+    void convertSamples(const AVFrame* frame, int outputChannels, float gain, std::vector<float>& samples)
+    {
+        const auto format = static_cast<AVSampleFormat>(frame->format);
+        const AVSampleFormat packed = av_get_packed_sample_fmt(format);
+        const bool planar = av_sample_fmt_is_planar(format);
+        const int bytesPerSample = av_get_bytes_per_sample(packed);
+        const int inputChannels = qMax(channelCount(frame), 1);
+        const int count = frame->nb_samples;
+
+        auto sampleAt = [&](int index, int channel) {
+            const uint8_t* data = planar
+                ? frame->extended_data[channel] + static_cast<size_t>(index) * bytesPerSample
+                : frame->extended_data[0] + (static_cast<size_t>(index) * inputChannels + channel) * bytesPerSample;
+            return readSample(data, packed);
+        };
+
+        samples.resize(static_cast<size_t>(count) * outputChannels);
+        float* out = samples.data();
+        for (int i = 0; i < count; ++i) {
+            if (outputChannels == 1 && inputChannels > 1) {
+                float sum = 0.0f;
+                for (int c = 0; c < inputChannels; ++c) {
+                    sum += sampleAt(i, c);
+                }
+                *out++ = sum / inputChannels * gain;
+                continue;
+            }
+            for (int c = 0; c < outputChannels; ++c) {
+                *out++ = sampleAt(i, qMin(c, inputChannels - 1)) * gain;
+            }
+        }
+    }
+
+    /**
+     * @brief 将解码后的视频帧转换为 QVideoFrame
+     *
+     * YUV420P 和 NV12 直接按平面复制，其它像素格式经 swscale 转换为 YUV420P。
+     *
+     * @param frame 解码后的视频帧
+     * @param sws   缓存的 swscale 上下文
+     * @return QVideoFrame 转换结果，失败时无效
+     */
+    QVideoFrame toVideoFrame(const AVFrame* frame, SwsContextPtr& sws)
+    {
+        const int width = frame->width;
+        const int height = frame->height;
+        const auto sourceFormat = static_cast<AVPixelFormat>(frame->format);
+        const bool nv12 = sourceFormat == AV_PIX_FMT_NV12;
+
+        QVideoFrame videoFrame(QVideoFrameFormat(QSize(width, height),
+                                                 nv12 ? QVideoFrameFormat::Format_NV12 : QVideoFrameFormat::Format_YUV420P));
+        if (!videoFrame.map(QVideoFrame::WriteOnly)) {
+            return QVideoFrame();
+        }
+
+        const int chromaWidth = (width + 1) / 2;
+        const int chromaHeight = (height + 1) / 2;
+        if (sourceFormat == AV_PIX_FMT_YUV420P || sourceFormat == AV_PIX_FMT_YUVJ420P) {
+            av_image_copy_plane(videoFrame.bits(0), videoFrame.bytesPerLine(0), frame->data[0], frame->linesize[0], width, height);
+            av_image_copy_plane(videoFrame.bits(1), videoFrame.bytesPerLine(1), frame->data[1], frame->linesize[1], chromaWidth, chromaHeight);
+            av_image_copy_plane(videoFrame.bits(2), videoFrame.bytesPerLine(2), frame->data[2], frame->linesize[2], chromaWidth, chromaHeight);
+        } else if (nv12) {
+            av_image_copy_plane(videoFrame.bits(0), videoFrame.bytesPerLine(0), frame->data[0], frame->linesize[0], width, height);
+            av_image_copy_plane(videoFrame.bits(1), videoFrame.bytesPerLine(1), frame->data[1], frame->linesize[1], chromaWidth * 2, chromaHeight);
+        } else {
+            // 参数变化时 sws_getCachedContext 会释放旧上下文并返回新的
+            SwsContext* context = sws_getCachedContext(sws.release(), width, height, sourceFormat, width, height,
+                                                       AV_PIX_FMT_YUV420P, SWS_BILINEAR, nullptr, nullptr, nullptr);
+            sws.reset(context);
+            if (!sws) {
+                videoFrame.unmap();
+                return QVideoFrame();
+            }
+            uint8_t* planes[4] = {videoFrame.bits(0), videoFrame.bits(1), videoFrame.bits(2), nullptr};
+            int lineSizes[4] = {videoFrame.bytesPerLine(0), videoFrame.bytesPerLine(1), videoFrame.bytesPerLine(2), 0};
+            sws_scale(sws.get(), frame->data, frame->linesize, 0, height, planes, lineSizes);
+        }
+
+        videoFrame.unmap();
+        return videoFrame;
+    }
+
+} // namespace
+
+/**
+ * @struct MediaPlayer::Session
+ * @brief 一次打开的媒体：FFmpeg/SDL 资源、队列、工作线程和主时钟
+ *
+ * 配置字段在启动线程前写入；FFmpeg 资源由解复用线程在 opened 置位前写入，
+ * 之后只读；跨线程的控制状态均为原子变量。析构时等待所有线程退出再释放资源。
+ */
+struct MediaPlayer::Session
+{
+    // --- 配置 --- //
+    QString path;                  ///< 媒体文件路径
+    quint64 id = 0;                ///< 会话编号
+    MediaPlayer* owner = nullptr;  ///< 所属播放器（只在界面线程访问其非原子成员）
+    PlaybackStats* stats = nullptr; ///< 统计计数器
+    PlayerMetrics* metrics = nullptr; ///< 播放指标
+    int decoderThreads = 0;        ///< 每个解码器的线程数
+    DecodeScheduler* scheduler = nullptr; ///< 共享解码调度器，nullptr 表示不限制
+    qint64 cacheBytes = 0;         ///< 预读缓存上限
+
+    // --- FFmpeg/SDL 资源 --- //
+    FormatContextPtr format;               ///< 格式上下文
+    DecoderPool::Lease videoCodec;         ///< 视频解码器（会话结束时归还到解码器池）
+    DecoderPool::Lease audioCodec;         ///< 音频解码器（会话结束时归还到解码器池）
+    SwsContextPtr sws;                     ///< 像素格式转换上下文（仅视频线程使用）
+    std::unique_ptr<PcmSource> pcm;        ///< 未压缩 PCM 的直读源，非空时不解复用也不解码
+    int videoStream = -1;                  ///< 视频流索引
+    int audioStream = -1;                  ///< 音频流索引
+    qint64 startTimeUs = 0;                ///< 容器起始时间，时间戳以此为零点
+    qint64 frameDurationUs = kDefaultFrameDurationUs; ///< 视频帧时长
+    int audioChannels = 0;                 ///< 音频输出声道数
+    qint64 audioBytesPerSecond = 0;        ///< 音频输出每秒字节数
+    std::atomic<SDL_AudioDeviceID> audioDevice{0}; ///< SDL 音频设备，0 表示无
+    bool audioOutput = true;               ///< 是否输出到音频设备（否则按实时节奏丢弃）
+    bool audioEnabled = true;              ///< 是否播放音频流（否则完全忽略）
+    bool audioOnly = false;                ///< 只有音频流（使用更大的缓冲和更少的唤醒）
+    qint64 audioBufferUs = kAudioBufferUs; ///< SDL 队列补满到该深度
+    qint64 audioRefillUs = kAudioBufferUs; ///< 队列降到该深度以下才继续解码
+
+    // --- 队列与线程 --- //
+    PacketQueue videoPackets;      ///< 视频压缩包队列
+    PacketQueue audioPackets;      ///< 音频压缩包队列
+    QThread* demuxThread = nullptr; ///< 解复用线程
+    QThread* videoThread = nullptr; ///< 视频解码线程（由解复用线程创建）
+    QThread* audioThread = nullptr; ///< 音频解码线程（由解复用线程创建）
+
+    // --- 控制 --- //
+    std::atomic<bool> opened{false};         ///< 资源已打开
+    std::atomic<bool> abort{false};          ///< 请求所有线程退出
+    std::atomic<bool> paused{true};          ///< 是否暂停
+    std::atomic<qint64> seekRequestUs{-1};   ///< 待执行的跳转目标，-1 表示无
+    std::atomic<int> serial{0};              ///< 跳转序号，每次跳转递增
+    std::atomic<qint64> videoSkipUntilUs{-1}; ///< 精确跳转：丢弃早于该时间的视频帧
+    std::atomic<qint64> audioSkipUntilUs{-1}; ///< 精确跳转：丢弃早于该时间的音频帧
+    std::atomic<qint64> pcmSeekFrame{0};     ///< PCM 直读：跳转后的起始帧
+    std::atomic<bool> demuxFinished{false};  ///< 已读到输入结尾
+    std::atomic<bool> videoFinished{false};  ///< 视频解码器已排空
+    std::atomic<bool> audioFinished{false};  ///< 音频解码器已排空
+    std::atomic<bool> videoVisible{true};    ///< 画面是否可见（不可见时视频包不解码）
+
+    // --- 空闲等待（跳转、播放/暂停和中止时提前唤醒） --- //
+    QMutex idleMutex;          ///< 配合 idleWake 使用
+    QWaitCondition idleWake;   ///< 唤醒空闲等待中的线程
+
+    // --- 时钟 --- //
+    std::shared_ptr<MediaClock> clock;    ///< 系统时钟（视频墙中为各播放器共享）
+    std::atomic<qint64> audioEndUs{-1};   ///< 已排入 SDL 的音频的结束时间，-1 表示无
+
+    ~Session();
+
+    static int interrupted(void* opaque);
+
+    bool open(QString* error);
+    bool openAudioDevice(int sampleRate, int channels);
+    void demuxLoop();
+    void seek(qint64 targetUs);
+    bool cacheFull() const;
+    void videoLoop();
+    void audioLoop();
+    void pcmLoop();
+    bool waitAudioDrained(int frameSerial);
+    bool waitUntilDue(qint64 ptsUs, int frameSerial, bool presentNow);
+    bool waitPacketDue(qint64 timeUs, int packetSerial);
+    void idleWait(qint64 timeoutUs);
+    void wakeIdle();
+
+    template <typename AcceptPacket, typename OnFrame>
+    void decodeLoop(PacketQueue& queue, AVCodecContext* codec, std::atomic<bool>& finished,
+                    AcceptPacket acceptPacket, OnFrame onFrame);
+
+    qint64 frameTimeUs(const AVFrame* frame, AVRational timeBase) const;
+    qint64 packetTimeUs(const AVPacket* packet, AVRational timeBase) const;
+    qint64 queuedAudioUs() const;
+    qint64 bufferedAudioUs() const;
+    qint64 audioClockUs() const;
+    qint64 currentTimeUs() const;
+    qint64 clockUs();
+};
+
+/**
+ * @brief 析构函数：中止并等待所有线程，然后释放资源
+ */
+MediaPlayer::Session::~Session()
+{
+    abort.store(true);
+    videoPackets.abort();
+    audioPackets.abort();
+    wakeIdle();
+
+    // 解码线程由解复用线程创建，等解复用线程退出后指针才确定
+    if (demuxThread) {
+        demuxThread->wait();
+        delete demuxThread;
+    }
+    for (QThread* thread : {videoThread, audioThread}) {
+        if (thread) {
+            thread->wait();
+            delete thread;
+        }
+    }
+
+    // FFmpeg 资源由成员句柄释放，解码器冲刷后归还到解码器池
+    const SDL_AudioDeviceID device = audioDevice.load();
+    if (device != 0) {
+        SDL_CloseAudioDevice(device);
+    }
+}
+
+/**
+ * @brief FFmpeg 阻塞调用的中断回调
+ */
+int MediaPlayer::Session::interrupted(void* opaque)
+{
+    return static_cast<Session*>(opaque)->abort.load(std::memory_order_relaxed) ? 1 : 0;
+}
+
+/**
+ * @brief 打开输入、解码器和音频设备（在解复用线程调用）
+ *
+ * @param error 输出：失败原因
+ * @return bool 是否至少有一路可播放的流
+ */
+bool MediaPlayer::Session::open(QString* error)
+{
+    AURORA_TRACE_SCOPE("demux", "open");
+
+    AVFormatContext* context = avformat_alloc_context();
+    if (!context) {
+        *error = QStringLiteral("Out of memory");
+        return false;
+    }
+    context->interrupt_callback.callback = &Session::interrupted;
+    context->interrupt_callback.opaque = this;
+
+    if (AuroraPlayer::Utils::isNetworkUrl(path)) {
+        AuroraPlayer::Utils::ensureNetworkInitialized();
+    }
+
+    // 打开失败时 avformat_open_input 会释放并清空 context
+    int result = avformat_open_input(&context, path.toUtf8().constData(), nullptr, nullptr);
+    if (result < 0) {
+        *error = AuroraPlayer::Utils::getErrorMessage(result);
+        return false;
+    }
+    format.reset(context);
+
+    {
+        AURORA_TRACE_SCOPE("demux", "findStreamInfo");
+        result = avformat_find_stream_info(format.get(), nullptr);
+        if (result < 0) {
+            *error = AuroraPlayer::Utils::getErrorMessage(result);
+            return false;
+        }
+    }
+    startTimeUs = format->start_time != AV_NOPTS_VALUE ? format->start_time : 0;
+
+    // 专辑封面是只有一帧的“视频流”，不当作视频播放
+    videoStream = av_find_best_stream(format.get(), AVMEDIA_TYPE_VIDEO, -1, -1, nullptr, 0);
+    if (videoStream >= 0 && (format->streams[videoStream]->disposition & AV_DISPOSITION_ATTACHED_PIC)) {
+        videoStream = -1;
+    }
+    audioStream = audioEnabled ? av_find_best_stream(format.get(), AVMEDIA_TYPE_AUDIO, -1, qMax(videoStream, -1), nullptr, 0) : -1;
+    videoStream = qMax(videoStream, -1);
+    audioStream = qMax(audioStream, -1);
+
+    // 其余的流（封面、字幕、其他音轨）在解复用层直接丢弃，不产生压缩包
+    for (unsigned int i = 0; i < format->nb_streams; ++i) {
+        if (static_cast<int>(i) != videoStream && static_cast<int>(i) != audioStream) {
+            format->streams[i]->discard = AVDISCARD_ALL;
+        }
+    }
+
+    if (videoStream >= 0) {
+        AURORA_TRACE_SCOPE("decode", "openVideoDecoder");
+        const AVStream* stream = format->streams[videoStream];
+        videoCodec = DecoderPool::instance().acquire(stream, decoderThreads);
+        if (videoCodec) {
+            const AVRational frameRate = av_guess_frame_rate(format.get(), const_cast<AVStream*>(stream), nullptr);
+            if (frameRate.num > 0 && frameRate.den > 0) {
+                frameDurationUs = av_rescale_q(1, av_inv_q(frameRate), AV_TIME_BASE_Q);
+            }
+            stats->decoderThreads.store(videoCodec->thread_count, std::memory_order_relaxed);
+            stats->pixelFormat.store(stream->codecpar->format, std::memory_order_relaxed);
+            stats->videoWidth.store(stream->codecpar->width, std::memory_order_relaxed);
+            stats->videoHeight.store(stream->codecpar->height, std::memory_order_relaxed);
+        } else {
+            // 没有可用的视频解码器：按纯音频播放，视频包也不再读出
+            format->streams[videoStream]->discard = AVDISCARD_ALL;
+            videoStream = -1;
+        }
+    }
+
+    // 纯音频（含视频解码器打开失败）：不建视频管线，SDL 缓冲和解码批次加大，线程大部分时间在睡眠
+    audioOnly = videoStream < 0 && audioStream >= 0;
+    if (audioOnly) {
+        audioBufferUs = kAudioOnlyBufferUs;
+        audioRefillUs = kAudioOnlyRefillUs;
+    }
+
+    if (audioStream >= 0) {
+        const AVCodecParameters* parameters = format->streams[audioStream]->codecpar;
+        int sampleRate = 0;
+        int channels = 0;
+
+        // 本地 WAV/AIFF 中的未压缩 PCM：直接映射文件读取采样，不经过解码器
+        if (audioOnly && isPcmCodec(parameters->codec_id) && !AuroraPlayer::Utils::isNetworkUrl(path)) {
+            AURORA_TRACE_SCOPE("decode", "openPcmSource");
+            auto source = std::make_unique<PcmSource>();
+            if (source->open(path)
+                && source->format().sampleRate == parameters->sample_rate
+                && source->format().channels == channelCount(parameters)) {
+                pcm = std::move(source);
+                sampleRate = pcm->format().sampleRate;
+                channels = pcm->format().channels;
+            }
+        }
+        if (!pcm) {
+            AURORA_TRACE_SCOPE("decode", "openAudioDecoder");
+            audioCodec = DecoderPool::instance().acquire(format->streams[audioStream], decoderThreads);
+            if (audioCodec) {
+                sampleRate = audioCodec->sample_rate;
+                channels = channelCount(audioCodec);
+            }
+        }
+
+        const bool decodable = pcm || audioCodec;
+        if (decodable && !audioOutput && sampleRate > 0) {
+            // 不输出：按设备会使用的格式转换后丢弃，保持同样的解码与转换负载
+            audioChannels = outputChannels(channels);
+            audioBytesPerSecond = static_cast<qint64>(sampleRate) * audioChannels * static_cast<qint64>(sizeof(float));
+        } else if (!decodable || !openAudioDevice(sampleRate, channels)) {
+            pcm.reset();
+            audioCodec.reset();
+            audioStream = -1;
+        }
+    }
+
+    if (videoStream < 0 && audioStream < 0) {
+        *error = QStringLiteral("No playable audio or video stream");
+        return false;
+    }
+
+    stats->bitrate.store(format->bit_rate, std::memory_order_relaxed);
+    return true;
+}
+
+/**
+ * @brief 按音频流参数打开 SDL 音频设备（队列模式，初始为暂停）
+ *
+ * @param sampleRate 采样率
+ * @param channels   音频流的声道数
+ * @return bool 是否成功
+ */
+bool MediaPlayer::Session::openAudioDevice(int sampleRate, int channels)
+{
+    if (!initializeAudioOutput() || sampleRate <= 0) {
+        return false;
+    }
+
+    SDL_AudioSpec wanted;
+    SDL_zero(wanted);
+    wanted.freq = sampleRate;
+    wanted.format = AUDIO_F32SYS;
+    wanted.channels = static_cast<Uint8>(outputChannels(channels));
+    wanted.samples = audioOnly ? kAudioOnlyDeviceSamples : kAudioDeviceSamples;
+    wanted.callback = nullptr;
+
+    // 不允许 SDL 更改参数：格式不一致时由 SDL 内部转换
+    SDL_AudioSpec obtained;
+    const SDL_AudioDeviceID device = SDL_OpenAudioDevice(nullptr, 0, &wanted, &obtained, 0);
+    if (device == 0) {
+        qWarning() << "Failed to open audio device:" << SDL_GetError();
+        return false;
+    }
+
+    audioChannels = obtained.channels;
+    audioBytesPerSecond = static_cast<qint64>(obtained.freq) * obtained.channels * static_cast<qint64>(sizeof(float));
+    audioDevice.store(device);
+
+    // 与 play()/pause() 的顺序：两边都先写自己的标志再读对方的，至少一边会看到另一边
+    if (!paused.load()) {
+        SDL_PauseAudioDevice(device, 0);
+    }
+    return true;
+}
+
+/**
+ * @brief 解复用线程主循环
+ */
+void MediaPlayer::Session::demuxLoop()
+{
+    AURORA_TRACE_THREAD_NAME(QStringLiteral("demux"));
+
+    MediaPlayer* player = owner;
+    const quint64 sessionId = id;
+
+    QString error;
+    if (!open(&error)) {
+        if (!abort.load()) {
+            QMetaObject::invokeMethod(player, [player, sessionId, error]() {
+                        player->onSessionFailed(sessionId, error);
+                    }, Qt::QueuedConnection);
+        }
+        return;
+    }
+    opened.store(true);
+
+    const qint64 durationMs = format->duration != AV_NOPTS_VALUE ? format->duration / 1000 : 0;
+    const bool hasVideo = videoStream >= 0;
+    const qint64 bitrate = format->bit_rate;
+    QMetaObject::invokeMethod(player, [player, sessionId, durationMs, hasVideo, bitrate]() {
+                player->onSessionOpened(sessionId, durationMs, hasVideo, bitrate);
+            }, Qt::QueuedConnection);
+
+    if (videoStream >= 0) {
+        videoThread = QThread::create([this]() { videoLoop(); });
+        videoThread->start(QThread::HighPriority);
+    }
+    if (audioStream >= 0) {
+        audioThread = pcm ? QThread::create([this]() { pcmLoop(); })
+                          : QThread::create([this]() { audioLoop(); });
+        audioThread->start(QThread::TimeCriticalPriority);
+    }
+
+    // PCM 直读：音频线程自己从映射取采样，解复用线程只负责执行跳转
+    if (pcm) {
+        while (!abort.load()) {
+            const qint64 seekTarget = seekRequestUs.exchange(-1);
+            if (seekTarget >= 0) {
+                seek(seekTarget);
+            }
+            idleWait(kAudioOnlyDemuxIdleMs * 1000);
+        }
+        return;
+    }
+
+    PacketPtr packet(av_packet_alloc());
+    while (!abort.load()) {
+        const qint64 seekTarget = seekRequestUs.exchange(-1);
+        if (seekTarget >= 0) {
+            seek(seekTarget);
+        }
+
+        if (demuxFinished.load() || cacheFull()) {
+            if (audioOnly) {
+                idleWait(kAudioOnlyDemuxIdleMs * 1000);
+            } else {
+                QThread::msleep(kDemuxIdleMs);
+            }
+            continue;
+        }
+
+        int result;
+        {
+            AURORA_TRACE_SCOPE("demux", "readFrame");
+            result = av_read_frame(format.get(), packet.get());
+        }
+        if (result == AVERROR(EAGAIN)) {
+            QThread::msleep(kDemuxIdleMs);
+            continue;
+        }
+        if (result < 0) {
+            if (abort.load()) {
+                break;
+            }
+            if (result != AVERROR_EOF) {
+                qWarning() << "Read error, treating as end of media:" << AuroraPlayer::Utils::getErrorMessage(result);
+            }
+            // 读到结尾：让解码器排空；仍可跳转回去继续播放
+            if (videoStream >= 0) {
+                videoPackets.putMarker(PacketQueue::Kind::EndOfStream);
+            }
+            if (audioStream >= 0) {
+                audioPackets.putMarker(PacketQueue::Kind::EndOfStream);
+            }
+            demuxFinished.store(true);
+            continue;
+        }
+
+        const AVStream* stream = format->streams[packet->stream_index];
+        const qint64 durationUs = av_rescale_q(packet->duration, stream->time_base, AV_TIME_BASE_Q);
+        if (packet->stream_index == videoStream) {
+            videoPackets.put(packet.get(), durationUs);
+            stats->videoQueueDepth.store(videoPackets.count(), std::memory_order_relaxed);
+        } else if (packet->stream_index == audioStream) {
+            audioPackets.put(packet.get(), durationUs);
+        } else {
+            av_packet_unref(packet.get());
+        }
+    }
+}
+
+/**
+ * @brief 执行跳转：定位到目标之前的关键帧，清空队列并重置时钟
+ *
+ * @param targetUs 目标位置（媒体时间，微秒）
+ */
+void MediaPlayer::Session::seek(qint64 targetUs)
+{
+    AURORA_TRACE_SCOPE("demux", "seek");
+
+    if (pcm) {
+        // 未压缩 PCM 的采样位置与文件偏移成正比，直接定位到目标采样
+        pcmSeekFrame.store(pcm->frameAt(targetUs));
+    } else {
+        const qint64 timestamp = targetUs + startTimeUs;
+        const int result = avformat_seek_file(format.get(), -1, INT64_MIN, timestamp, timestamp, 0);
+        if (result < 0) {
+            qWarning() << "Seek failed:" << AuroraPlayer::Utils::getErrorMessage(result);
+        }
+    }
+
+    // 先递增 serial 再清空队列：解码线程手里跳转前的帧会因 serial 不符被丢弃
+    serial.fetch_add(1);
+    videoPackets.clear();
+    audioPackets.clear();
+    if (videoStream >= 0) {
+        videoSkipUntilUs.store(targetUs);
+        videoPackets.putMarker(PacketQueue::Kind::Flush);
+    }
+    if (audioStream >= 0 && !pcm) {
+        audioSkipUntilUs.store(targetUs);
+        audioPackets.putMarker(PacketQueue::Kind::Flush);
+    }
+
+    const SDL_AudioDeviceID device = audioDevice.load();
+    if (device != 0) {
+        SDL_ClearQueuedAudio(device);
+    }
+    audioEndUs.store(-1);
+    clock->setTimeUs(targetUs);
+    wakeIdle();
+
+    demuxFinished.store(false);
+    videoFinished.store(false);
+    audioFinished.store(false);
+}
+
+/**
+ * @brief 预读缓存是否已满
+ *
+ * 合计字节数达到上限，或每路流都已缓存足够的包和时长时暂停读取。
+ */
+bool MediaPlayer::Session::cacheFull() const
+{
+    if (videoPackets.bytes() + audioPackets.bytes() >= cacheBytes) {
+        return true;
+    }
+
+    auto enough = [](const PacketQueue& queue, int stream) {
+        if (stream < 0) {
+            return true;
+        }
+        const qint64 queuedUs = queue.durationUs();
+        return queue.count() > kMinQueuedPackets && (queuedUs == 0 || queuedUs > kMinQueuedUs);
+    };
+    return enough(videoPackets, videoStream) && enough(audioPackets, audioStream);
+}
+
+/**
+ * @brief 从队列取包解码，直到会话中止
+ *
+ * Flush 标记重置解码器；EndOfStream 标记排空解码器后置位 finished，随后
+ * 解码器被重置，以便跳转回去后继续解码。
+ *
+ * @param queue        压缩包队列
+ * @param codec        解码器上下文
+ * @param finished     解码器已排空标志
+ * @param acceptPacket 压缩包过滤 (const AVPacket* packet) -> bool，返回 false 时不解码该包
+ * @param onFrame      帧回调 (AVFrame* frame, int frameSerial, qint64 decodeUs)
+ */
+template <typename AcceptPacket, typename OnFrame>
+void MediaPlayer::Session::decodeLoop(PacketQueue& queue, AVCodecContext* codec, std::atomic<bool>& finished,
+                                      AcceptPacket acceptPacket, OnFrame onFrame)
+{
+    FramePtr frame(av_frame_alloc());
+    int frameSerial = serial.load();
+
+    PacketQueue::Item item;
+    while (!abort.load() && queue.get(&item)) {
+        if (item.kind == PacketQueue::Kind::Flush) {
+            avcodec_flush_buffers(codec);
+            finished.store(false);
+            frameSerial = serial.load();
+            continue;
+        }
+        if (item.kind == PacketQueue::Kind::Packet && !acceptPacket(item.packet)) {
+            av_packet_free(&item.packet);
+            continue;
+        }
+
+        // 共享解码时每一步先领取执行槽；帧回调（可能等待显示时刻）不占用槽
+        qint64 startUs = PlayerMetrics::nowUs();
+        int sent;
+        {
+            DecodeScheduler::Slot slot(scheduler);
+            AURORA_TRACE_SCOPE("decode", "sendPacket");
+            sent = avcodec_send_packet(codec, item.kind == PacketQueue::Kind::Packet ? item.packet : nullptr);
+        }
+        av_packet_free(&item.packet);
+        if (sent < 0 && sent != AVERROR_EOF) {
+            continue; // 损坏的包：跳过，等待下一个关键帧
+        }
+
+        while (!abort.load()) {
+            int received;
+            {
+                DecodeScheduler::Slot slot(scheduler);
+                AURORA_TRACE_SCOPE("decode", "receiveFrame");
+                received = avcodec_receive_frame(codec, frame.get());
+            }
+            if (received == AVERROR(EAGAIN)) {
+                break;
+            }
+            if (received == AVERROR_EOF) {
+                avcodec_flush_buffers(codec);
+                finished.store(true);
+                break;
+            }
+            if (received < 0) {
+                break;
+            }
+
+            onFrame(frame.get(), frameSerial, PlayerMetrics::nowUs() - startUs);
+            av_frame_unref(frame.get());
+            startUs = PlayerMetrics::nowUs();
+        }
+    }
+}
+
+/**
+ * @brief 视频解码线程主循环
+ */
+void MediaPlayer::Session::videoLoop()
+{
+    AURORA_TRACE_THREAD_NAME(QStringLiteral("video"));
+
+    const AVRational timeBase = format->streams[videoStream]->time_base;
+    int currentSerial = -1;
+    bool presentNext = true; // 打开或跳转后的第一帧总是显示（暂停时也显示）
+
+    // --- 画面不可见：不解码，只保留最近关键帧以来的压缩包，按时钟节奏消费 --- //
+    std::deque<PacketPtr> hiddenPackets;
+    qint64 hiddenBytes = 0;
+    int hiddenSerial = -1;
+    bool hidden = false;
+    bool waitKeyFrame = false; // 缓存溢出后从下一个关键帧恢复
+    FramePtr replayFrame(av_frame_alloc());
+
+    auto clearHidden = [&]() {
+        hiddenPackets.clear();
+        hiddenBytes = 0;
+    };
+
+    // 重新可见：从关键帧重放缓存的包（只解码不转换），解码器立即追上当前位置
+    auto resync = [&]() {
+        AURORA_TRACE_SCOPE("video", "resync");
+        hidden = false;
+        presentNext = true;
+        avcodec_flush_buffers(videoCodec.get());
+        if (hiddenSerial == serial.load()) {
+            for (const PacketPtr& cached : hiddenPackets) {
+                DecodeScheduler::Slot slot(scheduler);
+                if (avcodec_send_packet(videoCodec.get(), cached.get()) < 0) {
+                    continue;
+                }
+                while (avcodec_receive_frame(videoCodec.get(), replayFrame.get()) == 0) {
+                    av_frame_unref(replayFrame.get());
+                }
+            }
+        }
+        clearHidden();
+    };
+
+    auto acceptPacket = [&](const AVPacket* packet) {
+        const int packetSerial = serial.load();
+        const bool keyFrame = (packet->flags & AV_PKT_FLAG_KEY) != 0;
+        if (!videoVisible.load(std::memory_order_relaxed)) {
+            if (!hidden || packetSerial != hiddenSerial) {
+                AURORA_TRACE_INSTANT("video", "hidden");
+                clearHidden();
+                hidden = true;
+                hiddenSerial = packetSerial;
+                waitKeyFrame = false;
+            }
+            if (keyFrame) {
+                clearHidden();
+                waitKeyFrame = false;
+            }
+            if (!waitKeyFrame) {
+                if (hiddenBytes + packet->size > kMaxHiddenPacketBytes) {
+                    clearHidden();
+                    waitKeyFrame = true;
+                } else {
+                    hiddenPackets.emplace_back(av_packet_clone(packet));
+                    hiddenBytes += packet->size;
+                }
+            }
+
+            // 不解码也要按时钟消费，否则解码器会跑到播放位置前面
+            if (waitPacketDue(packetTimeUs(packet, timeBase), packetSerial)
+                && videoVisible.load(std::memory_order_relaxed)) {
+                resync(); // 当前包已在缓存中，随缓存一起重放
+            }
+            return false;
+        }
+
+        if (hidden) {
+            resync();
+        }
+        if (waitKeyFrame) {
+            if (!keyFrame) {
+                return false;
+            }
+            waitKeyFrame = false;
+        }
+        return true;
+    };
+
+    decodeLoop(videoPackets, videoCodec.get(), videoFinished, acceptPacket, [&](AVFrame* frame, int frameSerial, qint64 decodeUs) {
+        metrics->frameDecodeTime.record(decodeUs);
+        stats->framesDecoded.fetch_add(1, std::memory_order_relaxed);
+        stats->videoQueueDepth.store(videoPackets.count(), std::memory_order_relaxed);
+
+        // 跳转前的帧，或刚转为不可见时解码器中剩余的帧：不转换
+        if (frameSerial != serial.load() || !videoVisible.load(std::memory_order_relaxed)) {
+            return;
+        }
+        if (frameSerial != currentSerial) {
+            currentSerial = frameSerial;
+            presentNext = true;
+        }
+
+        const qint64 ptsUs = frameTimeUs(frame, timeBase);
+        qint64 skipUntil = videoSkipUntilUs.load();
+        if (skipUntil >= 0) {
+            if (ptsUs >= 0 && ptsUs + frameDurationUs <= skipUntil) {
+                return; // 精确跳转：关键帧到目标之间的帧只解码不显示
+            }
+            videoSkipUntilUs.compare_exchange_strong(skipUntil, -1);
+        }
+
+        // 已明显落后时不做像素转换，直接丢弃
+        if (!presentNext && ptsUs >= 0 && !paused.load() && clockUs() - ptsUs > kLateDropThresholdUs) {
+            stats->framesDropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        QVideoFrame videoFrame;
+        {
+            DecodeScheduler::Slot slot(scheduler);
+            AURORA_TRACE_SCOPE("convert", "toVideoFrame");
+            videoFrame = toVideoFrame(frame, sws);
+        }
+        if (!videoFrame.isValid()) {
+            return;
+        }
+        if (ptsUs >= 0) {
+            videoFrame.setStartTime(ptsUs);
+            videoFrame.setEndTime(ptsUs + frameDurationUs);
+        }
+
+        if (!waitUntilDue(ptsUs, frameSerial, presentNext)) {
+            return;
+        }
+        presentNext = false;
+
+        if (owner->m_framesInFlight.load() >= kMaxFramesInFlight) {
+            stats->framesDropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        owner->m_framesInFlight.fetch_add(1);
+
+        MediaPlayer* player = owner;
+        const quint64 sessionId = id;
+        QMetaObject::invokeMethod(player, [player, sessionId, videoFrame]() {
+                    player->presentVideoFrame(sessionId, videoFrame);
+                }, Qt::QueuedConnection);
+    });
+}
+
+/**
+ * @brief 等待视频帧的显示时刻
+ *
+ * @param ptsUs       帧时间戳（微秒），未知时立即显示
+ * @param frameSerial 帧所属的跳转序号
+ * @param presentNow  暂停时是否也立即显示（跳转预览）
+ * @return bool 是否应显示该帧（中止或已跳转时为 false）
+ */
+bool MediaPlayer::Session::waitUntilDue(qint64 ptsUs, int frameSerial, bool presentNow)
+{
+    while (!abort.load() && frameSerial == serial.load()) {
+        if (paused.load()) {
+            if (presentNow) {
+                return true;
+            }
+            QThread::msleep(kPausePollMs);
+            continue;
+        }
+        if (ptsUs < 0) {
+            return true;
+        }
+        const qint64 delayUs = ptsUs - clockUs();
+        if (delayUs <= kPresentEarlyUs) {
+            return true;
+        }
+        QThread::usleep(static_cast<unsigned long>(qMin(delayUs, kMaxWaitSliceUs)));
+    }
+    return false;
+}
+
+/**
+ * @brief 画面不可见时等待视频包的播放时刻
+ *
+ * @param timeUs       压缩包时间（微秒），未知时立即返回
+ * @param packetSerial 压缩包所属的跳转序号
+ * @return bool 是否继续处理该包（中止或已跳转时为 false）；画面重新可见时立即返回
+ */
+bool MediaPlayer::Session::waitPacketDue(qint64 timeUs, int packetSerial)
+{
+    while (!abort.load() && packetSerial == serial.load() && !videoVisible.load(std::memory_order_relaxed)) {
+        if (paused.load()) {
+            QThread::msleep(kPausePollMs);
+            continue;
+        }
+        if (timeUs < 0) {
+            break;
+        }
+        const qint64 delayUs = timeUs - clockUs();
+        if (delayUs <= 0) {
+            break;
+        }
+        QThread::usleep(static_cast<unsigned long>(qMin(delayUs, kMaxWaitSliceUs)));
+    }
+    return !abort.load() && packetSerial == serial.load();
+}
+
+/**
+ * @brief 可被提前唤醒的睡眠（纯音频时代替短间隔轮询）
+ *
+ * @param timeoutUs 最长等待时间（微秒）
+ */
+void MediaPlayer::Session::idleWait(qint64 timeoutUs)
+{
+    QMutexLocker locker(&idleMutex);
+    if (!abort.load()) {
+        idleWake.wait(&idleMutex, static_cast<unsigned long>(qMax<qint64>(timeoutUs / 1000, 1)));
+    }
+}
+
+/**
+ * @brief 唤醒所有空闲等待中的线程
+ */
+void MediaPlayer::Session::wakeIdle()
+{
+    QMutexLocker locker(&idleMutex);
+    idleWake.wakeAll();
+}
+
+/**
+ * @brief 音频解码线程主循环
+ */
+void MediaPlayer::Session::audioLoop()
+{
+    AURORA_TRACE_THREAD_NAME(QStringLiteral("audio"));
+
+    const AVRational timeBase = format->streams[audioStream]->time_base;
+    std::vector<float> samples;
+
+    auto acceptPacket = [](const AVPacket*) { return true; };
+    decodeLoop(audioPackets, audioCodec.get(), audioFinished, acceptPacket, [&](AVFrame* frame, int frameSerial, qint64) {
+        if (frameSerial != serial.load()) {
+            return;
+        }
+
+        const int sampleRate = frame->sample_rate > 0 ? frame->sample_rate : audioCodec->sample_rate;
+        const qint64 durationUs = static_cast<qint64>(frame->nb_samples) * 1000000 / sampleRate;
+        qint64 ptsUs = frameTimeUs(frame, timeBase);
+        if (ptsUs < 0) {
+            ptsUs = qMax<qint64>(audioEndUs.load(), 0);
+        }
+
+        qint64 skipUntil = audioSkipUntilUs.load();
+        if (skipUntil >= 0) {
+            if (ptsUs + durationUs <= skipUntil) {
+                return;
+            }
+            audioSkipUntilUs.compare_exchange_strong(skipUntil, -1);
+        }
+
+        if (!waitAudioDrained(frameSerial)) {
+            return;
+        }
+
+        {
+            AURORA_TRACE_SCOPE("convert", "convertSamples");
+            convertSamples(frame, audioChannels, owner->m_volume.load(std::memory_order_relaxed) / 100.0f, samples);
+        }
+
+        const qint64 queuedUs = bufferedAudioUs();
+        if (queuedUs == 0 && !paused.load() && audioEndUs.load() >= 0) {
+            metrics->bufferUnderruns.fetch_add(1, std::memory_order_relaxed);
+        }
+        stats->audioQueueDepth.store(static_cast<int>(queuedUs / 1000), std::memory_order_relaxed);
+
+        const SDL_AudioDeviceID device = audioDevice.load();
+        if (device != 0) {
+            AURORA_TRACE_SCOPE("audio", "queueAudio");
+            SDL_QueueAudio(device, samples.data(), static_cast<Uint32>(samples.size() * sizeof(float)));
+        }
+        audioEndUs.store(ptsUs + durationUs);
+        clockUs(); // 主时钟在播放线程中随音频同步，界面线程只读
+    });
+}
+
+/**
+ * @brief PCM 直读线程主循环
+ *
+ * 每次从映射中取 kPcmChunkUs 的采样转换后排入 SDL；跳转时按 pcmSeekFrame 重新定位，
+ * 读到结尾后置位结束标志并等待跳转或退出。
+ */
+void MediaPlayer::Session::pcmLoop()
+{
+    AURORA_TRACE_THREAD_NAME(QStringLiteral("audio"));
+
+    const int chunkFrames = qMax(1, static_cast<int>(pcm->format().sampleRate * kPcmChunkUs / 1000000));
+    std::vector<float> samples(static_cast<size_t>(chunkFrames) * audioChannels);
+    int frameSerial = -1;
+    qint64 position = 0;
+
+    while (!abort.load()) {
+        const int currentSerial = serial.load();
+        if (currentSerial != frameSerial) {
+            frameSerial = currentSerial;
+            position = pcmSeekFrame.load();
+            audioFinished.store(false);
+            demuxFinished.store(false);
+        }
+
+        if (position >= pcm->frameCount()) {
+            if (frameSerial == serial.load()) {
+                audioFinished.store(true);
+                demuxFinished.store(true);
+            }
+            idleWait(kAudioOnlyDemuxIdleMs * 1000);
+            continue;
+        }
+        if (!waitAudioDrained(frameSerial)) {
+            continue;
+        }
+
+        int count;
+        {
+            AURORA_TRACE_SCOPE("convert", "readPcm");
+            count = pcm->read(position, chunkFrames, audioChannels,
+                              owner->m_volume.load(std::memory_order_relaxed) / 100.0f, samples.data());
+        }
+
+        const qint64 queuedUs = bufferedAudioUs();
+        if (queuedUs == 0 && !paused.load() && audioEndUs.load() >= 0) {
+            metrics->bufferUnderruns.fetch_add(1, std::memory_order_relaxed);
+        }
+        stats->audioQueueDepth.store(static_cast<int>(queuedUs / 1000), std::memory_order_relaxed);
+
+        const SDL_AudioDeviceID device = audioDevice.load();
+        if (device != 0) {
+            AURORA_TRACE_SCOPE("audio", "queueAudio");
+            SDL_QueueAudio(device, samples.data(), static_cast<Uint32>(static_cast<size_t>(count) * audioChannels * sizeof(float)));
+        }
+        position += count;
+        audioEndUs.store(pcm->timeAt(position));
+        clockUs();
+    }
+}
+
+/**
+ * @brief 等待音频缓冲降到可以继续补充的深度
+ *
+ * SDL 队列补满到 audioBufferUs 后，等降到 audioRefillUs 以下再继续；纯音频时
+ * 两者相差半秒，音频线程每次醒来连续补充一批，其余时间睡眠。
+ *
+ * @param frameSerial 当前数据所属的跳转序号
+ * @return bool 是否可以继续（false 表示已跳转或正在退出）
+ */
+bool MediaPlayer::Session::waitAudioDrained(int frameSerial)
+{
+    if (bufferedAudioUs() > audioBufferUs) {
+        qint64 queuedUs;
+        while (!abort.load() && frameSerial == serial.load() && (queuedUs = bufferedAudioUs()) > audioRefillUs) {
+            if (audioOnly) {
+                idleWait(queuedUs - audioRefillUs);
+            } else {
+                QThread::msleep(kAudioPollMs);
+            }
+        }
+    }
+    return !abort.load() && frameSerial == serial.load();
+}
+
+/**
+ * @brief 将帧时间戳换算为以容器起点为零的微秒
+ *
+ * @return qint64 时间戳（微秒），未知时为 -1
+ */
+qint64 MediaPlayer::Session::frameTimeUs(const AVFrame* frame, AVRational timeBase) const
+{
+    const int64_t pts = frame->best_effort_timestamp;
+    if (pts == AV_NOPTS_VALUE) {
+        return -1;
+    }
+    return av_rescale_q(pts, timeBase, AV_TIME_BASE_Q) - startTimeUs;
+}
+
+/**
+ * @brief 将压缩包时间戳换算为以容器起点为零的微秒（优先 pts，其次 dts）
+ *
+ * @return qint64 时间戳（微秒），未知时为 -1
+ */
+qint64 MediaPlayer::Session::packetTimeUs(const AVPacket* packet, AVRational timeBase) const
+{
+    const int64_t timestamp = packet->pts != AV_NOPTS_VALUE ? packet->pts : packet->dts;
+    if (timestamp == AV_NOPTS_VALUE) {
+        return -1;
+    }
+    return av_rescale_q(timestamp, timeBase, AV_TIME_BASE_Q) - startTimeUs;
+}
+
+/**
+ * @brief SDL 队列中尚未播放的音频时长
+ */
+qint64 MediaPlayer::Session::queuedAudioUs() const
+{
+    const SDL_AudioDeviceID device = audioDevice.load();
+    if (device == 0 || audioBytesPerSecond <= 0) {
+        return 0;
+    }
+    return static_cast<qint64>(SDL_GetQueuedAudioSize(device)) * 1000000 / audioBytesPerSecond;
+}
+
+/**
+ * @brief 已解码但尚未播放的音频时长
+ *
+ * 有音频设备时为 SDL 队列深度；不输出音频时为已丢弃音频的结束时间领先系统时钟
+ * 的部分，使音频线程同样按实时节奏运行。
+ */
+qint64 MediaPlayer::Session::bufferedAudioUs() const
+{
+    if (audioDevice.load() != 0) {
+        return queuedAudioUs();
+    }
+    const qint64 audioEnd = audioEndUs.load();
+    return audioEnd >= 0 ? qMax<qint64>(audioEnd - clock->timeUs(), 0) : 0;
+}
+
+/**
+ * @brief 由音频输出推算的媒体时间
+ *
+ * 为“已排入的音频结束时间 − 队列中尚未播放的时长”。
+ *
+ * @return qint64 媒体时间（微秒），没有音频输出或音频已播完时为 -1
+ */
+qint64 MediaPlayer::Session::audioClockUs() const
+{
+    const qint64 audioEnd = audioEndUs.load();
+    if (audioDevice.load() != 0 && audioEnd >= 0) {
+        const qint64 queuedUs = queuedAudioUs();
+        if (queuedUs > 0 || !audioFinished.load()) {
+            return audioEnd - queuedUs;
+        }
+    }
+    return -1;
+}
+
+/**
+ * @brief 读取当前媒体时间（只读，不修改时钟，供界面线程查询位置）
+ *
+ * @return qint64 当前媒体时间（微秒）
+ */
+qint64 MediaPlayer::Session::currentTimeUs() const
+{
+    const qint64 audioUs = audioClockUs();
+    return audioUs >= 0 ? audioUs : clock->timeUs();
+}
+
+/**
+ * @brief 读取主时钟并同步（仅在播放线程中调用）
+ *
+ * 有音频输出时以音频位置为准，并同步到墙上时钟；音频播完或没有音频时
+ * 由墙上时钟接续。
+ *
+ * @return qint64 当前媒体时间（微秒）
+ */
+qint64 MediaPlayer::Session::clockUs()
+{
+    const qint64 audioUs = audioClockUs();
+    if (audioUs >= 0) {
+        clock->setTimeUs(audioUs);
+        return audioUs;
+    }
+    return clock->timeUs();
 }
 
 /**
@@ -28,34 +1311,48 @@ extern "C" {
  * @param parent  父对象。
  */
 MediaPlayer::MediaPlayer(QObject *parent)
-    : QObject(parent)
+    : PlaybackBackend(parent)
     , m_state(AuroraPlayer::State::PlayerState::Stopped) // 初始状态为停止
-    , currentPosition(0)                                 // 当前播放位置
-    , mediaDuration(0)                                   // 媒体时长
-    , positionTimer(new QTimer(this))              // 定时器
-    , videoStreamIndex(-1)                               // 视频流索引
-    , audioStreamIndex(-1)                               // 音频流索引
-    , videoStream(nullptr)                               // 视频流
-    , audioStream(nullptr)                               // 音频流
-    , formatContext(nullptr)                             // 格式上下文
-    , videoCodecContext(nullptr)                         // 视频编解码器上下文
-    , audioCodecContext(nullptr)                         // 音频编解码器上下文
-    , videoOutput(nullptr)                               // 视频输出组件
-    , audioOutput(nullptr)                               // 音频输出组件
+    , m_positionMs(0)                                    // 当前播放位置
+    , m_durationMs(0)                                    // 媒体时长
+    , positionTimer(new QTimer(this))                    // 定时器
+    , m_hasVideo(false)                                  // 是否包含视频
+    , m_bitrate(0)                                       // 码率
+    , m_audioOutputEnabled(true)                         // 输出到音频设备
+    , m_volume(100)                                      // 音量
+    , m_framesInFlight(0)                                // 积压的视频帧
+    , m_decoderThreads(0)                                // 解码线程数（自动）
+    , m_packetCacheBytes(kDefaultPacketCacheBytes)       // 预读缓存上限
+    , m_sharedDecoding(false)                            // 独立解码
+    , m_audioEnabled(true)                               // 播放音频
+    , m_videoVisible(true)                               // 画面可见
+    , m_sessionId(0)                                     // 会话编号
 {
     // 连接定时器信号和槽
     connect(positionTimer, &QTimer::timeout, this, &MediaPlayer::updatePosition);
-    positionTimer->setInterval(1000); // 1000ms更新一次
+    positionTimer->setInterval(kPositionIntervalMs);
+
+    initializeAudioOutput();
 }
 
 /**
  * @brief MediaPlayer 的析构函数。
  *
- * 该函数是 MediaPlayer 的析构函数，负责销毁 MediaPlayer 对象。
+ * 停止所有工作线程并释放 FFmpeg/SDL 资源。
  */
 MediaPlayer::~MediaPlayer()
 {
-    // TODO: 释放资源
+    closeSession();
+}
+
+/**
+ * @brief 获取后端类型
+ *
+ * @return Type 后端类型
+ */
+PlaybackBackend::Type MediaPlayer::type() const
+{
+    return Type::FFmpeg;
 }
 
 /**
@@ -65,19 +1362,22 @@ MediaPlayer::~MediaPlayer()
  */
 void MediaPlayer::setMedia(const QString& mediaPath)
 {
-    // 如果正在播放，则先停止
-    if (m_state == AuroraPlayer::State::PlayerState::Playing || m_state == AuroraPlayer::State::PlayerState::Paused) {
-        stop();
-    }
+    closeSession();
 
-    // 初始化 FFmpeg
-    if (initializeFFmpeg(mediaPath)) {
-        // 发出时长变化信号
-        emit durationChanged(mediaDuration);
-    } else {
-        // 初始化失败，设置状态为错误
-        setState(AuroraPlayer::State::PlayerState::Error);
+    m_mediaPath = mediaPath;
+    m_positionMs = 0;
+    m_durationMs = 0;
+    m_hasVideo = false;
+    m_bitrate = 0;
+    setState(AuroraPlayer::State::PlayerState::Stopped);
+    emit durationChanged(0);
+    emit positionChanged(0);
+
+    if (m_mediaPath.isEmpty()) {
+        emit mediaStatusChanged(MediaStatus::NoMedia);
+        return;
     }
+    openSession();
 }
 
 /**
@@ -87,7 +1387,46 @@ void MediaPlayer::setMedia(const QString& mediaPath)
  */
 void MediaPlayer::setVideoOutput(QVideoWidget* widget)
 {
-    videoOutput = widget;
+    setVideoSink(widget ? widget->videoSink() : nullptr);
+}
+
+/**
+ * @brief 设置独立的视频帧接收端
+ *
+ * @param sink 视频帧接收端
+ */
+void MediaPlayer::setVideoSink(QVideoSink* sink)
+{
+    m_videoSink = sink;
+}
+
+/**
+ * @brief 启用/关闭 SDL 音频输出
+ *
+ * @param enabled 是否输出到音频设备
+ */
+void MediaPlayer::setAudioOutputEnabled(bool enabled)
+{
+    m_audioOutputEnabled = enabled;
+}
+
+/**
+ * @brief 设置画面是否可见
+ *
+ * 不可见时视频线程不再解码和转换，只按时钟消费压缩包并保留最近关键帧以来的包；
+ * 音频和时钟照常运行。重新可见时重放这些包，下一帧即可显示。
+ *
+ * @param visible 是否可见
+ */
+void MediaPlayer::setVideoVisible(bool visible)
+{
+    if (m_videoVisible == visible) {
+        return;
+    }
+    m_videoVisible = visible;
+    if (m_session) {
+        m_session->videoVisible.store(visible);
+    }
 }
 
 /**
@@ -97,7 +1436,7 @@ void MediaPlayer::setVideoOutput(QVideoWidget* widget)
  */
 qint64 MediaPlayer::duration() const
 {
-    return mediaDuration;
+    return m_durationMs;
 }
 
 /**
@@ -107,7 +1446,10 @@ qint64 MediaPlayer::duration() const
  */
 qint64 MediaPlayer::position() const
 {
-    return currentPosition;
+    if (!m_session) {
+        return m_positionMs;
+    }
+    return qMax<qint64>(m_session->currentTimeUs() / 1000, 0);
 }
 
 /**
@@ -119,6 +1461,86 @@ AuroraPlayer::State::PlayerState MediaPlayer::state() const
     return m_state;
 }
 
+/**
+ * @brief 当前媒体是否包含视频
+ *
+ * @return bool 是否包含视频
+ */
+bool MediaPlayer::hasVideo() const
+{
+    return m_hasVideo;
+}
+
+/**
+ * @brief 获取当前媒体的总码率
+ *
+ * @return qint64 码率（bit/s）
+ */
+qint64 MediaPlayer::bitrate() const
+{
+    return m_bitrate;
+}
+
+/**
+ * @brief 获取当前音量
+ *
+ * @return int 音量（0-100）
+ */
+int MediaPlayer::volume() const
+{
+    return m_volume.load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief 设置每个解码器的线程数
+ *
+ * @param threads 线程数，0 表示自动
+ */
+void MediaPlayer::setDecoderThreads(int threads)
+{
+    m_decoderThreads = qMax(threads, 0);
+}
+
+/**
+ * @brief 设置解复用预读缓存上限
+ *
+ * @param bytes 最大字节数
+ */
+void MediaPlayer::setPacketCacheSize(qint64 bytes)
+{
+    m_packetCacheBytes = qMax<qint64>(bytes, 256 * 1024);
+}
+
+/**
+ * @brief 使用共享的播放时钟
+ *
+ * @param clock 共享时钟，nullptr 表示每次打开媒体时使用独立时钟
+ */
+void MediaPlayer::setSharedClock(std::shared_ptr<MediaClock> clock)
+{
+    m_sharedClock = std::move(clock);
+}
+
+/**
+ * @brief 启用/关闭共享解码
+ *
+ * @param shared 是否共享
+ */
+void MediaPlayer::setSharedDecoding(bool shared)
+{
+    m_sharedDecoding = shared;
+}
+
+/**
+ * @brief 启用/关闭音频流
+ *
+ * @param enabled 是否播放音频流
+ */
+void MediaPlayer::setAudioEnabled(bool enabled)
+{
+    m_audioEnabled = enabled;
+}
+
 /**
  * @brief 播放媒体文件。
  *
@@ -127,23 +1549,24 @@ AuroraPlayer::State::PlayerState MediaPlayer::state() const
 void MediaPlayer::play()
 {
     // 如果没有设置媒体文件，则返回
-    if (m_state == AuroraPlayer::State::PlayerState::Stopped && !formatContext) {
+    if (m_mediaPath.isEmpty() || m_state == AuroraPlayer::State::PlayerState::Playing) {
         return;
     }
 
-    // 如果是暂停状态，则恢复播放
-    if (m_state == AuroraPlayer::State::PlayerState::Paused) {
-        setState(AuroraPlayer::State::PlayerState::Playing);
-        positionTimer->start();
-        return;
+    // 停止或出错后重新打开
+    if (!m_session) {
+        openSession();
     }
 
-    // 如果是停止状态，则开始播放
-    if (m_state == AuroraPlayer::State::PlayerState::Stopped) {
-        setState(AuroraPlayer::State::PlayerState::Playing);
-        positionTimer->start();
-        return;
+    m_session->paused.store(false);
+    const SDL_AudioDeviceID device = m_session->audioDevice.load();
+    if (device != 0) {
+        SDL_PauseAudioDevice(device, 0);
     }
+    m_session->clock->setRunning(true);
+
+    setState(AuroraPlayer::State::PlayerState::Playing);
+    positionTimer->start();
 }
 
 /**
@@ -151,10 +1574,20 @@ void MediaPlayer::play()
  */
 void MediaPlayer::pause()
 {
-    if (m_state == AuroraPlayer::State::PlayerState::Playing) {
-        setState(AuroraPlayer::State::PlayerState::Paused);
-        positionTimer->stop();
+    if (m_state != AuroraPlayer::State::PlayerState::Playing || !m_session) {
+        return;
     }
+
+    m_session->paused.store(true);
+    const SDL_AudioDeviceID device = m_session->audioDevice.load();
+    if (device != 0) {
+        SDL_PauseAudioDevice(device, 1);
+    }
+    m_session->clock->setRunning(false);
+
+    positionTimer->stop();
+    setState(AuroraPlayer::State::PlayerState::Paused);
+    emit positionChanged(position());
 }
 
 /**
@@ -162,12 +1595,13 @@ void MediaPlayer::pause()
  */
 void MediaPlayer::stop()
 {
-    if (m_state != AuroraPlayer::State::PlayerState::Stopped) {
-        setState(AuroraPlayer::State::PlayerState::Stopped);
-        positionTimer->stop();
-        currentPosition = 0;
-        emit positionChanged(0);
+    closeSession();
+    m_positionMs = 0;
+    if (m_videoSink) {
+        m_videoSink->setVideoFrame(QVideoFrame());
     }
+    setState(AuroraPlayer::State::PlayerState::Stopped);
+    emit positionChanged(0);
 }
 
 /**
@@ -177,113 +1611,156 @@ void MediaPlayer::stop()
  */
 void MediaPlayer::setPosition(qint64 position)
 {
-    if (position >= 0 && position <= mediaDuration) {
-        currentPosition = position;
-        emit positionChanged(position);
-    }else {
+    if (position < 0 || (m_durationMs > 0 && position > m_durationMs)) {
         qWarning() << "Invalid position:" << position;
+        return;
     }
+
+    AURORA_TRACE_INSTANT("demux", "seek");
+    m_positionMs = position;
+    if (m_session) {
+        // 由解复用线程执行；连续拖动时只执行最后一次
+        m_session->seekRequestUs.store(position * 1000);
+        m_session->clock->setTimeUs(position * 1000);
+        m_session->wakeIdle();
+    }
+    emit positionChanged(position);
 }
 
 /**
  * @brief 设置音量。
  *
+ * 音量在音频线程转换采样时生效，延迟约为 SDL 队列深度。
+ *
  * @param volume  音量（0-100）。
  */
 void MediaPlayer::setVolume(int volume)
 {
-    // TODO: 实现音量控制
-    Q_UNUSED(volume);
+    m_volume.store(qBound(0, volume, 100), std::memory_order_relaxed);
 }
 
 /**
- * @brief 初始化 FFmpeg。
- *
- * @param mediaPath  媒体文件路径。
- * @return bool  初始化是否成功。
+ * @brief 更新播放位置。
  */
-bool MediaPlayer::initializeFFmpeg(const QString& mediaPath)
+void MediaPlayer::updatePosition()
 {
-    // 检查文件是否存在
-    QFile file(mediaPath);
-    if (!file.exists()) {
-        qWarning() << "File does not exist:" << mediaPath;
-        return false;
+    if (!m_session || !m_session->opened.load()) {
+        return;
     }
 
-    // 打开媒体文件
-    if (avformat_open_input(&formatContext, mediaPath.toLocal8Bit().constData(), nullptr, nullptr) < 0) {
-        qWarning() << "Failed to open media file:" << mediaPath;
-        return false;
-    }
+    AURORA_TRACE_SCOPE("present", "updatePosition");
+    emit positionChanged(position());
 
-    // 获取流信息
-    if (avformat_find_stream_info(formatContext, nullptr) < 0) {
-        qWarning() << "Failed to find stream info:" << mediaPath;
-        return false;
+    // 所有流都已排空且音频已播完：播放完成
+    Session& session = *m_session;
+    const bool videoDone = session.videoStream < 0 || session.videoFinished.load();
+    const bool audioDone = session.audioStream < 0 || (session.audioFinished.load() && session.bufferedAudioUs() == 0);
+    if (session.demuxFinished.load() && videoDone && audioDone) {
+        closeSession();
+        m_positionMs = 0;
+        setState(AuroraPlayer::State::PlayerState::Stopped);
+        emit positionChanged(m_durationMs);
+        emit mediaStatusChanged(MediaStatus::EndOfMedia);
     }
+}
 
-    // 查找视频和音频流
-    videoStreamIndex = av_find_best_stream(formatContext, AVMEDIA_TYPE_VIDEO, -1, -1, nullptr, 0);
-    audioStreamIndex = av_find_best_stream(formatContext, AVMEDIA_TYPE_AUDIO, -1, -1, nullptr, 0);
-
-    // 获取视频流
-    if (videoStreamIndex >= 0) {
-        videoStream = formatContext->streams[videoStreamIndex];
+/**
+ * @brief 为当前媒体创建会话并启动解复用线程
+ */
+void MediaPlayer::openSession()
+{
+    auto session = std::make_unique<Session>();
+    session->path = m_mediaPath;
+    session->id = ++m_sessionId;
+    session->owner = this;
+    session->stats = m_stats;
+    session->metrics = m_metrics;
+    session->decoderThreads = m_sharedDecoding ? 1 : m_decoderThreads;
+    session->scheduler = m_sharedDecoding ? &DecodeScheduler::instance() : nullptr;
+    session->cacheBytes = m_packetCacheBytes;
+    session->audioOutput = m_audioOutputEnabled;
+    session->audioEnabled = m_audioEnabled;
+    session->videoVisible.store(m_videoVisible);
+    session->paused.store(m_state != AuroraPlayer::State::PlayerState::Playing);
+    // 共享时钟由所有者（视频墙）统一设置，重新打开某一路时不拨动其他画面
+    if (m_sharedClock) {
+        session->clock = m_sharedClock;
+    } else {
+        session->clock = std::make_shared<MediaClock>();
+        session->clock->setTimeUs(m_positionMs * 1000);
     }
-
-    // 获取音频流
-    if (audioStreamIndex >= 0) {
-        audioStream = formatContext->streams[audioStreamIndex];
+    if (m_positionMs > 0) {
+        session->seekRequestUs.store(m_positionMs * 1000);
     }
 
-    // 获取媒体时长（毫秒）
-    if (formatContext->duration != AV_NOPTS_VALUE) {
-        mediaDuration = formatContext->duration / 1000;
-    }
+    Session* raw = session.get();
+    session->demuxThread = QThread::create([raw]() { raw->demuxLoop(); });
+    m_session = std::move(session);
+    m_session->demuxThread->start();
 
-    return true;
+    emit mediaStatusChanged(MediaStatus::Loading);
 }
 
 /**
- * @brief 清理 FFmpeg 资源。
+ * @brief 停止会话的所有线程并释放资源
  */
-void MediaPlayer::cleanupFFmpeg()
+void MediaPlayer::closeSession()
 {
-    // 清理视频解码器上下文
-    if (videoCodecContext) {
-        avcodec_free_context(&videoCodecContext);
+    if (!m_session) {
+        return;
     }
 
-    // 清理音频解码器上下文
-    if (audioCodecContext) {
-        avcodec_free_context(&audioCodecContext);
+    AURORA_TRACE_SCOPE("demux", "closeSession");
+    positionTimer->stop();
+    m_session.reset();
+}
+
+/**
+ * @brief 会话已打开
+ */
+void MediaPlayer::onSessionOpened(quint64 sessionId, qint64 durationMs, bool hasVideo, qint64 bitrate)
+{
+    if (!m_session || m_session->id != sessionId) {
+        return;
     }
 
-    // 清理格式上下文
-    if (formatContext) {
-        avformat_close_input(&formatContext);
+    m_durationMs = durationMs;
+    m_hasVideo = hasVideo;
+    m_bitrate = bitrate;
+    positionTimer->setInterval(hasVideo ? kPositionIntervalMs : kAudioOnlyPositionIntervalMs);
+    emit durationChanged(m_durationMs);
+    emit metadataChanged();
+    emit mediaStatusChanged(MediaStatus::Loaded);
+}
+
+/**
+ * @brief 会话打开失败
+ */
+void MediaPlayer::onSessionFailed(quint64 sessionId, const QString& message)
+{
+    if (!m_session || m_session->id != sessionId) {
+        return;
     }
 
-    // 重置流索引
-    videoStreamIndex = -1;
-    audioStreamIndex = -1;
+    qWarning() << "Failed to open media file:" << m_mediaPath << "-" << message;
+    closeSession();
+    setState(AuroraPlayer::State::PlayerState::Error);
+    emit mediaStatusChanged(MediaStatus::Invalid);
+    emit errorOccurred(message);
 }
 
 /**
- * @brief 更新播放位置。
+ * @brief 将视频帧送往视频输出
  */
-void MediaPlayer::updatePosition()
+void MediaPlayer::presentVideoFrame(quint64 sessionId, const QVideoFrame& frame)
 {
-    if (m_state == AuroraPlayer::State::PlayerState::Playing) {
-        currentPosition += 1000; // 每秒增加1秒
-        if (currentPosition >= mediaDuration) {
-            // 播放完成
-            stop();
-        } else {
-            emit positionChanged(currentPosition);
-        }
+    m_framesInFlight.fetch_sub(1);
+    if (!m_session || m_session->id != sessionId || !m_videoSink) {
+        return;
     }
+
+    AURORA_TRACE_SCOPE("present", "setVideoFrame");
+    m_videoSink->setVideoFrame(frame);
 }
 
 /**
@@ -297,4 +1774,4 @@ void MediaPlayer::setState(AuroraPlayer::State::PlayerState state)
         m_state = state;
         emit stateChanged(m_state);
     }
-}
\ No newline at end of file
+}
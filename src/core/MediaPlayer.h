@@ -2,7 +2,9 @@
  * @file   : MediaPlayer.h
  * @brief  : 定义了 MediaPlayer 类。
  *
- * 该文件定义了程序的 MediaPlayer 类，用于处理媒体播放。
+ * 该文件定义了程序的 MediaPlayer 类，即基于 FFmpeg 的播放后端：解复用线程读取
+ * 压缩包并分发到音视频队列，两个解码线程分别解码；音频经 SDL2 输出并作为主时钟，
+ * 视频帧按时钟节奏送往 QVideoWidget 的 videoSink。
  *
  * @author : polarours
  * @date   : 2025/08/29
@@ -11,24 +13,22 @@
 #ifndef AURORAPLAYER_MEDIAPLAYER_H
 #define AURORAPLAYER_MEDIAPLAYER_H
 
-
-#include <QTimer>
+#include <QPointer>
 #include <QString>
 
-#include "CommonState.h"
+#include <atomic>
+#include <memory>
 
-// --- FFmpeg 头文件 --- //
-extern "C" {
-#include <libavformat/avformat.h>
-#include <libavcodec/avcodec.h>
-#include <libswscale/swscale.h>
-}
+#include "PlaybackBackend.h"
 
 // --- 前向声明 --- //
+class MediaClock;
+class QTimer;
+class QVideoFrame;
+class QVideoSink;
 class QVideoWidget;
-class QAudioOutput;
 
-class MediaPlayer : public QObject
+class MediaPlayer : public PlaybackBackend
 {
     Q_OBJECT
 
@@ -41,118 +41,211 @@ public:
     explicit MediaPlayer(QObject* parent = nullptr);
 
     /**
-     * @brief 析构函数
+     * @brief 析构函数，停止所有工作线程并释放 FFmpeg/SDL 资源
+     */
+    ~MediaPlayer() override;
+
+    /**
+     * @brief 获取后端类型
+     *
+     * @return Type 始终为 Type::FFmpeg
      */
-    ~MediaPlayer();
+    Type type() const override;
 
     /**
-     * @brief 设置媒体文件路径
+     * @brief 设置媒体文件路径（在后台线程打开，不自动播放）
      *
      * @param mediaPath  媒体文件路径
      */
-    void setMedia(const QString& mediaPath);
+    void setMedia(const QString& mediaPath) override;
 
     /**
      * @brief 设置视频输出组件
      *
      * @param widget  视频输出组件
      */
-    void setVideoOutput(QVideoWidget* widget);
+    void setVideoOutput(QVideoWidget* widget) override;
+
+    /**
+     * @brief 设置独立的视频帧接收端
+     *
+     * @param sink 视频帧接收端
+     */
+    void setVideoSink(QVideoSink* sink) override;
+
+    /**
+     * @brief 启用/关闭 SDL 音频输出（下次打开媒体时生效）
+     *
+     * @param enabled 是否输出到音频设备
+     */
+    void setAudioOutputEnabled(bool enabled) override;
+
+    /**
+     * @brief 设置画面是否可见（不可见时停止视频解码，音频照常）
+     *
+     * @param visible 是否可见
+     */
+    void setVideoVisible(bool visible) override;
 
     /**
      * @brief 获取媒体文件的总时长
      *
-     * @return qint64  媒体文件的总时长
+     * @return qint64  媒体文件的总时长（毫秒）
      */
-    qint64 duration() const;
+    qint64 duration() const override;
 
     /**
      * @brief 获取媒体文件的当前播放位置
      *
-     * @return qint64  媒体文件的当前播放位置
+     * @return qint64  当前播放位置（毫秒，取自主时钟）
      */
-    qint64 position() const;
+    qint64 position() const override;
 
     /**
      * @brief 获取当前播放状态
      *
      * @return AuroraPlayer::State::PlayerState 当前播放状态
      */
-    AuroraPlayer::State::PlayerState state() const;
+    AuroraPlayer::State::PlayerState state() const override;
 
-public slots:
     /**
-     * @brief 播放媒体文件
+     * @brief 当前媒体是否包含视频（专辑封面不算）
      *
-     * 该函数负责播放媒体文件。
+     * @return bool 是否包含视频
      */
-    void play();
+    bool hasVideo() const override;
 
     /**
-     * @brief 暂停媒体播放
+     * @brief 获取当前媒体的总码率
+     *
+     * @return qint64 码率（bit/s）
      */
-    void pause();
+    qint64 bitrate() const override;
 
     /**
-     * @brief 停止媒体播放
+     * @brief 获取当前音量
+     *
+     * @return int 音量（0-100）
      */
-    void stop();
+    int volume() const override;
 
     /**
-     * @brief 设置媒体播放位置
+     * @brief 设置每个解码器的线程数（下次打开媒体时生效）
      *
-     * @param position  播放位置（毫秒）
+     * @param threads 线程数，0 表示由 FFmpeg 按核心数决定
      */
-    void setPosition(qint64 position);
+    void setDecoderThreads(int threads);
 
     /**
-     * @brief 设置音量
+     * @brief 设置解复用预读缓存上限（下次打开媒体时生效）
      *
-     * @param volume  音量（0-100）
+     * @param bytes 音视频队列合计的最大字节数
      */
-    void setVolume(int volume);
+    void setPacketCacheSize(qint64 bytes);
 
-signals:
     /**
-     * @brief 媒体文件的播放状态改变信号
+     * @brief 使用共享的播放时钟（下次打开媒体时生效）
      *
-     * @param state  媒体文件的播放状态
+     * 多个播放器共享同一时钟时按同一时间轴显示；时钟的起点由共享者设置，
+     * 跳转、播放和暂停会作用于所有共享者。
+     *
+     * @param clock 共享时钟，nullptr 表示使用独立时钟
+     */
+    void setSharedClock(std::shared_ptr<MediaClock> clock);
+
+    /**
+     * @brief 启用/关闭共享解码（下次打开媒体时生效）
+     *
+     * 启用后每个解码器只用一个线程，解码步骤由进程内的 DecodeScheduler 限制
+     * 并发，适合同时播放多路媒体。
+     *
+     * @param shared 是否共享
      */
-    void stateChanged(AuroraPlayer::State::PlayerState state);
+    void setSharedDecoding(bool shared);
 
     /**
-     * @brief 媒体文件的播放位置改变信号
+     * @brief 启用/关闭音频流（下次打开媒体时生效）
      *
-     * @param duration  媒体文件的总时长
+     * 关闭时音频流的包直接丢弃，不解码也不占用音频设备（视频墙中只有一路出声）。
+     *
+     * @param enabled 是否播放音频流
+     */
+    void setAudioEnabled(bool enabled);
+
+public slots:
+    /**
+     * @brief 开始或恢复播放（停止后会重新打开当前媒体）
      */
-    void durationChanged(qint64 duration);
+    void play() override;
 
     /**
-     * @brief 媒体文件的播放位置改变信号
+     * @brief 暂停媒体播放
+     */
+    void pause() override;
+
+    /**
+     * @brief 停止媒体播放，关闭解码线程
+     */
+    void stop() override;
+
+    /**
+     * @brief 设置媒体播放位置
      *
      * @param position  播放位置（毫秒）
      */
-    void positionChanged(qint64 position);
+    void setPosition(qint64 position) override;
+
+    /**
+     * @brief 设置音量
+     *
+     * @param volume  音量（0-100）
+     */
+    void setVolume(int volume) override;
 
 private slots:
     /**
-     * @brief 更新播放位置
+     * @brief 播放中定时发布位置并检测播放结束
      */
     void updatePosition();
 
 private:
+    struct Session;
+
+    /**
+     * @brief 为当前媒体创建会话并启动解复用线程
+     */
+    void openSession();
+
     /**
-     * @brief 初始化 FFmpeg
+     * @brief 停止会话的所有线程并释放资源
+     */
+    void closeSession();
+
+    /**
+     * @brief 会话已打开（在界面线程调用）
      *
-     * @param mediaPath  媒体文件路径
-     * @return bool  初始化是否成功
+     * @param sessionId  会话编号，过期的通知被忽略
+     * @param durationMs 媒体时长（毫秒）
+     * @param hasVideo   是否包含视频
+     * @param bitrate    码率（bit/s）
      */
-    bool initializeFFmpeg(const QString& mediaPath);
+    void onSessionOpened(quint64 sessionId, qint64 durationMs, bool hasVideo, qint64 bitrate);
 
     /**
-     * @brief 清理 FFmpeg 资源
+     * @brief 会话打开失败（在界面线程调用）
+     *
+     * @param sessionId 会话编号
+     * @param message   错误描述
+     */
+    void onSessionFailed(quint64 sessionId, const QString& message);
+
+    /**
+     * @brief 将视频帧送往视频输出（在界面线程调用）
+     *
+     * @param sessionId 会话编号，过期会话的帧被丢弃
+     * @param frame     视频帧
      */
-    void cleanupFFmpeg();
+    void presentVideoFrame(quint64 sessionId, const QVideoFrame& frame);
 
     /**
      * @brief 设置播放状态
@@ -164,24 +257,34 @@ private:
 private:
     // --- 播放状态 --- //
     AuroraPlayer::State::PlayerState m_state; ///< 当前播放状态
+    QString m_mediaPath;                      ///< 当前媒体文件路径
 
     // --- 播放位置参数 --- //
-    qint64 currentPosition; ///< 当前播放位置
-    qint64 mediaDuration;   ///< 媒体总时长
+    qint64 m_positionMs;    ///< 没有会话时的播放位置（下次打开时从这里开始）
+    qint64 m_durationMs;    ///< 媒体总时长
     QTimer* positionTimer;  ///< 播放位置定时器
 
-    // --- 播放参数 --- //
-    int videoStreamIndex; ///< 视频流索引
-    int audioStreamIndex; ///< 音频流索引
-
-    // --- FFmpeg 相关变量 --- //
-    AVStream* videoStream;             ///< 视频流
-    AVStream* audioStream;             ///< 音频流
-    AVFormatContext* formatContext;    ///< 格式上下文
-    AVCodecContext* videoCodecContext; ///< 视频解码器上下文
-    AVCodecContext* audioCodecContext; ///< 音频解码器上下文
-    QVideoWidget* videoOutput;         ///< 视频输出组件
-    QAudioOutput* audioOutput;         ///< 音频输出组件
+    // --- 媒体信息 --- //
+    bool m_hasVideo;  ///< 是否包含视频
+    qint64 m_bitrate; ///< 码率
+
+    // --- 输出 --- //
+    QPointer<QVideoSink> m_videoSink;      ///< 视频帧接收端
+    bool m_audioOutputEnabled;             ///< 是否输出到音频设备
+    std::atomic<int> m_volume;             ///< 音量（音频线程读取）
+    std::atomic<int> m_framesInFlight;     ///< 已投递到界面线程但尚未显示的视频帧数
+
+    // --- 引擎参数 --- //
+    int m_decoderThreads;      ///< 每个解码器的线程数
+    qint64 m_packetCacheBytes; ///< 解复用预读缓存上限
+    std::shared_ptr<MediaClock> m_sharedClock; ///< 共享时钟，nullptr 表示独立时钟
+    bool m_sharedDecoding;     ///< 是否使用共享解码调度
+    bool m_audioEnabled;       ///< 是否播放音频流
+    bool m_videoVisible;       ///< 画面是否可见
+
+    // --- 会话 --- //
+    std::unique_ptr<Session> m_session; ///< 当前打开的媒体会话
+    quint64 m_sessionId;                ///< 会话编号（每次打开递增）
 };
 
-#endif // AURORAPLAYER_MEDIAPLAYER_H
\ No newline at end of file
+#endif // AURORAPLAYER_MEDIAPLAYER_H
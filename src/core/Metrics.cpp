@@ -0,0 +1,202 @@
+/********************************************************************************
+ * @file   : Metrics.cpp
+ * @brief  : 实现了播放指标的无锁直方图和快照类型。
+ *
+ * @author : polarours
+ * @date   : 2026/10/18
+ ********************************************************************************/
+
+#include "Metrics.h"
+
+#include <QDateTime>
+#include <QtAlgorithms>
+
+#include <chrono>
+
+/**
+ * @brief 序列化为 JSON
+ *
+ * @return QJsonObject JSON 对象
+ */
+QJsonObject HistogramSummary::toJson() const
+{
+    QJsonObject object;
+    object["count"] = static_cast<qint64>(count);
+    object["mean_us"] = mean;
+    object["p50_us"] = p50;
+    object["p90_us"] = p90;
+    object["p99_us"] = p99;
+    object["max_us"] = max;
+    return object;
+}
+
+/**
+ * @brief 记录一个样本
+ *
+ * @param valueUs 样本值（微秒）
+ */
+void LatencyHistogram::record(qint64 valueUs)
+{
+    if (valueUs < 0) {
+        valueUs = 0;
+    }
+
+    m_buckets[bucketFor(valueUs)].fetch_add(1, std::memory_order_relaxed);
+    m_sum.fetch_add(valueUs, std::memory_order_relaxed);
+
+    qint64 currentMax = m_max.load(std::memory_order_relaxed);
+    while (valueUs > currentMax
+           && !m_max.compare_exchange_weak(currentMax, valueUs, std::memory_order_relaxed)) {
+    }
+}
+
+/**
+ * @brief 计算统计摘要
+ *
+ * 各桶分别读取，与并发写入之间不保证严格一致，对统计用途足够。
+ *
+ * @return HistogramSummary 摘要
+ */
+HistogramSummary LatencyHistogram::summary() const
+{
+    HistogramSummary result;
+
+    std::array<quint64, kBucketCount> counts;
+    quint64 total = 0;
+    for (int i = 0; i < kBucketCount; ++i) {
+        counts[i] = m_buckets[i].load(std::memory_order_relaxed);
+        total += counts[i];
+    }
+
+    result.count = total;
+    result.max = m_max.load(std::memory_order_relaxed);
+    if (total == 0) {
+        return result;
+    }
+    result.mean = m_sum.load(std::memory_order_relaxed) / static_cast<qint64>(total);
+
+    // 分位数取所在桶的中点，并用最大值截断
+    auto percentile = [&](double fraction) -> qint64 {
+        const quint64 rank = static_cast<quint64>(fraction * total + 0.5);
+        quint64 seen = 0;
+        for (int i = 0; i < kBucketCount; ++i) {
+            seen += counts[i];
+            if (seen >= rank && counts[i] > 0) {
+                const qint64 lower = bucketLowerBound(i);
+                const qint64 upper = i + 1 < kBucketCount ? bucketLowerBound(i + 1) : result.max + 1;
+                return qMin((lower + upper - 1) / 2, result.max);
+            }
+        }
+        return result.max;
+    };
+
+    result.p50 = percentile(0.50);
+    result.p90 = percentile(0.90);
+    result.p99 = percentile(0.99);
+    return result;
+}
+
+/**
+ * @brief 清空直方图
+ */
+void LatencyHistogram::reset()
+{
+    for (auto& bucket : m_buckets) {
+        bucket.store(0, std::memory_order_relaxed);
+    }
+    m_sum.store(0, std::memory_order_relaxed);
+    m_max.store(0, std::memory_order_relaxed);
+}
+
+/**
+ * @brief 计算样本所属的桶
+ *
+ * 0-3 各占一个桶；此后每个 [2^e, 2^(e+1)) 区间分为 4 个等宽子桶。
+ */
+int LatencyHistogram::bucketFor(qint64 valueUs)
+{
+    if (valueUs < 4) {
+        return static_cast<int>(valueUs);
+    }
+
+    const int exponent = 63 - qCountLeadingZeroBits(static_cast<quint64>(valueUs));
+    if (exponent > kMaxExponent) {
+        return kBucketCount - 1;
+    }
+
+    const int sub = static_cast<int>((valueUs >> (exponent - 2)) & 3);
+    return 4 + (exponent - 2) * 4 + sub;
+}
+
+/**
+ * @brief 计算桶的下界
+ */
+qint64 LatencyHistogram::bucketLowerBound(int bucket)
+{
+    if (bucket < 4) {
+        return bucket;
+    }
+
+    const int exponent = (bucket - 4) / 4 + 2;
+    const int sub = (bucket - 4) % 4;
+    return static_cast<qint64>(4 + sub) << (exponent - 2);
+}
+
+/**
+ * @brief 序列化为 JSON
+ *
+ * @return QJsonObject JSON 对象
+ */
+QJsonObject MetricsSnapshot::toJson() const
+{
+    QJsonObject playbackObject;
+    playbackObject["frames_decoded"] = static_cast<qint64>(playback.framesDecoded);
+    playbackObject["frames_presented"] = static_cast<qint64>(playback.framesPresented);
+    playbackObject["frames_dropped"] = static_cast<qint64>(playback.framesDropped);
+    playbackObject["frames_late"] = static_cast<qint64>(playback.framesLate);
+    playbackObject["video_queue_depth"] = playback.videoQueueDepth;
+    playbackObject["audio_queue_ms"] = playback.audioQueueDepth;
+    playbackObject["av_drift_ms"] = playback.avDriftMs;
+    playbackObject["decoder_threads"] = playback.decoderThreads;
+    playbackObject["bitrate"] = playback.bitrate;
+
+    QJsonObject object;
+    object["timestamp_ms"] = timestampMs;
+    object["frame_decode_time"] = frameDecodeTime.toJson();
+    object["present_jitter"] = presentJitter.toJson();
+    object["seek_latency"] = seekLatency.toJson();
+    object["open_latency"] = openLatency.toJson();
+    object["buffer_underruns"] = static_cast<qint64>(bufferUnderruns);
+    object["playback"] = playbackObject;
+    return object;
+}
+
+/**
+ * @brief 生成快照
+ *
+ * @param playback 同时附带的播放统计计数器
+ * @return MetricsSnapshot 快照
+ */
+MetricsSnapshot PlayerMetrics::snapshot(const PlaybackStats& playback) const
+{
+    MetricsSnapshot result;
+    result.timestampMs = QDateTime::currentMSecsSinceEpoch();
+    result.frameDecodeTime = frameDecodeTime.summary();
+    result.presentJitter = presentJitter.summary();
+    result.seekLatency = seekLatency.summary();
+    result.openLatency = openLatency.summary();
+    result.bufferUnderruns = bufferUnderruns.load(std::memory_order_relaxed);
+    result.playback = playback.snapshot();
+    return result;
+}
+
+/**
+ * @brief 获取单调时钟（微秒）
+ *
+ * @return qint64 时间戳
+ */
+qint64 PlayerMetrics::nowUs()
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+               std::chrono::steady_clock::now().time_since_epoch()).count();
+}
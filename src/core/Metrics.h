@@ -0,0 +1,143 @@
+/********************************************************************************
+ * @file   : Metrics.h
+ * @brief  : 声明了播放指标的无锁直方图和快照类型。
+ *
+ * 该文件声明了 LatencyHistogram（对数分桶的原子直方图）、PlayerMetrics
+ * （播放引擎写入的指标集合）以及可序列化的 MetricsSnapshot。
+ *
+ * @author : polarours
+ * @date   : 2026/10/18
+ ********************************************************************************/
+
+#ifndef AURORAPLAYER_METRICS_H
+#define AURORAPLAYER_METRICS_H
+
+#include <QJsonObject>
+#include <QtGlobal>
+
+#include <array>
+#include <atomic>
+
+#include "PlaybackStats.h"
+
+/**
+ * @struct HistogramSummary
+ * @brief 直方图统计摘要（单位：微秒）
+ */
+struct HistogramSummary
+{
+    quint64 count = 0; ///< 样本数
+    qint64 mean = 0;   ///< 平均值
+    qint64 p50 = 0;    ///< 50 分位
+    qint64 p90 = 0;    ///< 90 分位
+    qint64 p99 = 0;    ///< 99 分位
+    qint64 max = 0;    ///< 最大值
+
+    /**
+     * @brief 序列化为 JSON
+     *
+     * @return QJsonObject JSON 对象
+     */
+    QJsonObject toJson() const;
+};
+
+/**
+ * @class LatencyHistogram
+ * @brief 无锁延迟直方图
+ *
+ * 每个 2 的幂区间再分为 4 个子桶（相对误差不超过 25%），记录只需一次
+ * relaxed 原子加，可在任意线程并发调用。
+ */
+class LatencyHistogram
+{
+public:
+    static constexpr int kMaxExponent = 40;                           ///< 最大指数（约 25 天）
+    static constexpr int kBucketCount = 4 + (kMaxExponent - 2) * 4 + 4; ///< 桶数量
+
+    /**
+     * @brief 记录一个样本
+     *
+     * @param valueUs 样本值（微秒）
+     */
+    void record(qint64 valueUs);
+
+    /**
+     * @brief 计算统计摘要
+     *
+     * @return HistogramSummary 摘要
+     */
+    HistogramSummary summary() const;
+
+    /**
+     * @brief 清空直方图
+     */
+    void reset();
+
+private:
+    /**
+     * @brief 计算样本所属的桶
+     */
+    static int bucketFor(qint64 valueUs);
+
+    /**
+     * @brief 计算桶的下界
+     */
+    static qint64 bucketLowerBound(int bucket);
+
+private:
+    std::array<std::atomic<quint64>, kBucketCount> m_buckets{}; ///< 各桶计数
+    std::atomic<qint64> m_sum{0};                               ///< 样本总和
+    std::atomic<qint64> m_max{0};                               ///< 最大样本
+};
+
+/**
+ * @struct MetricsSnapshot
+ * @brief 播放指标快照
+ */
+struct MetricsSnapshot
+{
+    qint64 timestampMs = 0;             ///< 快照时间（Unix 毫秒）
+    HistogramSummary frameDecodeTime;   ///< 单帧解码耗时
+    HistogramSummary presentJitter;     ///< 显示间隔抖动
+    HistogramSummary seekLatency;       ///< 跳转延迟
+    HistogramSummary openLatency;       ///< 打开媒体延迟
+    quint64 bufferUnderruns = 0;        ///< 缓冲欠载次数
+    PlaybackStats::Snapshot playback;   ///< 播放统计计数器
+
+    /**
+     * @brief 序列化为 JSON
+     *
+     * @return QJsonObject JSON 对象
+     */
+    QJsonObject toJson() const;
+};
+
+/**
+ * @struct PlayerMetrics
+ * @brief 播放引擎写入的指标集合
+ */
+struct PlayerMetrics
+{
+    LatencyHistogram frameDecodeTime; ///< 单帧解码耗时
+    LatencyHistogram presentJitter;   ///< 显示间隔抖动
+    LatencyHistogram seekLatency;     ///< 跳转延迟
+    LatencyHistogram openLatency;     ///< 打开媒体延迟
+    std::atomic<quint64> bufferUnderruns{0}; ///< 缓冲欠载次数
+
+    /**
+     * @brief 生成快照
+     *
+     * @param playback 同时附带的播放统计计数器
+     * @return MetricsSnapshot 快照
+     */
+    MetricsSnapshot snapshot(const PlaybackStats& playback) const;
+
+    /**
+     * @brief 获取单调时钟（微秒），用于计算各类延迟
+     *
+     * @return qint64 时间戳
+     */
+    static qint64 nowUs();
+};
+
+#endif // AURORAPLAYER_METRICS_H
@@ -0,0 +1,166 @@
+/********************************************************************************
+ * @file   : PacketQueue.cpp
+ * @brief  : 实现了 PacketQueue 类。
+ *
+ * @author : polarours
+ * @date   : 2026/10/18
+ ********************************************************************************/
+
+#include "PacketQueue.h"
+
+#include <QMutexLocker>
+
+extern "C" {
+#include <libavcodec/avcodec.h>
+}
+
+/**
+ * @brief 构造函数
+ */
+PacketQueue::PacketQueue()
+    : m_packets(0)
+    , m_bytes(0)
+    , m_durationUs(0)
+    , m_aborted(false)
+{
+}
+
+/**
+ * @brief 析构函数
+ */
+PacketQueue::~PacketQueue()
+{
+    clear();
+}
+
+/**
+ * @brief 放入压缩包
+ *
+ * @param packet     压缩包，调用后被清空
+ * @param durationUs 压缩包时长（微秒）
+ */
+void PacketQueue::put(AVPacket* packet, qint64 durationUs)
+{
+    Item item;
+    item.kind = Kind::Packet;
+    item.packet = av_packet_alloc();
+    item.durationUs = qMax<qint64>(durationUs, 0);
+    av_packet_move_ref(item.packet, packet);
+
+    QMutexLocker locker(&m_mutex);
+    if (m_aborted) {
+        release(item);
+        return;
+    }
+    m_packets += 1;
+    m_bytes += item.packet->size;
+    m_durationUs += item.durationUs;
+    m_items.push_back(item);
+    m_notEmpty.wakeOne();
+}
+
+/**
+ * @brief 放入标记条目
+ *
+ * @param kind Flush 或 EndOfStream
+ */
+void PacketQueue::putMarker(Kind kind)
+{
+    Item item;
+    item.kind = kind;
+
+    QMutexLocker locker(&m_mutex);
+    if (m_aborted) {
+        return;
+    }
+    m_items.push_back(item);
+    m_notEmpty.wakeOne();
+}
+
+/**
+ * @brief 取出一个条目，队列为空时阻塞
+ *
+ * @param item 输出：条目
+ * @return bool 是否取到条目
+ */
+bool PacketQueue::get(Item* item)
+{
+    QMutexLocker locker(&m_mutex);
+    while (m_items.empty() && !m_aborted) {
+        m_notEmpty.wait(&m_mutex);
+    }
+    if (m_aborted) {
+        return false;
+    }
+
+    *item = m_items.front();
+    m_items.pop_front();
+    if (item->kind == Kind::Packet) {
+        m_packets -= 1;
+        m_bytes -= item->packet->size;
+        m_durationUs -= item->durationUs;
+    }
+    return true;
+}
+
+/**
+ * @brief 丢弃队列中所有条目
+ */
+void PacketQueue::clear()
+{
+    QMutexLocker locker(&m_mutex);
+    for (Item& item : m_items) {
+        release(item);
+    }
+    m_items.clear();
+    m_packets = 0;
+    m_bytes = 0;
+    m_durationUs = 0;
+}
+
+/**
+ * @brief 中止队列，唤醒所有等待者
+ */
+void PacketQueue::abort()
+{
+    QMutexLocker locker(&m_mutex);
+    m_aborted = true;
+    m_notEmpty.wakeAll();
+}
+
+/**
+ * @brief 获取队列中的压缩包数量
+ */
+int PacketQueue::count() const
+{
+    QMutexLocker locker(&m_mutex);
+    return m_packets;
+}
+
+/**
+ * @brief 获取队列中压缩包的总字节数
+ */
+qint64 PacketQueue::bytes() const
+{
+    QMutexLocker locker(&m_mutex);
+    return m_bytes;
+}
+
+/**
+ * @brief 获取队列中压缩包的总时长（微秒）
+ */
+qint64 PacketQueue::durationUs() const
+{
+    QMutexLocker locker(&m_mutex);
+    return m_durationUs;
+}
+
+/**
+ * @brief 释放条目持有的压缩包
+ */
+void PacketQueue::release(Item& item)
+{
+    if (item.packet) {
+        av_packet_free(&item.packet);
+    }
+}
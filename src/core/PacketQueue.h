@@ -0,0 +1,123 @@
+/********************************************************************************
+ * @file   : PacketQueue.h
+ * @brief  : 声明了 PacketQueue 类。
+ *
+ * 该文件声明了解复用线程与解码线程之间的压缩包队列。队列按字节数和时长统计
+ * 缓存量，供解复用线程决定何时暂停读取；跳转时由解复用线程清空并插入 Flush
+ * 标记，解码线程据此重置解码器。
+ *
+ * @author : polarours
+ * @date   : 2026/10/18
+ ********************************************************************************/
+
+#ifndef AURORAPLAYER_PACKETQUEUE_H
+#define AURORAPLAYER_PACKETQUEUE_H
+
+#include <QMutex>
+#include <QWaitCondition>
+#include <QtGlobal>
+
+#include <deque>
+
+// --- FFmpeg 前向声明 --- //
+struct AVPacket;
+
+class PacketQueue
+{
+public:
+    /**
+     * @brief 队列条目类型
+     */
+    enum class Kind {
+        Packet,     ///< 压缩包
+        Flush,      ///< 跳转后重置解码器
+        EndOfStream ///< 输入结束，排空解码器
+    };
+
+    /**
+     * @brief 队列条目
+     */
+    struct Item {
+        Kind kind = Kind::Packet;   ///< 条目类型
+        AVPacket* packet = nullptr; ///< 压缩包（仅 Packet 有效，由取出方释放）
+        qint64 durationUs = 0;      ///< 压缩包时长（微秒）
+    };
+
+    /**
+     * @brief 构造函数
+     */
+    PacketQueue();
+
+    /**
+     * @brief 析构函数，释放仍在队列中的压缩包
+     */
+    ~PacketQueue();
+
+    PacketQueue(const PacketQueue&) = delete;
+    PacketQueue& operator=(const PacketQueue&) = delete;
+
+    /**
+     * @brief 放入压缩包（转移引用，不阻塞）
+     *
+     * @param packet     压缩包，调用后被清空
+     * @param durationUs 压缩包时长（微秒）
+     */
+    void put(AVPacket* packet, qint64 durationUs);
+
+    /**
+     * @brief 放入标记条目
+     *
+     * @param kind Flush 或 EndOfStream
+     */
+    void putMarker(Kind kind);
+
+    /**
+     * @brief 取出一个条目，队列为空时阻塞
+     *
+     * @param item 输出：条目
+     * @return bool 是否取到条目（队列被中止时返回 false）
+     */
+    bool get(Item* item);
+
+    /**
+     * @brief 丢弃队列中所有条目
+     */
+    void clear();
+
+    /**
+     * @brief 中止队列，唤醒所有等待者
+     */
+    void abort();
+
+    /**
+     * @brief 获取队列中的压缩包数量
+     */
+    int count() const;
+
+    /**
+     * @brief 获取队列中压缩包的总字节数
+     */
+    qint64 bytes() const;
+
+    /**
+     * @brief 获取队列中压缩包的总时长（微秒）
+     */
+    qint64 durationUs() const;
+
+private:
+    /**
+     * @brief 释放条目持有的压缩包
+     */
+    static void release(Item& item);
+
+private:
+    mutable QMutex m_mutex;      ///< 保护以下成员
+    QWaitCondition m_notEmpty;   ///< 队列非空
+    std::deque<Item> m_items;    ///< 条目
+    int m_packets;               ///< 压缩包数量
+    qint64 m_bytes;              ///< 压缩包总字节数
+    qint64 m_durationUs;         ///< 压缩包总时长
+    bool m_aborted;              ///< 是否已中止
+};
+
+#endif // AURORAPLAYER_PACKETQUEUE_H
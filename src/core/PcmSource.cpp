@@ -0,0 +1,465 @@
+/********************************************************************************
+ * @file   : PcmSource.cpp
+ * @brief  : 实现了 PcmSource 类。
+ *
+ * @author : polarours
+ * @date   : 2026/10/18
+ ********************************************************************************/
+
+#include "PcmSource.h"
+
+#include <QFile>
+#include <QtEndian>
+
+#include <cmath>
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define AURORAPLAYER_PCM_SSE2 1
+#include <emmintrin.h>
+#endif
+
+namespace {
+
+    constexpr qint64 kMinHeaderBytes = 12;       ///< RIFF/FORM 文件头的最小长度
+    constexpr quint16 kWaveFormatPcm = 0x0001;   ///< WAVE_FORMAT_PCM
+    constexpr quint16 kWaveFormatFloat = 0x0003; ///< WAVE_FORMAT_IEEE_FLOAT
+    constexpr quint16 kWaveFormatExtensible = 0xFFFE; ///< WAVE_FORMAT_EXTENSIBLE，真实格式在子格式 GUID 中
+    constexpr quint32 kFmtChunkMinBytes = 16;    ///< fmt 块的最小长度
+    constexpr quint32 kFmtExtensibleBytes = 40;  ///< WAVE_FORMAT_EXTENSIBLE 的 fmt 块长度
+    constexpr quint32 kCommChunkMinBytes = 18;   ///< AIFF COMM 块的最小长度
+    constexpr quint32 kCommAifcBytes = 22;       ///< AIFC COMM 块含压缩类型时的最小长度
+    constexpr quint32 kSsndHeaderBytes = 8;      ///< SSND 块的 offset/blockSize 字段
+
+    /**
+     * @brief 比较四字符标识
+     */
+    bool isTag(const uchar* data, const char* tag)
+    {
+        return std::memcmp(data, tag, 4) == 0;
+    }
+
+    /**
+     * @brief 读取 80 位大端扩展精度浮点数（AIFF 的采样率字段）
+     */
+    double readExtended(const uchar* data)
+    {
+        const int exponent = ((data[0] & 0x7f) << 8) | data[1];
+        const quint64 mantissa = qFromBigEndian<quint64>(data + 2);
+        if (exponent == 0 && mantissa == 0) {
+            return 0.0;
+        }
+        const double value = std::ldexp(static_cast<double>(mantissa), exponent - 16383 - 63);
+        return (data[0] & 0x80) ? -value : value;
+    }
+
+    /**
+     * @brief 读取一个采样并归一化为 [-1, 1]
+     *
+     * @param data   采样地址
+     * @param format 采样格式
+     */
+    float readSample(const uchar* data, const PcmSource::Format& format)
+    {
+        const bool big = format.bigEndian;
+        switch (format.bytesPerSample) {
+            case 1:
+                return format.encoding == PcmSource::Encoding::Unsigned
+                    ? (static_cast<int>(*data) - 128) / 128.0f
+                    : static_cast<qint8>(*data) / 128.0f;
+            case 2:
+                return (big ? qFromBigEndian<qint16>(data) : qFromLittleEndian<qint16>(data)) / 32768.0f;
+            case 3: {
+                // 24 位采样放到 32 位的高 24 位，符号位随之就位
+                const quint32 bits = big
+                    ? (quint32(data[0]) << 24) | (quint32(data[1]) << 16) | (quint32(data[2]) << 8)
+                    : (quint32(data[2]) << 24) | (quint32(data[1]) << 16) | (quint32(data[0]) << 8);
+                return static_cast<float>(static_cast<qint32>(bits) / 2147483648.0);
+            }
+            case 4: {
+                const quint32 bits = big ? qFromBigEndian<quint32>(data) : qFromLittleEndian<quint32>(data);
+                if (format.encoding == PcmSource::Encoding::Float) {
+                    float value;
+                    std::memcpy(&value, &bits, sizeof(value));
+                    return value;
+                }
+                return static_cast<float>(static_cast<qint32>(bits) / 2147483648.0);
+            }
+            case 8: {
+                const quint64 bits = big ? qFromBigEndian<quint64>(data) : qFromLittleEndian<quint64>(data);
+                if (format.encoding == PcmSource::Encoding::Float) {
+                    double value;
+                    std::memcpy(&value, &bits, sizeof(value));
+                    return static_cast<float>(value);
+                }
+                return static_cast<float>(static_cast<qint64>(bits) / 9223372036854775808.0);
+            }
+            default:
+                return 0.0f;
+        }
+    }
+
+    /**
+     * @brief 将连续的采样转换为 float 并乘以增益（输入输出声道一致时整段转换）
+     *
+     * 常见的 16 位（含 AIFF 大端）、32 位整数和 32 位浮点在 SSE2 下每次转换 4~8 个
+     * 采样，其余格式和尾部逐个转换。
+     *
+     * @param in      采样数据
+     * @param samples 采样数（帧数 × 声道数）
+     * @param format  采样格式
+     * @param gain    增益
+     * @param out     输出
+     */
+    void convertBlock(const uchar* in, qint64 samples, const PcmSource::Format& format, float gain, float* out)
+    {
+        qint64 i = 0;
+#ifdef AURORAPLAYER_PCM_SSE2
+        const bool integer = format.encoding == PcmSource::Encoding::Signed;
+        if (format.bytesPerSample == 2 && integer) {
+            const __m128 scale = _mm_set1_ps(gain / 32768.0f);
+            for (; i + 8 <= samples; i += 8) {
+                __m128i words = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i * 2));
+                if (format.bigEndian) {
+                    words = _mm_or_si128(_mm_slli_epi16(words, 8), _mm_srli_epi16(words, 8));
+                }
+                // 每个 16 位采样复制到 32 位的高半部分，再算术右移完成符号扩展
+                const __m128i low = _mm_srai_epi32(_mm_unpacklo_epi16(words, words), 16);
+                const __m128i high = _mm_srai_epi32(_mm_unpackhi_epi16(words, words), 16);
+                _mm_storeu_ps(out + i, _mm_mul_ps(_mm_cvtepi32_ps(low), scale));
+                _mm_storeu_ps(out + i + 4, _mm_mul_ps(_mm_cvtepi32_ps(high), scale));
+            }
+        } else if (format.bytesPerSample == 4 && !format.bigEndian) {
+            if (integer) {
+                const __m128 scale = _mm_set1_ps(gain / 2147483648.0f);
+                for (; i + 4 <= samples; i += 4) {
+                    const __m128i words = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i * 4));
+                    _mm_storeu_ps(out + i, _mm_mul_ps(_mm_cvtepi32_ps(words), scale));
+                }
+            } else if (format.encoding == PcmSource::Encoding::Float) {
+                const __m128 scale = _mm_set1_ps(gain);
+                for (; i + 4 <= samples; i += 4) {
+                    const __m128 values = _mm_loadu_ps(reinterpret_cast<const float*>(in + i * 4));
+                    _mm_storeu_ps(out + i, _mm_mul_ps(values, scale));
+                }
+            }
+        }
+#endif
+        const int bytesPerSample = format.bytesPerSample;
+        for (; i < samples; ++i) {
+            out[i] = readSample(in + i * bytesPerSample, format) * gain;
+        }
+    }
+
+} // namespace
+
+/**
+ * @brief 构造函数
+ */
+PcmSource::PcmSource()
+    : m_mapped(nullptr)
+    , m_data(nullptr)
+    , m_dataOffset(0)
+    , m_dataSize(0)
+    , m_frameBytes(0)
+    , m_frameCount(0)
+{
+}
+
+/**
+ * @brief 析构函数
+ */
+PcmSource::~PcmSource()
+{
+    close();
+}
+
+/**
+ * @brief 解析 WAV/AIFF 文件头并映射采样数据
+ *
+ * 整个文件只映射一次，文件头在映射上解析；采样数据按需由系统换页读入。
+ *
+ * @param path 本地文件路径
+ * @return bool 是否为支持的未压缩 PCM 文件且映射成功
+ */
+bool PcmSource::open(const QString& path)
+{
+    close();
+
+    auto file = std::make_unique<QFile>(path);
+    if (!file->open(QIODevice::ReadOnly)) {
+        return false;
+    }
+
+    const qint64 size = file->size();
+    if (size < kMinHeaderBytes) {
+        return false;
+    }
+
+    uchar* mapped = file->map(0, size);
+    if (!mapped) {
+        return false;
+    }
+
+    m_format = Format();
+    m_frameCount = -1;
+    bool parsed = false;
+    if (isTag(mapped, "RIFF") && isTag(mapped + 8, "WAVE")) {
+        parsed = parseWave(mapped, size);
+    } else if (isTag(mapped, "FORM") && (isTag(mapped + 8, "AIFF") || isTag(mapped + 8, "AIFC"))) {
+        parsed = parseAiff(mapped, size);
+    }
+
+    const int bytes = m_format.bytesPerSample;
+    const bool supportedWidth = bytes == 1 || bytes == 2 || bytes == 3 || bytes == 4 || bytes == 8;
+    const bool supportedFloat = m_format.encoding != Encoding::Float || bytes == 4 || bytes == 8;
+    const bool supportedUnsigned = m_format.encoding != Encoding::Unsigned || bytes == 1;
+    if (!parsed || m_format.sampleRate <= 0 || m_format.channels <= 0
+        || !supportedWidth || !supportedFloat || !supportedUnsigned) {
+        file->unmap(mapped);
+        m_format = Format();
+        m_frameCount = 0;
+        return false;
+    }
+
+    // 边录边写的文件可能没有回填长度，以文件中实际存在的完整帧为准
+    m_frameBytes = bytes * m_format.channels;
+    const qint64 available = m_dataSize / m_frameBytes;
+    m_frameCount = m_frameCount < 0 ? available : qMin(m_frameCount, available);
+    if (m_frameCount <= 0) {
+        file->unmap(mapped);
+        m_format = Format();
+        m_frameCount = 0;
+        return false;
+    }
+
+    m_file = std::move(file);
+    m_mapped = mapped;
+    m_data = mapped + m_dataOffset;
+    return true;
+}
+
+/**
+ * @brief 解除映射并关闭文件
+ */
+void PcmSource::close()
+{
+    if (m_file && m_mapped) {
+        m_file->unmap(m_mapped);
+    }
+    m_file.reset();
+    m_mapped = nullptr;
+    m_data = nullptr;
+    m_dataOffset = 0;
+    m_dataSize = 0;
+    m_frameBytes = 0;
+    m_frameCount = 0;
+}
+
+/**
+ * @brief 是否已打开
+ */
+bool PcmSource::isOpen() const
+{
+    return m_data != nullptr;
+}
+
+/**
+ * @brief 获取采样格式
+ */
+const PcmSource::Format& PcmSource::format() const
+{
+    return m_format;
+}
+
+/**
+ * @brief 获取总帧数
+ */
+qint64 PcmSource::frameCount() const
+{
+    return m_frameCount;
+}
+
+/**
+ * @brief 将时间换算为帧序号
+ */
+qint64 PcmSource::frameAt(qint64 timeUs) const
+{
+    if (m_format.sampleRate <= 0) {
+        return 0;
+    }
+    return qBound<qint64>(0, timeUs * m_format.sampleRate / 1000000, m_frameCount);
+}
+
+/**
+ * @brief 将帧序号换算为时间
+ */
+qint64 PcmSource::timeAt(qint64 frame) const
+{
+    if (m_format.sampleRate <= 0) {
+        return 0;
+    }
+    return frame * 1000000 / m_format.sampleRate;
+}
+
+/**
+ * @brief 读取若干帧并转换为交错 float
+ *
+ * @param frame          起始帧序号
+ * @param count          帧数
+ * @param outputChannels 输出声道数
+ * @param gain           增益
+ * @param out            输出缓冲
+ * @return int 实际读取的帧数
+ */
+int PcmSource::read(qint64 frame, int count, int outputChannels, float gain, float* out) const
+{
+    if (!m_data || frame < 0 || frame >= m_frameCount || count <= 0 || outputChannels <= 0) {
+        return 0;
+    }
+    count = static_cast<int>(qMin<qint64>(count, m_frameCount - frame));
+
+    const uchar* source = m_data + frame * m_frameBytes;
+    const int inputChannels = m_format.channels;
+    if (outputChannels == inputChannels) {
+        convertBlock(source, static_cast<qint64>(count) * inputChannels, m_format, gain, out);
+        return count;
+    }
+
+    // 声道数不一致：按帧重排，规则与解码路径相同
+    const int bytesPerSample = m_format.bytesPerSample;
+    for (int i = 0; i < count; ++i) {
+        const uchar* samples = source + static_cast<qint64>(i) * m_frameBytes;
+        if (outputChannels == 1) {
+            float sum = 0.0f;
+            for (int c = 0; c < inputChannels; ++c) {
+                sum += readSample(samples + c * bytesPerSample, m_format);
+            }
+            *out++ = sum / inputChannels * gain;
+            continue;
+        }
+        for (int c = 0; c < outputChannels; ++c) {
+            *out++ = readSample(samples + qMin(c, inputChannels - 1) * bytesPerSample, m_format) * gain;
+        }
+    }
+    return count;
+}
+
+/**
+ * @brief 解析 RIFF/WAVE 文件头
+ *
+ * 文件头之后是若干 <标识><小端长度><数据> 块，奇数长度的块补齐一个字节；
+ * fmt 块必须出现在 data 块之前。
+ */
+bool PcmSource::parseWave(const uchar* data, qint64 size)
+{
+    bool haveFormat = false;
+    qint64 offset = kMinHeaderBytes;
+    while (offset + 8 <= size) {
+        const uchar* chunk = data + offset;
+        const quint32 chunkSize = qFromLittleEndian<quint32>(chunk + 4);
+        const qint64 payload = offset + 8;
+
+        if (isTag(chunk, "fmt ")) {
+            if (chunkSize < kFmtChunkMinBytes || payload + chunkSize > size) {
+                return false;
+            }
+            const uchar* fmt = data + payload;
+            quint16 tag = qFromLittleEndian<quint16>(fmt);
+            if (tag == kWaveFormatExtensible && chunkSize >= kFmtExtensibleBytes) {
+                tag = qFromLittleEndian<quint16>(fmt + 24); // 子格式 GUID 的前两个字节
+            }
+            const int bits = qFromLittleEndian<quint16>(fmt + 14);
+            m_format.channels = qFromLittleEndian<quint16>(fmt + 2);
+            m_format.sampleRate = static_cast<int>(qFromLittleEndian<quint32>(fmt + 4));
+            m_format.bytesPerSample = (bits + 7) / 8;
+            m_format.bigEndian = false;
+            if (tag == kWaveFormatPcm) {
+                m_format.encoding = bits <= 8 ? Encoding::Unsigned : Encoding::Signed;
+            } else if (tag == kWaveFormatFloat) {
+                m_format.encoding = Encoding::Float;
+            } else {
+                return false; // ADPCM、μ-law 等交给解码器
+            }
+
+            // 采样之间有填充的文件不走直读
+            const int blockAlign = qFromLittleEndian<quint16>(fmt + 12);
+            if (blockAlign != m_format.bytesPerSample * m_format.channels) {
+                return false;
+            }
+            haveFormat = true;
+        } else if (isTag(chunk, "data")) {
+            if (!haveFormat) {
+                return false;
+            }
+            m_dataOffset = payload;
+            m_dataSize = qMin<qint64>(chunkSize, size - payload);
+            return true;
+        }
+
+        offset = payload + chunkSize + (chunkSize & 1);
+    }
+    return false;
+}
+
+/**
+ * @brief 解析 FORM/AIFF（AIFC）文件头
+ *
+ * 块长度为大端，COMM 与 SSND 可以任意顺序出现。AIFC 只接受未压缩的类型：
+ * NONE/twos（大端整数）、sowt（小端整数）、raw（无符号 8 位）、fl32/fl64（大端浮点）。
+ */
+bool PcmSource::parseAiff(const uchar* data, qint64 size)
+{
+    const bool aifc = isTag(data + 8, "AIFC");
+    bool haveFormat = false;
+    bool haveData = false;
+
+    qint64 offset = kMinHeaderBytes;
+    while (offset + 8 <= size && !(haveFormat && haveData)) {
+        const uchar* chunk = data + offset;
+        const quint32 chunkSize = qFromBigEndian<quint32>(chunk + 4);
+        const qint64 payload = offset + 8;
+
+        if (isTag(chunk, "COMM")) {
+            if (chunkSize < kCommChunkMinBytes || payload + chunkSize > size) {
+                return false;
+            }
+            const uchar* comm = data + payload;
+            m_format.channels = qFromBigEndian<quint16>(comm);
+            m_frameCount = qFromBigEndian<quint32>(comm + 2);
+            m_format.bytesPerSample = (qFromBigEndian<quint16>(comm + 6) + 7) / 8;
+            m_format.sampleRate = qRound(readExtended(comm + 8));
+            m_format.encoding = Encoding::Signed;
+            m_format.bigEndian = true;
+
+            if (aifc && chunkSize >= kCommAifcBytes) {
+                const uchar* compression = comm + 18;
+                if (isTag(compression, "sowt")) {
+                    m_format.bigEndian = false;
+                } else if (isTag(compression, "raw ")) {
+                    m_format.encoding = Encoding::Unsigned;
+                } else if (isTag(compression, "fl32") || isTag(compression, "FL32")
+                           || isTag(compression, "fl64") || isTag(compression, "FL64")) {
+                    m_format.encoding = Encoding::Float;
+                } else if (!isTag(compression, "NONE") && !isTag(compression, "twos")) {
+                    return false; // ulaw、ima4 等压缩格式交给解码器
+                }
+            }
+            haveFormat = true;
+        } else if (isTag(chunk, "SSND")) {
+            if (chunkSize < kSsndHeaderBytes || payload + kSsndHeaderBytes > size) {
+                return false;
+            }
+            const quint32 skip = qFromBigEndian<quint32>(data + payload);
+            m_dataOffset = payload + kSsndHeaderBytes + skip;
+            if (m_dataOffset > size) {
+                return false;
+            }
+            m_dataSize = qMin<qint64>(static_cast<qint64>(chunkSize) - kSsndHeaderBytes - skip, size - m_dataOffset);
+            haveData = true;
+        }
+
+        offset = payload + chunkSize + (chunkSize & 1);
+    }
+    return haveFormat && haveData && m_dataSize > 0;
+}
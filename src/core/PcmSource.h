@@ -0,0 +1,156 @@
+/********************************************************************************
+ * @file   : PcmSource.h
+ * @brief  : 声明了 PcmSource 类。
+ *
+ * 该文件声明了未压缩 PCM 文件（WAV/AIFF）的直读源：自行解析文件头，将采样数据
+ * 区内存映射，播放时直接从映射中取采样并转换为交错 float，不经过 avcodec。
+ * 采样位置与文件偏移是线性关系，跳转只需一次乘法即可精确到采样。
+ *
+ * @author : polarours
+ * @date   : 2026/10/18
+ ********************************************************************************/
+
+#ifndef AURORAPLAYER_PCMSOURCE_H
+#define AURORAPLAYER_PCMSOURCE_H
+
+#include <QString>
+#include <QtGlobal>
+
+#include <memory>
+
+// --- 前向声明 --- //
+class QFile;
+
+class PcmSource
+{
+public:
+    /**
+     * @brief 采样编码
+     */
+    enum class Encoding {
+        Unsigned, ///< 无符号整数（仅 8 位）
+        Signed,   ///< 有符号整数
+        Float     ///< IEEE 浮点
+    };
+
+    /**
+     * @struct Format
+     * @brief 采样数据的格式
+     */
+    struct Format {
+        int sampleRate = 0;                 ///< 采样率
+        int channels = 0;                   ///< 声道数
+        int bytesPerSample = 0;             ///< 每个采样的字节数（1/2/3/4/8）
+        Encoding encoding = Encoding::Signed; ///< 采样编码
+        bool bigEndian = false;             ///< 是否大端字节序
+    };
+
+    /**
+     * @brief 构造函数
+     */
+    PcmSource();
+
+    /**
+     * @brief 析构函数，解除映射并关闭文件
+     */
+    ~PcmSource();
+
+    PcmSource(const PcmSource&) = delete;
+    PcmSource& operator=(const PcmSource&) = delete;
+
+    /**
+     * @brief 解析 WAV/AIFF 文件头并映射采样数据
+     *
+     * @param path 本地文件路径
+     * @return bool 是否为支持的未压缩 PCM 文件且映射成功
+     */
+    bool open(const QString& path);
+
+    /**
+     * @brief 解除映射并关闭文件
+     */
+    void close();
+
+    /**
+     * @brief 是否已打开
+     *
+     * @return bool 是否已打开
+     */
+    bool isOpen() const;
+
+    /**
+     * @brief 获取采样格式
+     *
+     * @return const Format& 采样格式
+     */
+    const Format& format() const;
+
+    /**
+     * @brief 获取总帧数（每帧包含所有声道的一个采样）
+     *
+     * @return qint64 帧数
+     */
+    qint64 frameCount() const;
+
+    /**
+     * @brief 将时间换算为帧序号（截断到 [0, frameCount]）
+     *
+     * @param timeUs 时间（微秒）
+     * @return qint64 帧序号
+     */
+    qint64 frameAt(qint64 timeUs) const;
+
+    /**
+     * @brief 将帧序号换算为时间
+     *
+     * @param frame 帧序号
+     * @return qint64 时间（微秒）
+     */
+    qint64 timeAt(qint64 frame) const;
+
+    /**
+     * @brief 读取若干帧并转换为交错 float，同时乘以增益
+     *
+     * 声道数少于输出时重复最后一个声道，多于输出时舍弃多出的声道（单声道输出取平均），
+     * 与解码路径的转换规则一致。
+     *
+     * @param frame          起始帧序号
+     * @param count          帧数
+     * @param outputChannels 输出声道数
+     * @param gain           增益
+     * @param out            输出缓冲，至少 count * outputChannels 个 float
+     * @return int 实际读取的帧数
+     */
+    int read(qint64 frame, int count, int outputChannels, float gain, float* out) const;
+
+private:
+    /**
+     * @brief 解析 RIFF/WAVE 文件头，记录采样数据的位置
+     *
+     * @param data 映射的文件数据
+     * @param size 文件长度
+     * @return bool 是否找到受支持的 fmt 和 data 块
+     */
+    bool parseWave(const uchar* data, qint64 size);
+
+    /**
+     * @brief 解析 FORM/AIFF（AIFC）文件头，记录采样数据的位置
+     *
+     * @param data 映射的文件数据
+     * @param size 文件长度
+     * @return bool 是否找到受支持的 COMM 和 SSND 块
+     */
+    bool parseAiff(const uchar* data, qint64 size);
+
+private:
+    std::unique_ptr<QFile> m_file; ///< 映射中的文件
+    uchar* m_mapped;               ///< 整个文件的映射
+    const uchar* m_data;           ///< 采样数据起点
+    qint64 m_dataOffset;           ///< 采样数据在文件中的偏移
+    qint64 m_dataSize;             ///< 采样数据字节数
+    int m_frameBytes;              ///< 每帧字节数
+    qint64 m_frameCount;           ///< 总帧数
+    Format m_format;               ///< 采样格式
+};
+
+#endif // AURORAPLAYER_PCMSOURCE_H
@@ -0,0 +1,127 @@
+/********************************************************************************
+ * @file   : PlaybackBackend.cpp
+ * @brief  : 实现了 PlaybackBackend 播放后端接口的公共部分。
+ *
+ * @author : polarours
+ * @date   : 2026/10/18
+ ********************************************************************************/
+
+#include "PlaybackBackend.h"
+#include "MediaPlayer.h"
+#include "QtMultimediaBackend.h"
+
+#include <QDebug>
+
+/**
+ * @brief 构造函数
+ *
+ * @param parent 父对象
+ */
+PlaybackBackend::PlaybackBackend(QObject* parent)
+    : QObject(parent)
+    , m_stats(&m_ownStats)
+    , m_metrics(&m_ownMetrics)
+{
+}
+
+/**
+ * @brief 析构函数
+ */
+PlaybackBackend::~PlaybackBackend() = default;
+
+/**
+ * @brief 创建指定类型的后端
+ *
+ * @param type   后端类型
+ * @param parent 父对象
+ * @return PlaybackBackend* 新建的后端
+ */
+PlaybackBackend* PlaybackBackend::create(Type type, QObject* parent)
+{
+    switch (type) {
+        case Type::FFmpeg:
+            return new MediaPlayer(parent);
+        case Type::QtMultimedia:
+        default:
+            return new QtMultimediaBackend(parent);
+    }
+}
+
+/**
+ * @brief 获取后端类型的名称
+ *
+ * @param type 后端类型
+ * @return QString 名称
+ */
+QString PlaybackBackend::typeName(Type type)
+{
+    return type == Type::FFmpeg ? QStringLiteral("ffmpeg") : QStringLiteral("qt");
+}
+
+/**
+ * @brief 按名称解析后端类型
+ *
+ * @param name 名称
+ * @param type 输出：后端类型
+ * @return bool 名称是否有效
+ */
+bool PlaybackBackend::typeFromName(const QString& name, Type* type)
+{
+    const QString folded = name.trimmed().toLower();
+    if (folded == QLatin1String("ffmpeg")) {
+        *type = Type::FFmpeg;
+        return true;
+    }
+    if (folded == QLatin1String("qt") || folded == QLatin1String("qtmultimedia")) {
+        *type = Type::QtMultimedia;
+        return true;
+    }
+    return false;
+}
+
+/**
+ * @brief 获取默认后端类型
+ *
+ * @return Type 默认后端类型
+ */
+PlaybackBackend::Type PlaybackBackend::defaultType()
+{
+    Type type = Type::QtMultimedia;
+    const QString name = qEnvironmentVariable("AURORAPLAYER_BACKEND");
+    if (!name.isEmpty() && !typeFromName(name, &type)) {
+        qWarning() << "Unknown playback backend:" << name;
+    }
+    return type;
+}
+
+/**
+ * @brief 设置统计计数器和指标的写入目标
+ *
+ * @param stats   播放统计计数器
+ * @param metrics 播放指标
+ */
+void PlaybackBackend::setInstrumentation(PlaybackStats* stats, PlayerMetrics* metrics)
+{
+    m_stats = stats ? stats : &m_ownStats;
+    m_metrics = metrics ? metrics : &m_ownMetrics;
+}
+
+/**
+ * @brief 获取播放统计计数器
+ *
+ * @return const PlaybackStats& 统计计数器
+ */
+const PlaybackStats& PlaybackBackend::stats() const
+{
+    return *m_stats;
+}
+
+/**
+ * @brief 获取播放指标
+ *
+ * @return const PlayerMetrics& 播放指标
+ */
+const PlayerMetrics& PlaybackBackend::metrics() const
+{
+    return *m_metrics;
+}
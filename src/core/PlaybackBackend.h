@@ -0,0 +1,295 @@
+/********************************************************************************
+ * @file   : PlaybackBackend.h
+ * @brief  : 声明了 PlaybackBackend 播放后端接口。
+ *
+ * 该文件声明了 PlayerController 使用的播放后端抽象接口。后端负责打开媒体、
+ * 解码和输出音视频；PlayerController 只通过该接口控制播放，因此可以在运行期
+ * 于 Qt Multimedia 与自带的 FFmpeg 引擎之间切换，并在同一媒体上对比两者。
+ *
+ * @author : polarours
+ * @date   : 2026/10/18
+ ********************************************************************************/
+
+#ifndef AURORAPLAYER_PLAYBACKBACKEND_H
+#define AURORAPLAYER_PLAYBACKBACKEND_H
+
+#include <QObject>
+#include <QString>
+
+#include "CommonState.h"
+#include "PlaybackStats.h"
+#include "Metrics.h"
+
+// --- 前向声明 --- //
+class QVideoSink;
+class QVideoWidget;
+
+class PlaybackBackend : public QObject
+{
+    Q_OBJECT
+
+public:
+    /**
+     * @brief 后端类型
+     */
+    enum class Type {
+        QtMultimedia, ///< Qt Multimedia（QMediaPlayer）
+        FFmpeg        ///< 自带的 FFmpeg 引擎（MediaPlayer）
+    };
+    Q_ENUM(Type)
+
+    /**
+     * @brief 媒体加载状态
+     */
+    enum class MediaStatus {
+        NoMedia,    ///< 未设置媒体
+        Loading,    ///< 正在打开
+        Loaded,     ///< 已打开，可以播放
+        Stalled,    ///< 播放中数据不足（缓冲欠载）
+        EndOfMedia, ///< 已播放到结尾
+        Invalid     ///< 无法打开或解码
+    };
+    Q_ENUM(MediaStatus)
+
+    /**
+     * @brief 构造函数
+     *
+     * @param parent 父对象
+     */
+    explicit PlaybackBackend(QObject* parent = nullptr);
+
+    /**
+     * @brief 析构函数
+     */
+    ~PlaybackBackend() override;
+
+    /**
+     * @brief 创建指定类型的后端
+     *
+     * @param type   后端类型
+     * @param parent 父对象
+     * @return PlaybackBackend* 新建的后端
+     */
+    static PlaybackBackend* create(Type type, QObject* parent = nullptr);
+
+    /**
+     * @brief 获取后端类型的名称（用于命令行、环境变量和界面）
+     *
+     * @param type 后端类型
+     * @return QString 名称（"qt" 或 "ffmpeg"）
+     */
+    static QString typeName(Type type);
+
+    /**
+     * @brief 按名称解析后端类型（不区分大小写）
+     *
+     * @param name 名称
+     * @param type 输出：后端类型
+     * @return bool 名称是否有效
+     */
+    static bool typeFromName(const QString& name, Type* type);
+
+    /**
+     * @brief 获取默认后端类型
+     *
+     * 环境变量 AURORAPLAYER_BACKEND=qt|ffmpeg 可覆盖，否则为 Qt Multimedia。
+     *
+     * @return Type 默认后端类型
+     */
+    static Type defaultType();
+
+    /**
+     * @brief 获取后端类型
+     *
+     * @return Type 后端类型
+     */
+    virtual Type type() const = 0;
+
+    /**
+     * @brief 设置统计计数器和指标的写入目标
+     *
+     * 需要在 setMedia() 之前调用；未设置时写入后端自带的实例。
+     *
+     * @param stats   播放统计计数器
+     * @param metrics 播放指标
+     */
+    void setInstrumentation(PlaybackStats* stats, PlayerMetrics* metrics);
+
+    /**
+     * @brief 获取播放统计计数器
+     *
+     * @return const PlaybackStats& 统计计数器（可在任意线程读取）
+     */
+    const PlaybackStats& stats() const;
+
+    /**
+     * @brief 获取播放指标
+     *
+     * @return const PlayerMetrics& 播放指标（可在任意线程读取）
+     */
+    const PlayerMetrics& metrics() const;
+
+    /**
+     * @brief 设置媒体文件（不自动开始播放）
+     *
+     * @param mediaPath 媒体文件路径，为空时卸载当前媒体
+     */
+    virtual void setMedia(const QString& mediaPath) = 0;
+
+    /**
+     * @brief 设置视频输出组件
+     *
+     * @param widget 视频输出组件，可为 nullptr
+     */
+    virtual void setVideoOutput(QVideoWidget* widget) = 0;
+
+    /**
+     * @brief 设置视频输出为独立的 videoSink（无界面运行时使用）
+     *
+     * @param sink 视频帧接收端，可为 nullptr（解码但不输出）
+     */
+    virtual void setVideoSink(QVideoSink* sink) = 0;
+
+    /**
+     * @brief 启用/关闭音频设备输出（下次打开媒体时生效）
+     *
+     * 关闭时音频仍然解码，并按实时节奏丢弃，播放时钟改由系统时钟驱动，
+     * 用于没有声卡的服务器和容器。
+     *
+     * @param enabled 是否输出到音频设备
+     */
+    virtual void setAudioOutputEnabled(bool enabled) = 0;
+
+    /**
+     * @brief 设置画面是否可见
+     *
+     * 窗口最小化、被完全遮挡或视频区域隐藏时，后端应停止视频解码和显示以节省
+     * CPU，音频和播放时钟照常运行；重新可见时尽快恢复画面。
+     *
+     * @param visible 是否可见
+     */
+    virtual void setVideoVisible(bool visible) = 0;
+
+    /**
+     * @brief 获取媒体总时长
+     *
+     * @return qint64 总时长（毫秒），未知时为 0
+     */
+    virtual qint64 duration() const = 0;
+
+    /**
+     * @brief 获取当前播放位置
+     *
+     * @return qint64 播放位置（毫秒）
+     */
+    virtual qint64 position() const = 0;
+
+    /**
+     * @brief 获取当前播放状态
+     *
+     * @return AuroraPlayer::State::PlayerState 播放状态
+     */
+    virtual AuroraPlayer::State::PlayerState state() const = 0;
+
+    /**
+     * @brief 当前媒体是否包含视频
+     *
+     * @return bool 是否包含视频
+     */
+    virtual bool hasVideo() const = 0;
+
+    /**
+     * @brief 获取当前媒体的总码率
+     *
+     * @return qint64 码率（bit/s），未知时为 0
+     */
+    virtual qint64 bitrate() const = 0;
+
+    /**
+     * @brief 获取当前音量
+     *
+     * @return int 音量（0-100）
+     */
+    virtual int volume() const = 0;
+
+public slots:
+    /**
+     * @brief 开始或恢复播放
+     */
+    virtual void play() = 0;
+
+    /**
+     * @brief 暂停播放
+     */
+    virtual void pause() = 0;
+
+    /**
+     * @brief 停止播放，位置回到开头
+     */
+    virtual void stop() = 0;
+
+    /**
+     * @brief 跳转到指定位置
+     *
+     * @param position 播放位置（毫秒）
+     */
+    virtual void setPosition(qint64 position) = 0;
+
+    /**
+     * @brief 设置音量
+     *
+     * @param volume 音量（0-100）
+     */
+    virtual void setVolume(int volume) = 0;
+
+signals:
+    /**
+     * @brief 播放状态变化信号
+     *
+     * @param state 播放状态
+     */
+    void stateChanged(AuroraPlayer::State::PlayerState state);
+
+    /**
+     * @brief 媒体时长变化信号
+     *
+     * @param duration 媒体时长（毫秒）
+     */
+    void durationChanged(qint64 duration);
+
+    /**
+     * @brief 播放位置变化信号
+     *
+     * @param position 播放位置（毫秒）
+     */
+    void positionChanged(qint64 position);
+
+    /**
+     * @brief 媒体加载状态变化信号
+     *
+     * @param status 加载状态
+     */
+    void mediaStatusChanged(PlaybackBackend::MediaStatus status);
+
+    /**
+     * @brief 媒体元数据（码率、是否有视频等）变化信号
+     */
+    void metadataChanged();
+
+    /**
+     * @brief 发生错误信号
+     *
+     * @param message 错误描述
+     */
+    void errorOccurred(const QString& message);
+
+protected:
+    PlaybackStats* m_stats;   ///< 统计计数器写入目标（不为空）
+    PlayerMetrics* m_metrics; ///< 播放指标写入目标（不为空）
+
+private:
+    PlaybackStats m_ownStats;   ///< 未设置写入目标时使用的统计计数器
+    PlayerMetrics m_ownMetrics; ///< 未设置写入目标时使用的播放指标
+};
+
+#endif // AURORAPLAYER_PLAYBACKBACKEND_H
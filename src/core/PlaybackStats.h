@@ -0,0 +1,99 @@
+/********************************************************************************
+ * @file   : PlaybackStats.h
+ * @brief  : 定义了 PlaybackStats 播放统计计数器。
+ *
+ * 该文件定义了播放引擎写入、界面定时读取的原子计数器。写入端只做 relaxed
+ * 原子加/存，读取端按固定低频率取快照并计算速率，因此不引入逐帧的锁或信号。
+ *
+ * @author : polarours
+ * @date   : 2026/10/18
+ ********************************************************************************/
+
+#ifndef AURORAPLAYER_PLAYBACKSTATS_H
+#define AURORAPLAYER_PLAYBACKSTATS_H
+
+#include <QtGlobal>
+
+#include <atomic>
+
+/**
+ * @struct PlaybackStats
+ * @brief 播放统计计数器（多线程写入，任意线程读取）
+ */
+struct PlaybackStats
+{
+    /**
+     * @brief 某一时刻的计数器快照
+     */
+    struct Snapshot {
+        quint64 framesDecoded = 0;   ///< 已解码视频帧数
+        quint64 framesPresented = 0; ///< 已显示视频帧数
+        quint64 framesDropped = 0;   ///< 丢弃的视频帧数
+        quint64 framesLate = 0;      ///< 显示时已迟到的视频帧数
+        int videoQueueDepth = 0;     ///< 视频帧队列深度
+        int audioQueueDepth = 0;     ///< 音频缓冲深度（毫秒）
+        qint64 avDriftMs = 0;        ///< 音视频偏差（毫秒，正值表示视频超前）
+        int decoderThreads = 0;      ///< 解码线程数
+        int pixelFormat = -1;        ///< 像素格式（AVPixelFormat，-1 表示未知）
+        int videoWidth = 0;          ///< 视频宽度
+        int videoHeight = 0;         ///< 视频高度
+        qint64 bitrate = 0;          ///< 码率（bit/s）
+    };
+
+    std::atomic<quint64> framesDecoded{0};
+    std::atomic<quint64> framesPresented{0};
+    std::atomic<quint64> framesDropped{0};
+    std::atomic<quint64> framesLate{0};
+    std::atomic<int> videoQueueDepth{0};
+    std::atomic<int> audioQueueDepth{0};
+    std::atomic<qint64> avDriftMs{0};
+    std::atomic<int> decoderThreads{0};
+    std::atomic<int> pixelFormat{-1};
+    std::atomic<int> videoWidth{0};
+    std::atomic<int> videoHeight{0};
+    std::atomic<qint64> bitrate{0};
+
+    /**
+     * @brief 取一次快照
+     *
+     * @return Snapshot 快照
+     */
+    Snapshot snapshot() const
+    {
+        Snapshot s;
+        s.framesDecoded = framesDecoded.load(std::memory_order_relaxed);
+        s.framesPresented = framesPresented.load(std::memory_order_relaxed);
+        s.framesDropped = framesDropped.load(std::memory_order_relaxed);
+        s.framesLate = framesLate.load(std::memory_order_relaxed);
+        s.videoQueueDepth = videoQueueDepth.load(std::memory_order_relaxed);
+        s.audioQueueDepth = audioQueueDepth.load(std::memory_order_relaxed);
+        s.avDriftMs = avDriftMs.load(std::memory_order_relaxed);
+        s.decoderThreads = decoderThreads.load(std::memory_order_relaxed);
+        s.pixelFormat = pixelFormat.load(std::memory_order_relaxed);
+        s.videoWidth = videoWidth.load(std::memory_order_relaxed);
+        s.videoHeight = videoHeight.load(std::memory_order_relaxed);
+        s.bitrate = bitrate.load(std::memory_order_relaxed);
+        return s;
+    }
+
+    /**
+     * @brief 切换媒体时清零
+     */
+    void reset()
+    {
+        framesDecoded.store(0, std::memory_order_relaxed);
+        framesPresented.store(0, std::memory_order_relaxed);
+        framesDropped.store(0, std::memory_order_relaxed);
+        framesLate.store(0, std::memory_order_relaxed);
+        videoQueueDepth.store(0, std::memory_order_relaxed);
+        audioQueueDepth.store(0, std::memory_order_relaxed);
+        avDriftMs.store(0, std::memory_order_relaxed);
+        decoderThreads.store(0, std::memory_order_relaxed);
+        pixelFormat.store(-1, std::memory_order_relaxed);
+        videoWidth.store(0, std::memory_order_relaxed);
+        videoHeight.store(0, std::memory_order_relaxed);
+        bitrate.store(0, std::memory_order_relaxed);
+    }
+};
+
+#endif // AURORAPLAYER_PLAYBACKSTATS_H
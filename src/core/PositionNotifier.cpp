@@ -0,0 +1,101 @@
+/********************************************************************************
+ * @file   : PositionNotifier.cpp
+ * @brief  : 实现了 PositionNotifier 类。
+ *
+ * @author : polarours
+ * @date   : 2026/10/18
+ ********************************************************************************/
+
+#include "PositionNotifier.h"
+
+#include <QTimer>
+#include <QtMath>
+
+/**
+ * @brief 构造函数
+ *
+ * @param parent 父对象
+ */
+PositionNotifier::PositionNotifier(QObject* parent)
+    : QObject(parent)
+    , m_timer(new QTimer(this))
+    , m_refreshRate(0.0)
+    , m_intervalMs(1)
+    , m_lastEmitted(-1)
+{
+    m_timer->setTimerType(Qt::PreciseTimer);
+    m_timer->setSingleShot(true);
+    connect(m_timer, &QTimer::timeout, this, &PositionNotifier::flush);
+    setRefreshRate(60.0);
+}
+
+/**
+ * @brief 发布最新播放位置
+ *
+ * @param positionMs 播放位置（毫秒）
+ */
+void PositionNotifier::publish(qint64 positionMs)
+{
+    m_position.store(positionMs, std::memory_order_relaxed);
+
+    // 已有排队或推迟的通知时只更新位置，由那次通知带出最新值
+    if (!m_flushPending.exchange(true, std::memory_order_acq_rel)) {
+        QMetaObject::invokeMethod(this, &PositionNotifier::flush, Qt::QueuedConnection);
+    }
+}
+
+/**
+ * @brief 获取最近发布的播放位置
+ *
+ * @return qint64 播放位置（毫秒）
+ */
+qint64 PositionNotifier::position() const
+{
+    return m_position.load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief 设置最高通知频率
+ *
+ * @param hz 每秒最多通知次数
+ */
+void PositionNotifier::setRefreshRate(double hz)
+{
+    m_refreshRate = qBound(1.0, hz, 240.0);
+    m_intervalMs = qMax(1, qRound(1000.0 / m_refreshRate));
+}
+
+/**
+ * @brief 获取最高通知频率
+ *
+ * @return double 每秒最多通知次数
+ */
+double PositionNotifier::refreshRate() const
+{
+    return m_refreshRate;
+}
+
+/**
+ * @brief 执行排队的通知，有变化时发出信号
+ *
+ * 发布频率高于刷新率时（例如逐帧发布），距上次通知不足一个周期的通知由单次
+ * 定时器推迟到周期结束，期间的发布都合并进去；纯音频按引擎的发布间隔唤醒。
+ */
+void PositionNotifier::flush()
+{
+    if (m_sinceFlush.isValid()) {
+        const qint64 remainingMs = m_intervalMs - m_sinceFlush.elapsed();
+        if (remainingMs > 0) {
+            m_timer->start(static_cast<int>(remainingMs));
+            return;
+        }
+    }
+    m_sinceFlush.start();
+    m_flushPending.store(false, std::memory_order_release);
+
+    const qint64 position = m_position.load(std::memory_order_relaxed);
+    if (position != m_lastEmitted) {
+        m_lastEmitted = position;
+        emit positionChanged(position);
+    }
+}
@@ -0,0 +1,88 @@
+/********************************************************************************
+ * @file   : PositionNotifier.h
+ * @brief  : 声明了 PositionNotifier 类。
+ *
+ * 该文件声明了合并播放位置更新的通知器：任意线程以原子方式写入最新位置，
+ * 由发布驱动界面线程的通知，最多每个刷新周期发出一次信号，没有发布时不唤醒。
+ *
+ * @author : polarours
+ * @date   : 2026/10/18
+ ********************************************************************************/
+
+#ifndef AURORAPLAYER_POSITIONNOTIFIER_H
+#define AURORAPLAYER_POSITIONNOTIFIER_H
+
+#include <QElapsedTimer>
+#include <QObject>
+
+#include <atomic>
+
+class QTimer;
+
+class PositionNotifier : public QObject
+{
+    Q_OBJECT
+
+public:
+    /**
+     * @brief 构造函数
+     *
+     * @param parent 父对象（决定通知所在的线程）
+     */
+    explicit PositionNotifier(QObject* parent = nullptr);
+
+    /**
+     * @brief 发布最新播放位置（线程安全，不直接触发信号）
+     *
+     * 没有排队的通知时投递一次，通知执行前的后续发布被合并。
+     *
+     * @param positionMs 播放位置（毫秒）
+     */
+    void publish(qint64 positionMs);
+
+    /**
+     * @brief 获取最近发布的播放位置（线程安全）
+     *
+     * @return qint64 播放位置（毫秒）
+     */
+    qint64 position() const;
+
+    /**
+     * @brief 设置最高通知频率
+     *
+     * @param hz 每秒最多通知次数（通常为显示刷新率）
+     */
+    void setRefreshRate(double hz);
+
+    /**
+     * @brief 获取最高通知频率
+     *
+     * @return double 每秒最多通知次数
+     */
+    double refreshRate() const;
+
+signals:
+    /**
+     * @brief 播放位置变化信号（合并后）
+     *
+     * @param position 播放位置（毫秒）
+     */
+    void positionChanged(qint64 position);
+
+private slots:
+    /**
+     * @brief 执行排队的通知；距上次通知不足一个周期时推迟到周期结束
+     */
+    void flush();
+
+private:
+    QTimer* m_timer;                       ///< 推迟通知的单次定时器
+    double m_refreshRate;                  ///< 最高通知频率
+    int m_intervalMs;                      ///< 两次通知的最小间隔（毫秒）
+    std::atomic<qint64> m_position{0};     ///< 最新发布的位置
+    std::atomic<bool> m_flushPending{false}; ///< 是否已有排队或推迟的通知
+    QElapsedTimer m_sinceFlush;            ///< 距上一次通知的时间
+    qint64 m_lastEmitted;                  ///< 上一次发出的位置
+};
+
+#endif // AURORAPLAYER_POSITIONNOTIFIER_H
@@ -0,0 +1,240 @@
+/********************************************************************************
+ * @file   : QtMultimediaBackend.cpp
+ * @brief  : 实现了 QtMultimediaBackend 类。
+ *
+ * @author : polarours
+ * @date   : 2026/10/18
+ ********************************************************************************/
+
+#include "QtMultimediaBackend.h"
+#include "../utils/Utils.h"
+
+#include <QAudioOutput>
+#include <QMediaMetaData>
+#include <QMediaPlayer>
+#include <QUrl>
+#include <QVideoSink>
+#include <QVideoWidget>
+
+namespace {
+
+    /**
+     * @brief 将 QMediaPlayer 的播放状态映射为播放器状态
+     */
+    AuroraPlayer::State::PlayerState toPlayerState(QMediaPlayer::PlaybackState state)
+    {
+        switch (state) {
+            case QMediaPlayer::PlayingState: return AuroraPlayer::State::PlayerState::Playing;
+            case QMediaPlayer::PausedState:  return AuroraPlayer::State::PlayerState::Paused;
+            default:                         return AuroraPlayer::State::PlayerState::Stopped;
+        }
+    }
+
+} // namespace
+
+/**
+ * @brief 构造函数
+ *
+ * @param parent 父对象
+ */
+QtMultimediaBackend::QtMultimediaBackend(QObject* parent)
+    : PlaybackBackend(parent)
+    , m_player(new QMediaPlayer(this))
+    , m_audioOutput(new QAudioOutput(this))
+    , m_videoVisible(true)
+    , m_hiddenVideoTrack(-1)
+{
+    m_player->setAudioOutput(m_audioOutput);
+
+    connect(m_player, &QMediaPlayer::durationChanged, this, &PlaybackBackend::durationChanged);
+    connect(m_player, &QMediaPlayer::positionChanged, this, &PlaybackBackend::positionChanged);
+    connect(m_player, &QMediaPlayer::metaDataChanged, this, &PlaybackBackend::metadataChanged);
+    connect(m_player, &QMediaPlayer::hasVideoChanged, this, &PlaybackBackend::metadataChanged);
+    connect(m_player, &QMediaPlayer::playbackStateChanged, this, [this](QMediaPlayer::PlaybackState state) {
+                emit stateChanged(toPlayerState(state));
+            });
+    connect(m_player, &QMediaPlayer::mediaStatusChanged, this, [this](QMediaPlayer::MediaStatus status) {
+                // 新媒体默认启用视频轨道，不可见时重新关闭
+                if (status == QMediaPlayer::LoadedMedia && !m_videoVisible) {
+                    m_hiddenVideoTrack = -1;
+                    setVideoVisible(false);
+                }
+                switch (status) {
+                    case QMediaPlayer::NoMedia:      emit mediaStatusChanged(MediaStatus::NoMedia); break;
+                    case QMediaPlayer::LoadingMedia: emit mediaStatusChanged(MediaStatus::Loading); break;
+                    case QMediaPlayer::LoadedMedia:  emit mediaStatusChanged(MediaStatus::Loaded); break;
+                    case QMediaPlayer::StalledMedia: emit mediaStatusChanged(MediaStatus::Stalled); break;
+                    case QMediaPlayer::EndOfMedia:   emit mediaStatusChanged(MediaStatus::EndOfMedia); break;
+                    case QMediaPlayer::InvalidMedia: emit mediaStatusChanged(MediaStatus::Invalid); break;
+                    default: break; // 缓冲中/已缓冲不单独上报
+                }
+            });
+    connect(m_player, &QMediaPlayer::errorOccurred, this, [this](QMediaPlayer::Error error) {
+                if (error != QMediaPlayer::NoError) {
+                    emit errorOccurred(m_player->errorString());
+                }
+            });
+}
+
+/**
+ * @brief 析构函数
+ */
+QtMultimediaBackend::~QtMultimediaBackend() = default;
+
+/**
+ * @brief 获取后端类型
+ */
+PlaybackBackend::Type QtMultimediaBackend::type() const
+{
+    return Type::QtMultimedia;
+}
+
+/**
+ * @brief 设置媒体文件
+ */
+void QtMultimediaBackend::setMedia(const QString& mediaPath)
+{
+    if (mediaPath.isEmpty()) {
+        m_player->setSource(QUrl());
+    } else if (AuroraPlayer::Utils::isNetworkUrl(mediaPath)) {
+        m_player->setSource(QUrl(mediaPath));
+    } else {
+        m_player->setSource(QUrl::fromLocalFile(mediaPath));
+    }
+}
+
+/**
+ * @brief 设置视频输出组件
+ */
+void QtMultimediaBackend::setVideoOutput(QVideoWidget* widget)
+{
+    m_player->setVideoOutput(widget);
+}
+
+/**
+ * @brief 设置独立的视频帧接收端
+ */
+void QtMultimediaBackend::setVideoSink(QVideoSink* sink)
+{
+    m_player->setVideoSink(sink);
+}
+
+/**
+ * @brief 启用/关闭音频设备输出（QMediaPlayer 没有音频输出时按自身时钟播放）
+ */
+void QtMultimediaBackend::setAudioOutputEnabled(bool enabled)
+{
+    m_player->setAudioOutput(enabled ? m_audioOutput : nullptr);
+}
+
+/**
+ * @brief 设置画面是否可见
+ *
+ * 不可见时关闭当前视频轨道，QMediaPlayer 不再解码视频；恢复时重新启用原轨道。
+ */
+void QtMultimediaBackend::setVideoVisible(bool visible)
+{
+    m_videoVisible = visible;
+    if (!visible) {
+        if (m_hiddenVideoTrack < 0 && m_player->activeVideoTrack() >= 0) {
+            m_hiddenVideoTrack = m_player->activeVideoTrack();
+            m_player->setActiveVideoTrack(-1);
+        }
+    } else if (m_hiddenVideoTrack >= 0) {
+        m_player->setActiveVideoTrack(m_hiddenVideoTrack);
+        m_hiddenVideoTrack = -1;
+    }
+}
+
+/**
+ * @brief 获取媒体总时长
+ */
+qint64 QtMultimediaBackend::duration() const
+{
+    return m_player->duration();
+}
+
+/**
+ * @brief 获取当前播放位置
+ */
+qint64 QtMultimediaBackend::position() const
+{
+    return m_player->position();
+}
+
+/**
+ * @brief 获取当前播放状态
+ */
+AuroraPlayer::State::PlayerState QtMultimediaBackend::state() const
+{
+    if (m_player->error() != QMediaPlayer::NoError) {
+        return AuroraPlayer::State::PlayerState::Error;
+    }
+    return toPlayerState(m_player->playbackState());
+}
+
+/**
+ * @brief 当前媒体是否包含视频
+ */
+bool QtMultimediaBackend::hasVideo() const
+{
+    return m_player->hasVideo();
+}
+
+/**
+ * @brief 获取当前媒体的总码率（来自媒体元数据）
+ */
+qint64 QtMultimediaBackend::bitrate() const
+{
+    const QMediaMetaData metaData = m_player->metaData();
+    return metaData.value(QMediaMetaData::VideoBitRate).toLongLong()
+         + metaData.value(QMediaMetaData::AudioBitRate).toLongLong();
+}
+
+/**
+ * @brief 获取当前音量
+ */
+int QtMultimediaBackend::volume() const
+{
+    return qRound(m_audioOutput->volume() * 100);
+}
+
+/**
+ * @brief 开始或恢复播放
+ */
+void QtMultimediaBackend::play()
+{
+    m_player->play();
+}
+
+/**
+ * @brief 暂停播放
+ */
+void QtMultimediaBackend::pause()
+{
+    m_player->pause();
+}
+
+/**
+ * @brief 停止播放
+ */
+void QtMultimediaBackend::stop()
+{
+    m_player->stop();
+}
+
+/**
+ * @brief 跳转到指定位置
+ */
+void QtMultimediaBackend::setPosition(qint64 position)
+{
+    m_player->setPosition(position);
+}
+
+/**
+ * @brief 设置音量
+ */
+void QtMultimediaBackend::setVolume(int volume)
+{
+    m_audioOutput->setVolume(qBound(0, volume, 100) / 100.0);
+}
@@ -0,0 +1,158 @@
+/********************************************************************************
+ * @file   : QtMultimediaBackend.h
+ * @brief  : 声明了 QtMultimediaBackend 类。
+ *
+ * 该文件声明了基于 QMediaPlayer 和 QAudioOutput 的播放后端。
+ *
+ * @author : polarours
+ * @date   : 2026/10/18
+ ********************************************************************************/
+
+#ifndef AURORAPLAYER_QTMULTIMEDIABACKEND_H
+#define AURORAPLAYER_QTMULTIMEDIABACKEND_H
+
+#include "PlaybackBackend.h"
+
+// --- 前向声明 --- //
+class QMediaPlayer;
+class QAudioOutput;
+
+class QtMultimediaBackend : public PlaybackBackend
+{
+    Q_OBJECT
+
+public:
+    /**
+     * @brief 构造函数
+     *
+     * @param parent 父对象
+     */
+    explicit QtMultimediaBackend(QObject* parent = nullptr);
+
+    /**
+     * @brief 析构函数
+     */
+    ~QtMultimediaBackend() override;
+
+    /**
+     * @brief 获取后端类型
+     *
+     * @return Type 始终为 Type::QtMultimedia
+     */
+    Type type() const override;
+
+    /**
+     * @brief 设置媒体文件路径（本地路径或网络地址，不自动播放）
+     *
+     * @param mediaPath  媒体文件路径，为空时清除当前媒体
+     */
+    void setMedia(const QString& mediaPath) override;
+
+    /**
+     * @brief 设置视频输出组件
+     *
+     * @param widget  视频输出组件
+     */
+    void setVideoOutput(QVideoWidget* widget) override;
+
+    /**
+     * @brief 设置独立的视频帧接收端
+     *
+     * @param sink 视频帧接收端
+     */
+    void setVideoSink(QVideoSink* sink) override;
+
+    /**
+     * @brief 启用/关闭音频设备输出（关闭时 QMediaPlayer 按自身时钟播放）
+     *
+     * @param enabled 是否输出到音频设备
+     */
+    void setAudioOutputEnabled(bool enabled) override;
+
+    /**
+     * @brief 设置画面是否可见（不可见时关闭视频轨道，QMediaPlayer 不再解码视频）
+     *
+     * @param visible 是否可见
+     */
+    void setVideoVisible(bool visible) override;
+
+    /**
+     * @brief 获取媒体文件的总时长
+     *
+     * @return qint64  媒体文件的总时长（毫秒）
+     */
+    qint64 duration() const override;
+
+    /**
+     * @brief 获取媒体文件的当前播放位置
+     *
+     * @return qint64  当前播放位置（毫秒）
+     */
+    qint64 position() const override;
+
+    /**
+     * @brief 获取当前播放状态
+     *
+     * @return AuroraPlayer::State::PlayerState 当前播放状态，QMediaPlayer 出错时为 Error
+     */
+    AuroraPlayer::State::PlayerState state() const override;
+
+    /**
+     * @brief 当前媒体是否包含视频
+     *
+     * @return bool 是否包含视频
+     */
+    bool hasVideo() const override;
+
+    /**
+     * @brief 获取当前媒体的总码率（来自媒体元数据的视频与音频码率之和）
+     *
+     * @return qint64 码率（bit/s），元数据未提供时为 0
+     */
+    qint64 bitrate() const override;
+
+    /**
+     * @brief 获取当前音量
+     *
+     * @return int 音量（0-100）
+     */
+    int volume() const override;
+
+public slots:
+    /**
+     * @brief 开始或恢复播放
+     */
+    void play() override;
+
+    /**
+     * @brief 暂停媒体播放
+     */
+    void pause() override;
+
+    /**
+     * @brief 停止媒体播放
+     */
+    void stop() override;
+
+    /**
+     * @brief 设置媒体播放位置
+     *
+     * @param position  播放位置（毫秒）
+     */
+    void setPosition(qint64 position) override;
+
+    /**
+     * @brief 设置音量
+     *
+     * @param volume  音量（0-100）
+     */
+    void setVolume(int volume) override;
+
+private:
+    QMediaPlayer* m_player;      ///< 媒体播放器
+    QAudioOutput* m_audioOutput; ///< 音频输出
+    bool m_videoVisible;         ///< 画面是否可见
+    int m_hiddenVideoTrack;      ///< 隐藏前的视频轨道，-1 表示未隐藏
+};
+
+#endif // AURORAPLAYER_QTMULTIMEDIABACKEND_H
@@ -0,0 +1,160 @@
+/********************************************************************************
+ * @file   : SingleInstance.cpp
+ * @brief  : 实现了 SingleInstance 类。
+ *
+ * @author : polarours
+ * @date   : 2026/10/18
+ ********************************************************************************/
+
+#include "SingleInstance.h"
+
+#include <QCryptographicHash>
+#include <QDataStream>
+#include <QLocalServer>
+#include <QLocalSocket>
+#include <QtDebug>
+
+namespace {
+
+    constexpr quint32 kRequestMagic = 0x41504931; ///< 请求头标识（"API1"）
+    constexpr char kAck = 'A';                    ///< 服务端确认字节
+
+} // namespace
+
+/**
+ * @brief 构造函数
+ *
+ * @param parent 父对象
+ */
+SingleInstance::SingleInstance(QObject* parent)
+    : QObject(parent)
+    , m_server(new QLocalServer(this))
+{
+    connect(m_server, &QLocalServer::newConnection, this, [this]() {
+                while (QLocalSocket* socket = m_server->nextPendingConnection()) {
+                    connect(socket, &QLocalSocket::readyRead, this, [this, socket]() { readRequest(socket); });
+                    connect(socket, &QLocalSocket::disconnected, socket, &QObject::deleteLater);
+                    readRequest(socket);
+                }
+            });
+}
+
+/**
+ * @brief 析构函数
+ */
+SingleInstance::~SingleInstance()
+{
+    m_server->close();
+}
+
+/**
+ * @brief 获取本地套接字名称
+ *
+ * @return QString 套接字名称
+ */
+QString SingleInstance::serverName()
+{
+    // 不同用户各自一个实例；用户名做哈希以避免非法字符
+    QString user = qEnvironmentVariable("USER");
+    if (user.isEmpty()) {
+        user = qEnvironmentVariable("USERNAME");
+    }
+    const QByteArray hash = QCryptographicHash::hash(user.toUtf8(), QCryptographicHash::Sha1).toHex().left(12);
+    return QStringLiteral("AuroraPlayer-") + QString::fromLatin1(hash);
+}
+
+/**
+ * @brief 把文件转交给已运行的实例
+ *
+ * @param files     文件路径列表
+ * @param timeoutMs 超时（毫秒）
+ * @return bool 是否确认收到
+ */
+bool SingleInstance::forward(const QStringList& files, int timeoutMs)
+{
+    QLocalSocket socket;
+    socket.connectToServer(serverName());
+    if (!socket.waitForConnected(timeoutMs)) {
+        return false;
+    }
+
+    QByteArray request;
+    QDataStream out(&request, QIODevice::WriteOnly);
+    out.setVersion(QDataStream::Qt_6_0);
+    out << kRequestMagic << files;
+
+    socket.write(request);
+    if (!socket.waitForBytesWritten(timeoutMs)) {
+        return false;
+    }
+
+    // 等待确认，避免把文件交给一个已经卡住或正在退出的实例
+    while (socket.bytesAvailable() < 1) {
+        if (!socket.waitForReadyRead(timeoutMs)) {
+            return false;
+        }
+    }
+    char ack = 0;
+    socket.getChar(&ack);
+    socket.disconnectFromServer();
+    return ack == kAck;
+}
+
+/**
+ * @brief 开始监听后续启动的实例
+ *
+ * @return bool 是否成功监听
+ */
+bool SingleInstance::listen()
+{
+    const QString name = serverName();
+    m_server->setSocketOptions(QLocalServer::UserAccessOption);
+    if (m_server->listen(name)) {
+        return true;
+    }
+
+    if (m_server->serverError() == QAbstractSocket::AddressInUseError) {
+        // 先确认没有活着的实例，再清理上次异常退出遗留的套接字文件
+        QLocalSocket probe;
+        probe.connectToServer(name);
+        if (probe.waitForConnected(100)) {
+            return false;
+        }
+        QLocalServer::removeServer(name);
+        if (m_server->listen(name)) {
+            return true;
+        }
+    }
+
+    qWarning() << "Single-instance server unavailable:" << m_server->errorString();
+    return false;
+}
+
+/**
+ * @brief 读取一个连接上的请求
+ *
+ * @param socket 连接
+ */
+void SingleInstance::readRequest(QLocalSocket* socket)
+{
+    QDataStream in(socket);
+    in.setVersion(QDataStream::Qt_6_0);
+
+    // 请求可能分多次到达，不完整时回滚等待下一次 readyRead
+    in.startTransaction();
+    quint32 magic = 0;
+    QStringList files;
+    in >> magic >> files;
+    if (!in.commitTransaction()) {
+        return;
+    }
+
+    if (magic != kRequestMagic) {
+        socket->abort();
+        return;
+    }
+
+    socket->putChar(kAck);
+    socket->flush();
+    emit filesReceived(files);
+}
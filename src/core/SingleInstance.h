@@ -0,0 +1,87 @@
+/********************************************************************************
+ * @file   : SingleInstance.h
+ * @brief  : 声明了 SingleInstance 类。
+ *
+ * 该文件声明了单实例支持：第一个实例在本地套接字上监听；之后启动的进程在创建
+ * QApplication 之前尝试连接，把命令行中的文件交给已运行的实例后立即退出，
+ * 不再付出完整的 Qt 与多媒体启动开销。没有实例在监听时按正常流程启动。
+ *
+ * @author : polarours
+ * @date   : 2026/10/18
+ ********************************************************************************/
+
+#ifndef AURORAPLAYER_SINGLEINSTANCE_H
+#define AURORAPLAYER_SINGLEINSTANCE_H
+
+#include <QObject>
+#include <QStringList>
+
+// --- 前向声明 --- //
+class QLocalServer;
+class QLocalSocket;
+
+class SingleInstance : public QObject
+{
+    Q_OBJECT
+
+public:
+    /**
+     * @brief 构造函数
+     *
+     * @param parent 父对象
+     */
+    explicit SingleInstance(QObject* parent = nullptr);
+
+    /**
+     * @brief 析构函数，停止监听
+     */
+    ~SingleInstance() override;
+
+    /**
+     * @brief 把文件转交给已运行的实例
+     *
+     * 只使用阻塞的套接字调用，可在创建 QApplication 之前调用。
+     *
+     * @param files     文件路径列表（绝对路径；为空时只请求激活窗口）
+     * @param timeoutMs 连接和等待确认的超时（毫秒）
+     * @return bool 已运行的实例是否确认收到
+     */
+    static bool forward(const QStringList& files, int timeoutMs = 500);
+
+    /**
+     * @brief 开始监听后续启动的实例
+     *
+     * 上次异常退出遗留的套接字会被清理；若另一个实例正在监听则不接管。
+     *
+     * @return bool 是否成功监听
+     */
+    bool listen();
+
+    /**
+     * @brief 获取本地套接字名称（按用户区分）
+     *
+     * @return QString 套接字名称
+     */
+    static QString serverName();
+
+signals:
+    /**
+     * @brief 收到后续实例转交的文件
+     *
+     * @param files 文件路径列表，可能为空（只请求激活窗口）
+     */
+    void filesReceived(const QStringList& files);
+
+private:
+    /**
+     * @brief 读取一个连接上的请求，完整后确认并发出信号
+     *
+     * @param socket 连接
+     */
+    void readRequest(QLocalSocket* socket);
+
+private:
+    QLocalServer* m_server; ///< 本地套接字服务端
+};
+
+#endif // AURORAPLAYER_SINGLEINSTANCE_H
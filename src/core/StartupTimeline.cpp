@@ -0,0 +1,169 @@
+/********************************************************************************
+ * @file   : StartupTimeline.cpp
+ * @brief  : 实现了 StartupTimeline 类。
+ *
+ * @author : polarours
+ * @date   : 2026/10/18
+ ********************************************************************************/
+
+#include "StartupTimeline.h"
+#include "Tracer.h"
+
+#include <QEvent>
+#include <QMutex>
+#include <QMutexLocker>
+#include <QStringList>
+#include <QTimer>
+#include <QWidget>
+#include <QtDebug>
+
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <utility>
+#include <vector>
+
+namespace {
+
+    using Clock = std::chrono::steady_clock;
+
+    /// 进程启动时间（静态初始化发生在 main 之前，与进程创建只差动态库加载）
+    const Clock::time_point kProcessStart = Clock::now();
+
+    /**
+     * @brief 已记录的阶段
+     */
+    struct Phase {
+        const char* name; ///< 阶段名称
+        double atMs;      ///< 相对进程启动的时间
+    };
+
+    QMutex s_mutex;                     ///< 保护 s_phases
+    std::vector<Phase> s_phases;        ///< 已记录的阶段（按时间顺序）
+    std::atomic<bool> s_finished{false}; ///< 时间线是否已结束
+
+    /**
+     * @brief 是否在日志中输出启动阶段
+     */
+    bool loggingEnabled()
+    {
+        static const bool enabled = qEnvironmentVariableIsSet("AURORAPLAYER_STARTUP_LOG");
+        return enabled;
+    }
+
+    /**
+     * @brief 等待窗口首次绘制的事件过滤器
+     *
+     * 收到第一次 Paint 后在下一轮事件循环调用回调（此时首帧已提交到窗口系统），
+     * 随后移除自身。
+     */
+    class FirstExposeFilter : public QObject
+    {
+    public:
+        FirstExposeFilter(QWidget* window, std::function<void()> callback)
+            : QObject(window)
+            , m_callback(std::move(callback))
+        {
+            window->installEventFilter(this);
+        }
+
+    protected:
+        bool eventFilter(QObject* watched, QEvent* event) override
+        {
+            if (event->type() == QEvent::Paint && m_callback) {
+                watched->removeEventFilter(this);
+                std::function<void()> callback = std::move(m_callback);
+                m_callback = nullptr;
+                QTimer::singleShot(0, watched, [callback]() { callback(); });
+                deleteLater();
+            }
+            return QObject::eventFilter(watched, event);
+        }
+
+    private:
+        std::function<void()> m_callback; ///< 首次绘制后的回调
+    };
+
+} // namespace
+
+/**
+ * @brief 记录一个启动阶段
+ *
+ * @param phase 阶段名称（必须是静态字符串）
+ */
+void StartupTimeline::mark(const char* phase)
+{
+    if (s_finished.load(std::memory_order_acquire)) {
+        return;
+    }
+
+    const double atMs = elapsedMs();
+    {
+        QMutexLocker locker(&s_mutex);
+        for (const Phase& existing : s_phases) {
+            if (std::strcmp(existing.name, phase) == 0) {
+                return;
+            }
+        }
+        s_phases.push_back(Phase{phase, atMs});
+    }
+
+    AURORA_TRACE_INSTANT("startup", phase);
+    if (loggingEnabled()) {
+        qInfo().noquote() << QStringLiteral("[startup] %1 at %2 ms").arg(QLatin1String(phase)).arg(atMs, 0, 'f', 1);
+    }
+}
+
+/**
+ * @brief 获取进程启动至今的时间（毫秒）
+ */
+double StartupTimeline::elapsedMs()
+{
+    return std::chrono::duration<double, std::milli>(Clock::now() - kProcessStart).count();
+}
+
+/**
+ * @brief 启动时间线是否已结束
+ */
+bool StartupTimeline::isFinished()
+{
+    return s_finished.load(std::memory_order_acquire);
+}
+
+/**
+ * @brief 结束启动时间线
+ */
+void StartupTimeline::finish()
+{
+    if (s_finished.exchange(true, std::memory_order_acq_rel)) {
+        return;
+    }
+    if (loggingEnabled()) {
+        qInfo().noquote() << QStringLiteral("[startup] %1").arg(summary());
+    }
+}
+
+/**
+ * @brief 生成各阶段的汇总文本
+ */
+QString StartupTimeline::summary()
+{
+    QMutexLocker locker(&s_mutex);
+    QStringList parts;
+    parts.reserve(static_cast<int>(s_phases.size()));
+    for (const Phase& phase : s_phases) {
+        parts.append(QStringLiteral("%1=%2ms").arg(QLatin1String(phase.name)).arg(phase.atMs, 0, 'f', 1));
+    }
+    return parts.join(QLatin1Char(' '));
+}
+
+/**
+ * @brief 在窗口首次绘制到屏幕后调用回调
+ *
+ * @param window   顶层窗口
+ * @param callback 回调
+ */
+void StartupTimeline::onFirstExpose(QWidget* window, std::function<void()> callback)
+{
+    new FirstExposeFilter(window, std::move(callback));
+}
@@ -0,0 +1,75 @@
+/********************************************************************************
+ * @file   : StartupTimeline.h
+ * @brief  : 声明了 StartupTimeline 类。
+ *
+ * 该文件声明了冷启动时间线：启动过程中的各个阶段（创建 QApplication、初始化
+ * FFmpeg、构造主窗口、首次显示、首次绘制、媒体打开、首帧显示）在到达时打点，
+ * 时间相对进程启动计算。每个阶段同时作为瞬时事件写入追踪；设置环境变量
+ * AURORAPLAYER_STARTUP_LOG 时在日志中逐条输出，首帧到达后输出汇总。
+ *
+ * @author : polarours
+ * @date   : 2026/10/18
+ ********************************************************************************/
+
+#ifndef AURORAPLAYER_STARTUPTIMELINE_H
+#define AURORAPLAYER_STARTUPTIMELINE_H
+
+#include <QString>
+
+#include <functional>
+
+// --- 前向声明 --- //
+class QWidget;
+
+class StartupTimeline
+{
+public:
+    /**
+     * @brief 记录一个启动阶段（同一阶段只记录第一次）
+     *
+     * 线程安全，可在任意线程调用。
+     *
+     * @param phase 阶段名称（必须是静态字符串）
+     */
+    static void mark(const char* phase);
+
+    /**
+     * @brief 获取进程启动至今的时间
+     *
+     * @return double 毫秒数（精确到微秒）
+     */
+    static double elapsedMs();
+
+    /**
+     * @brief 启动时间线是否已结束（首帧已显示或已明确结束）
+     *
+     * @return bool 是否已结束
+     */
+    static bool isFinished();
+
+    /**
+     * @brief 结束启动时间线，之后的 mark() 被忽略
+     *
+     * 开启日志时输出各阶段汇总。
+     */
+    static void finish();
+
+    /**
+     * @brief 生成各阶段的汇总文本
+     *
+     * @return QString 形如 "qapplication=12.3ms mainWindow=45.6ms ..." 的文本
+     */
+    static QString summary();
+
+    /**
+     * @brief 在窗口首次绘制到屏幕后调用回调（只调用一次）
+     *
+     * 用于把非必要的工作推迟到首帧窗口之后。
+     *
+     * @param window   顶层窗口
+     * @param callback 回调，在界面线程调用
+     */
+    static void onFirstExpose(QWidget* window, std::function<void()> callback);
+};
+
+#endif // AURORAPLAYER_STARTUPTIMELINE_H
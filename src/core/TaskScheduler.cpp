@@ -0,0 +1,465 @@
+/********************************************************************************
+ * @file   : TaskScheduler.cpp
+ * @brief  : 实现了 TaskScheduler 类。
+ *
+ * @author : polarours
+ * @date   : 2026/10/18
+ ********************************************************************************/
+
+#include "TaskScheduler.h"
+#include "Tracer.h"
+
+#include <QMutexLocker>
+#include <QThread>
+
+namespace {
+
+    constexpr int kMinWorkers = 2; ///< 最少工作线程数
+
+    thread_local int t_workerIndex = -1; ///< 当前线程的工作线程序号，非工作线程为 -1
+
+    /**
+     * @brief 各优先级任务执行时的线程优先级
+     *
+     * Linux 的普通调度策略忽略线程优先级，此时只靠取任务的顺序和后台线程数上限。
+     */
+    QThread::Priority threadPriorityFor(TaskScheduler::Priority priority)
+    {
+        switch (priority) {
+            case TaskScheduler::Priority::Interactive: return QThread::NormalPriority;
+            default:                                   return QThread::LowPriority;
+        }
+    }
+
+} // namespace
+
+// --- Group --- //
+
+TaskScheduler::Group::Group()
+    : m_pending(0)
+{
+}
+
+TaskScheduler::Group::~Group()
+{
+    wait();
+}
+
+/**
+ * @brief 等待组内所有任务结束
+ */
+void TaskScheduler::Group::wait()
+{
+    QMutexLocker locker(&m_mutex);
+    while (m_pending > 0) {
+        m_done.wait(&m_mutex);
+    }
+}
+
+/**
+ * @brief 获取组内未结束的任务数
+ */
+int TaskScheduler::Group::pending() const
+{
+    QMutexLocker locker(&m_mutex);
+    return m_pending;
+}
+
+void TaskScheduler::Group::enter()
+{
+    QMutexLocker locker(&m_mutex);
+    ++m_pending;
+}
+
+void TaskScheduler::Group::leave()
+{
+    // 在锁内唤醒：wait() 返回后所有者可能立即销毁本对象
+    QMutexLocker locker(&m_mutex);
+    if (--m_pending == 0) {
+        m_done.wakeAll();
+    }
+}
+
+// --- ClassStats --- //
+
+/**
+ * @brief 序列化为 JSON
+ */
+QJsonObject TaskScheduler::ClassStats::toJson() const
+{
+    QJsonObject object;
+    object["queued"] = queued;
+    object["running"] = running;
+    object["submitted"] = static_cast<qint64>(submitted);
+    object["completed"] = static_cast<qint64>(completed);
+    object["wait_time"] = waitTime.toJson();
+    object["run_time"] = runTime.toJson();
+    return object;
+}
+
+// --- TaskScheduler --- //
+
+/**
+ * @brief 获取进程内唯一的调度器
+ *
+ * @return TaskScheduler& 调度器
+ */
+TaskScheduler& TaskScheduler::instance()
+{
+    static TaskScheduler scheduler;
+    return scheduler;
+}
+
+/**
+ * @brief 获取优先级名称
+ */
+const char* TaskScheduler::priorityName(Priority priority)
+{
+    switch (priority) {
+        case Priority::Interactive: return "interactive";
+        default:                    return "background";
+    }
+}
+
+/**
+ * @brief 构造函数，按 CPU 核心数启动工作线程
+ */
+TaskScheduler::TaskScheduler()
+    : m_backgroundLimit(0)
+    , m_stopping(false)
+{
+    for (int level = 0; level < kPriorityCount; ++level) {
+        m_queued[level].store(0);
+        m_running[level].store(0);
+        m_submitted[level].store(0);
+        m_completed[level].store(0);
+    }
+
+    const int count = qMax(kMinWorkers, QThread::idealThreadCount());
+    // 后台任务至少留出一个线程给交互任务
+    m_backgroundLimit = count - 1;
+
+    m_workers.reserve(count);
+    for (int i = 0; i < count; ++i) {
+        m_workers.push_back(std::make_unique<Worker>());
+    }
+    for (int i = 0; i < count; ++i) {
+        QThread* thread = QThread::create([this, i]() { workerLoop(i); });
+        thread->setObjectName(QStringLiteral("TaskWorker%1").arg(i));
+        m_workers[i]->thread = thread;
+        thread->start();
+    }
+}
+
+/**
+ * @brief 析构函数，停止并等待所有工作线程
+ */
+TaskScheduler::~TaskScheduler()
+{
+    {
+        QMutexLocker locker(&m_idleMutex);
+        m_stopping.store(true);
+        m_wake.wakeAll();
+    }
+    for (const auto& worker : m_workers) {
+        worker->thread->wait();
+        delete worker->thread;
+    }
+}
+
+/**
+ * @brief 提交任务
+ *
+ * @param priority 优先级
+ * @param task     任务
+ * @param group    所属任务组
+ */
+void TaskScheduler::submit(Priority priority, std::function<void()> task, Group* group)
+{
+    const int level = static_cast<int>(priority);
+    if (group) {
+        group->enter();
+    }
+
+    Task item;
+    item.run = std::move(task);
+    item.group = group;
+    item.queuedUs = PlayerMetrics::nowUs();
+
+    m_submitted[level].fetch_add(1, std::memory_order_relaxed);
+    m_queued[level].fetch_add(1, std::memory_order_release);
+
+    const int index = t_workerIndex;
+    if (index >= 0 && index < static_cast<int>(m_workers.size())) {
+        Worker& worker = *m_workers[index];
+        QMutexLocker locker(&worker.mutex);
+        worker.queues[level].push_back(std::move(item));
+    } else {
+        QMutexLocker locker(&m_globalMutex);
+        m_global[level].push_back(std::move(item));
+    }
+    AURORA_TRACE_COUNTER("tasks", priorityName(priority), m_queued[level].load(std::memory_order_relaxed));
+
+    wakeOne();
+}
+
+/**
+ * @brief 并行执行 count 个互不依赖的子任务
+ *
+ * 最多提交 min(count, 工作线程数) - 1 个领取任务，调用线程作为最后一个参与者。
+ * 调用线程只等待已被领取的子任务执行完，不等待尚未启动的领取任务：在工作线程
+ * 中调用时领取任务进入该线程自己的队列，可能一直没有其他线程来窃取。领取任务
+ * 晚启动时子任务已被领完，直接返回；它只持有共享状态，不访问调用方的栈。
+ *
+ * @param priority 优先级
+ * @param count    子任务数
+ * @param body     子任务函数
+ */
+void TaskScheduler::runParallel(Priority priority, int count, const std::function<void(int)>& body)
+{
+    if (count <= 0) {
+        return;
+    }
+
+    struct State {
+        std::atomic<int> next{0};     ///< 下一个待领取的子任务
+        std::atomic<int> finished{0}; ///< 已执行完的子任务数
+        QMutex mutex;                 ///< 保护完成等待
+        QWaitCondition done;          ///< 全部子任务执行完
+    };
+    auto state = std::make_shared<State>();
+
+    // 只有领取到子任务（i < count）时才访问 body，此时调用方必然还在等待
+    auto drain = [state, body = &body, count]() {
+        for (int i = state->next.fetch_add(1, std::memory_order_relaxed); i < count;
+             i = state->next.fetch_add(1, std::memory_order_relaxed)) {
+            (*body)(i);
+            if (state->finished.fetch_add(1, std::memory_order_acq_rel) + 1 == count) {
+                QMutexLocker locker(&state->mutex);
+                state->done.wakeAll();
+            }
+        }
+    };
+
+    const int helpers = qMin(count, workerCount()) - 1;
+    for (int i = 0; i < helpers; ++i) {
+        submit(priority, drain);
+    }
+    drain();
+
+    QMutexLocker locker(&state->mutex);
+    while (state->finished.load(std::memory_order_acquire) < count) {
+        state->done.wait(&state->mutex);
+    }
+}
+
+/**
+ * @brief 获取工作线程数
+ */
+int TaskScheduler::workerCount() const
+{
+    return static_cast<int>(m_workers.size());
+}
+
+/**
+ * @brief 获取后台任务可同时占用的工作线程数
+ */
+int TaskScheduler::backgroundLimit() const
+{
+    return m_backgroundLimit;
+}
+
+/**
+ * @brief 获取某一优先级的统计
+ */
+TaskScheduler::ClassStats TaskScheduler::stats(Priority priority) const
+{
+    const int level = static_cast<int>(priority);
+    ClassStats result;
+    result.queued = m_queued[level].load(std::memory_order_relaxed);
+    result.running = m_running[level].load(std::memory_order_relaxed);
+    result.submitted = m_submitted[level].load(std::memory_order_relaxed);
+    result.completed = m_completed[level].load(std::memory_order_relaxed);
+    result.waitTime = m_waitTime[level].summary();
+    result.runTime = m_runTime[level].summary();
+    return result;
+}
+
+/**
+ * @brief 将所有优先级的统计序列化为 JSON
+ */
+QJsonObject TaskScheduler::toJson() const
+{
+    QJsonObject object;
+    object["workers"] = workerCount();
+    object["background_limit"] = m_backgroundLimit;
+    for (int level = 0; level < kPriorityCount; ++level) {
+        const Priority priority = static_cast<Priority>(level);
+        object[QLatin1String(priorityName(priority))] = stats(priority).toJson();
+    }
+    return object;
+}
+
+/**
+ * @brief 工作线程主循环
+ *
+ * @param index 工作线程序号
+ */
+void TaskScheduler::workerLoop(int index)
+{
+    t_workerIndex = index;
+    AURORA_TRACE_THREAD_NAME(QStringLiteral("task%1").arg(index));
+    QThread::Priority currentPriority = QThread::NormalPriority;
+
+    while (!m_stopping.load(std::memory_order_relaxed)) {
+        Task task;
+        Priority priority = Priority::Background;
+        if (!findTask(index, &task, &priority)) {
+            // 提交方在入队后才获取 m_idleMutex 唤醒，这里在锁内复查，不会错过唤醒
+            QMutexLocker locker(&m_idleMutex);
+            if (!m_stopping.load(std::memory_order_relaxed) && !hasRunnableTask()) {
+                m_wake.wait(&m_idleMutex);
+            }
+            continue;
+        }
+
+        const int level = static_cast<int>(priority);
+        const QThread::Priority threadPriority = threadPriorityFor(priority);
+        if (threadPriority != currentPriority) {
+            QThread::currentThread()->setPriority(threadPriority);
+            currentPriority = threadPriority;
+        }
+
+        const qint64 startUs = PlayerMetrics::nowUs();
+        m_waitTime[level].record(startUs - task.queuedUs);
+        task.run();
+        m_runTime[level].record(PlayerMetrics::nowUs() - startUs);
+
+        // 先释放任务持有的资源，再通知任务组结束
+        task.run = nullptr;
+        m_completed[level].fetch_add(1, std::memory_order_relaxed);
+        m_running[level].fetch_sub(1, std::memory_order_release);
+        if (task.group) {
+            task.group->leave();
+        }
+
+        // 后台名额空出，排队的后台任务可能又可以执行了
+        if (priority == Priority::Background && m_queued[level].load(std::memory_order_acquire) > 0) {
+            wakeOne();
+        }
+    }
+}
+
+/**
+ * @brief 按优先级查找一个可执行的任务
+ *
+ * @param index    工作线程序号
+ * @param task     输出：任务
+ * @param priority 输出：任务优先级
+ * @return bool 是否找到
+ */
+bool TaskScheduler::findTask(int index, Task* task, Priority* priority)
+{
+    for (int level = 0; level < kPriorityCount; ++level) {
+        if (m_queued[level].load(std::memory_order_acquire) == 0) {
+            continue;
+        }
+
+        const bool background = level == static_cast<int>(Priority::Background);
+        if (background) {
+            // 先占用后台名额再取任务，保证后台任务不会占满所有线程
+            int running = m_running[level].load(std::memory_order_relaxed);
+            do {
+                if (running >= m_backgroundLimit) {
+                    return false;
+                }
+            } while (!m_running[level].compare_exchange_weak(running, running + 1, std::memory_order_acq_rel));
+        }
+
+        if (takeTask(index, level, task)) {
+            if (!background) {
+                m_running[level].fetch_add(1, std::memory_order_relaxed);
+            }
+            *priority = static_cast<Priority>(level);
+            return true;
+        }
+
+        if (background) {
+            m_running[level].fetch_sub(1, std::memory_order_release);
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief 在指定优先级的队列中取出一个任务
+ *
+ * 本地队列从尾部取（最近提交的任务），公共队列和其他线程的队列从头部取
+ * （最早提交的任务），窃取方与队列所有者在两端操作，减少争用。
+ */
+bool TaskScheduler::takeTask(int index, int level, Task* task)
+{
+    auto take = [this, level, task](std::deque<Task>& queue, bool newest) {
+        if (queue.empty()) {
+            return false;
+        }
+        if (newest) {
+            *task = std::move(queue.back());
+            queue.pop_back();
+        } else {
+            *task = std::move(queue.front());
+            queue.pop_front();
+        }
+        m_queued[level].fetch_sub(1, std::memory_order_relaxed);
+        return true;
+    };
+
+    {
+        Worker& own = *m_workers[index];
+        QMutexLocker locker(&own.mutex);
+        if (take(own.queues[level], true)) {
+            return true;
+        }
+    }
+    {
+        QMutexLocker locker(&m_globalMutex);
+        if (take(m_global[level], false)) {
+            return true;
+        }
+    }
+
+    const int count = static_cast<int>(m_workers.size());
+    for (int offset = 1; offset < count; ++offset) {
+        Worker& victim = *m_workers[(index + offset) % count];
+        QMutexLocker locker(&victim.mutex);
+        if (take(victim.queues[level], false)) {
+            AURORA_TRACE_INSTANT("tasks", "steal");
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief 是否有当前允许执行的排队任务
+ */
+bool TaskScheduler::hasRunnableTask() const
+{
+    const int background = static_cast<int>(Priority::Background);
+    for (int level = 0; level < background; ++level) {
+        if (m_queued[level].load(std::memory_order_acquire) > 0) {
+            return true;
+        }
+    }
+    return m_queued[background].load(std::memory_order_acquire) > 0
+        && m_running[background].load(std::memory_order_acquire) < m_backgroundLimit;
+}
+
+/**
+ * @brief 唤醒一个空闲的工作线程
+ */
+void TaskScheduler::wakeOne()
+{
+    QMutexLocker locker(&m_idleMutex);
+    m_wake.wakeOne();
+}
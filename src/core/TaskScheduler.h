@@ -0,0 +1,263 @@
+/********************************************************************************
+ * @file   : TaskScheduler.h
+ * @brief  : 声明了 TaskScheduler 类。
+ *
+ * 该文件声明了进程内共享的任务调度器：固定数量的工作线程，每个线程有自己的
+ * 任务队列，空闲时从其他线程的队列尾部窃取任务。任务分为两个优先级，工作线程
+ * 总是先取交互任务；后台任务最多占用除一个以外的全部工作线程，保证交互任务
+ * 随时有线程可用。文件夹导入、元数据探测、重复文件查找、播放列表加载和播放
+ * 列表排序都向它提交任务，不再各自创建线程池。播放的解复用和解码循环在整个
+ * 会话期间阻塞在包队列上，仍然运行在各自的专用线程上。
+ *
+ * @author : polarours
+ * @date   : 2026/10/18
+ ********************************************************************************/
+
+#ifndef AURORAPLAYER_TASKSCHEDULER_H
+#define AURORAPLAYER_TASKSCHEDULER_H
+
+#include <QJsonObject>
+#include <QMutex>
+#include <QWaitCondition>
+#include <QtGlobal>
+
+#include <array>
+#include <atomic>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "Metrics.h"
+
+// --- 前向声明 --- //
+class QThread;
+
+class TaskScheduler
+{
+public:
+    /**
+     * @brief 任务优先级
+     */
+    enum class Priority {
+        Interactive, ///< 用户正在等待结果（可见行的探测、打开播放列表、排序）
+        Background   ///< 批量工作（导入、探测、哈希）
+    };
+
+    static constexpr int kPriorityCount = 2; ///< 优先级数量
+
+    /**
+     * @class Group
+     * @brief 一组任务的完成计数
+     *
+     * 提交任务的对象持有一个 Group，析构前调用 wait() 等待自己的任务结束，
+     * 相当于原先独占线程池的 waitForDone()，但不会等待其他模块的任务。
+     */
+    class Group
+    {
+    public:
+        Group();
+
+        /**
+         * @brief 析构函数，等待组内任务结束
+         */
+        ~Group();
+
+        Group(const Group&) = delete;
+        Group& operator=(const Group&) = delete;
+
+        /**
+         * @brief 等待组内所有任务结束
+         */
+        void wait();
+
+        /**
+         * @brief 获取组内未结束的任务数
+         *
+         * @return int 任务数
+         */
+        int pending() const;
+
+    private:
+        friend class TaskScheduler;
+
+        void enter();
+        void leave();
+
+    private:
+        mutable QMutex m_mutex;  ///< 保护 m_pending
+        QWaitCondition m_done;   ///< 任务全部结束
+        int m_pending;           ///< 未结束的任务数
+    };
+
+    /**
+     * @struct ClassStats
+     * @brief 某一优先级的统计
+     */
+    struct ClassStats {
+        int queued = 0;               ///< 排队中的任务数
+        int running = 0;              ///< 正在执行的任务数
+        quint64 submitted = 0;        ///< 累计提交的任务数
+        quint64 completed = 0;        ///< 累计完成的任务数
+        HistogramSummary waitTime;    ///< 从提交到开始执行的等待时间
+        HistogramSummary runTime;     ///< 执行时间
+
+        /**
+         * @brief 序列化为 JSON
+         *
+         * @return QJsonObject JSON 对象
+         */
+        QJsonObject toJson() const;
+    };
+
+    /**
+     * @brief 获取进程内唯一的调度器（首次调用时启动工作线程）
+     *
+     * @return TaskScheduler& 调度器
+     */
+    static TaskScheduler& instance();
+
+    /**
+     * @brief 获取优先级名称
+     *
+     * @param priority 优先级
+     * @return const char* 名称
+     */
+    static const char* priorityName(Priority priority);
+
+    /**
+     * @brief 析构函数，停止并等待所有工作线程（排队中的任务被丢弃）
+     */
+    ~TaskScheduler();
+
+    TaskScheduler(const TaskScheduler&) = delete;
+    TaskScheduler& operator=(const TaskScheduler&) = delete;
+
+    /**
+     * @brief 提交任务
+     *
+     * 在工作线程内提交的任务放入该线程自己的队列（后进先出，利于缓存），
+     * 其他线程提交的任务放入公共队列。
+     *
+     * @param priority 优先级
+     * @param task     任务
+     * @param group    所属任务组，可为 nullptr
+     */
+    void submit(Priority priority, std::function<void()> task, Group* group = nullptr);
+
+    /**
+     * @brief 并行执行 count 个互不依赖的子任务，返回时全部完成
+     *
+     * 调用线程本身也领取子任务执行，并且只等待已被其他线程领取的子任务，
+     * 因此不依赖空闲的工作线程才能推进，也可以在工作线程中调用；子任务按序号
+     * 从共享计数器领取，负载不均时先完成的线程继续领取。
+     *
+     * @param priority 优先级
+     * @param count    子任务数
+     * @param body     子任务函数，参数为序号 [0, count)，须可在多个线程同时调用
+     */
+    void runParallel(Priority priority, int count, const std::function<void(int)>& body);
+
+    /**
+     * @brief 获取工作线程数
+     *
+     * @return int 工作线程数
+     */
+    int workerCount() const;
+
+    /**
+     * @brief 获取后台任务可同时占用的工作线程数
+     *
+     * @return int 线程数
+     */
+    int backgroundLimit() const;
+
+    /**
+     * @brief 获取某一优先级的统计
+     *
+     * @param priority 优先级
+     * @return ClassStats 统计
+     */
+    ClassStats stats(Priority priority) const;
+
+    /**
+     * @brief 将所有优先级的统计序列化为 JSON
+     *
+     * @return QJsonObject JSON 对象
+     */
+    QJsonObject toJson() const;
+
+private:
+    /**
+     * @brief 排队中的任务
+     */
+    struct Task {
+        std::function<void()> run; ///< 任务函数
+        Group* group = nullptr;    ///< 所属任务组
+        qint64 queuedUs = 0;       ///< 提交时间
+    };
+
+    /**
+     * @brief 工作线程及其本地队列
+     */
+    struct Worker {
+        QMutex mutex;                                        ///< 保护 queues
+        std::array<std::deque<Task>, kPriorityCount> queues; ///< 各优先级的本地队列
+        QThread* thread = nullptr;                           ///< 线程
+    };
+
+    TaskScheduler();
+
+    /**
+     * @brief 工作线程主循环
+     *
+     * @param index 工作线程序号
+     */
+    void workerLoop(int index);
+
+    /**
+     * @brief 按优先级查找一个可执行的任务：本地队列、公共队列、其他线程的队列
+     *
+     * @param index    工作线程序号
+     * @param task     输出：任务
+     * @param priority 输出：任务优先级
+     * @return bool 是否找到
+     */
+    bool findTask(int index, Task* task, Priority* priority);
+
+    /**
+     * @brief 在指定优先级的队列中取出一个任务
+     */
+    bool takeTask(int index, int level, Task* task);
+
+    /**
+     * @brief 是否有当前允许执行的排队任务
+     */
+    bool hasRunnableTask() const;
+
+    /**
+     * @brief 唤醒一个空闲的工作线程
+     */
+    void wakeOne();
+
+private:
+    std::vector<std::unique_ptr<Worker>> m_workers;           ///< 工作线程
+    int m_backgroundLimit;                                    ///< 后台任务可占用的线程数
+
+    QMutex m_globalMutex;                                     ///< 保护 m_global
+    std::array<std::deque<Task>, kPriorityCount> m_global;    ///< 公共队列
+
+    QMutex m_idleMutex;                                       ///< 空闲等待
+    QWaitCondition m_wake;                                    ///< 有新任务或正在停止
+    std::atomic<bool> m_stopping;                             ///< 是否正在停止
+
+    // --- 统计 --- //
+    std::array<std::atomic<int>, kPriorityCount> m_queued;         ///< 排队中的任务数
+    std::array<std::atomic<int>, kPriorityCount> m_running;        ///< 正在执行的任务数
+    std::array<std::atomic<quint64>, kPriorityCount> m_submitted;  ///< 累计提交数
+    std::array<std::atomic<quint64>, kPriorityCount> m_completed;  ///< 累计完成数
+    std::array<LatencyHistogram, kPriorityCount> m_waitTime;       ///< 等待时间
+    std::array<LatencyHistogram, kPriorityCount> m_runTime;        ///< 执行时间
+};
+
+#endif // AURORAPLAYER_TASKSCHEDULER_H
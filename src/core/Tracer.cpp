@@ -0,0 +1,285 @@
+/********************************************************************************
+ * @file   : Tracer.cpp
+ * @brief  : 实现了 Tracer 类。
+ *
+ * 每个线程首次记录事件时分配一个固定容量的环形缓冲区并登记到全局列表。
+ * 写入端只有所属线程（单生产者），发布时使用 release 存储；导出端读取时
+ * 使用 acquire，并丢弃复制期间可能被覆盖的槽位，因此记录路径上没有锁。
+ *
+ * @author : polarours
+ * @date   : 2026/10/18
+ ********************************************************************************/
+
+#include "Tracer.h"
+
+#include <QCoreApplication>
+#include <QFile>
+#include <QDebug>
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace {
+
+    // --- 事件类型 --- //
+    enum class EventKind : uint8_t {
+        Complete, ///< 完整事件（带持续时间）
+        Instant,  ///< 瞬时事件
+        Counter   ///< 计数器
+    };
+
+    /**
+     * @brief 单个追踪事件（POD，便于无锁复制）
+     */
+    struct TraceEvent {
+        const char* category; ///< 分类（静态字符串）
+        const char* name;     ///< 名称（静态字符串）
+        int64_t timestamp;    ///< 时间戳（微秒）
+        int64_t value;        ///< 持续时间（微秒）或计数器值
+        EventKind kind;       ///< 事件类型
+    };
+
+    constexpr uint64_t kBufferCapacity = 1u << 15; ///< 每线程事件容量（2 的幂）
+    constexpr uint64_t kBufferMask = kBufferCapacity - 1;
+
+    /**
+     * @brief 每线程环形缓冲区
+     */
+    struct ThreadBuffer {
+        explicit ThreadBuffer(int id) : threadId(id), head(0), floor(0), events(kBufferCapacity) {}
+
+        int threadId;                   ///< 追踪视图中的线程 ID
+        QString threadName;             ///< 线程名称（受注册表互斥锁保护）
+        std::atomic<uint64_t> head;     ///< 已发布事件总数（仅所属线程写入）
+        std::atomic<uint64_t> floor;    ///< 导出起点（clear() 推进）
+        std::vector<TraceEvent> events; ///< 事件槽位
+    };
+
+    /**
+     * @brief 全局缓冲区注册表，仅在线程首次记录和导出时加锁
+     */
+    struct Registry {
+        std::mutex mutex;
+        std::vector<std::unique_ptr<ThreadBuffer>> buffers;
+    };
+
+    Registry& registry()
+    {
+        // 故意泄漏：线程退出后其事件仍需可导出，进程退出时也不必析构
+        static Registry* instance = new Registry;
+        return *instance;
+    }
+
+    const std::chrono::steady_clock::time_point kEpoch = std::chrono::steady_clock::now();
+
+    thread_local ThreadBuffer* t_buffer = nullptr;
+
+    ThreadBuffer* threadBuffer()
+    {
+        if (!t_buffer) {
+            Registry& reg = registry();
+            std::lock_guard<std::mutex> lock(reg.mutex);
+            reg.buffers.push_back(std::make_unique<ThreadBuffer>(static_cast<int>(reg.buffers.size()) + 1));
+            t_buffer = reg.buffers.back().get();
+        }
+        return t_buffer;
+    }
+
+    void pushEvent(const TraceEvent& event)
+    {
+        ThreadBuffer* buffer = threadBuffer();
+        const uint64_t index = buffer->head.load(std::memory_order_relaxed);
+        buffer->events[index & kBufferMask] = event;
+        buffer->head.store(index + 1, std::memory_order_release);
+    }
+
+    /**
+     * @brief 追加 JSON 字符串（UTF-8），转义引号、反斜杠和控制字符
+     *
+     * 事件名是静态标识符，但线程名由调用方传入，可能包含任意字符。
+     */
+    void appendJsonString(QByteArray& out, const char* text)
+    {
+        static const char kHex[] = "0123456789abcdef";
+        out.append('"');
+        for (const char* p = text; *p; ++p) {
+            const uchar c = static_cast<uchar>(*p);
+            if (c == '"' || c == '\\') {
+                out.append('\\').append(*p);
+            } else if (c < 0x20) {
+                out.append("\\u00").append(kHex[c >> 4]).append(kHex[c & 0xf]);
+            } else {
+                out.append(*p);
+            }
+        }
+        out.append('"');
+    }
+
+} // namespace
+
+std::atomic<bool> Tracer::s_enabled{false};
+
+/**
+ * @brief 运行期启用/关闭追踪
+ *
+ * @param enabled 是否启用
+ */
+void Tracer::setEnabled(bool enabled)
+{
+    s_enabled.store(enabled, std::memory_order_relaxed);
+}
+
+/**
+ * @brief 获取当前时间戳（微秒）
+ *
+ * @return int64_t 时间戳
+ */
+int64_t Tracer::now()
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+               std::chrono::steady_clock::now() - kEpoch).count();
+}
+
+/**
+ * @brief 记录一个完整事件
+ */
+void Tracer::recordComplete(const char* category, const char* name, int64_t startUs, int64_t durUs)
+{
+    pushEvent({category, name, startUs, durUs, EventKind::Complete});
+}
+
+/**
+ * @brief 记录一个瞬时事件
+ */
+void Tracer::recordInstant(const char* category, const char* name)
+{
+    pushEvent({category, name, now(), 0, EventKind::Instant});
+}
+
+/**
+ * @brief 记录一个计数器采样
+ */
+void Tracer::recordCounter(const char* category, const char* name, int64_t value)
+{
+    pushEvent({category, name, now(), value, EventKind::Counter});
+}
+
+/**
+ * @brief 为当前线程设置名称
+ *
+ * @param name 线程名称
+ */
+void Tracer::setThreadName(const QString& name)
+{
+    ThreadBuffer* buffer = threadBuffer();
+    std::lock_guard<std::mutex> lock(registry().mutex);
+    buffer->threadName = name;
+}
+
+/**
+ * @brief 导出 Chrome trace_event JSON
+ *
+ * @param filePath 输出文件路径
+ * @return bool 是否写入成功
+ */
+bool Tracer::writeChromeTrace(const QString& filePath)
+{
+    QFile file(filePath);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        qWarning() << "Failed to open trace file:" << filePath;
+        return false;
+    }
+
+    const qint64 pid = QCoreApplication::applicationPid();
+    QByteArray out;
+    out.reserve(1 << 20);
+    out.append("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[");
+    bool first = true;
+
+    auto separator = [&]() {
+        if (!first) {
+            out.append(",\n");
+        }
+        first = false;
+    };
+
+    std::lock_guard<std::mutex> lock(registry().mutex);
+    std::vector<TraceEvent> snapshot;
+    snapshot.reserve(kBufferCapacity);
+
+    for (const auto& buffer : registry().buffers) {
+        // 线程名元数据事件
+        if (!buffer->threadName.isEmpty()) {
+            separator();
+            out.append("{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":").append(QByteArray::number(pid));
+            out.append(",\"tid\":").append(QByteArray::number(buffer->threadId));
+            out.append(",\"args\":{\"name\":");
+            appendJsonString(out, buffer->threadName.toUtf8().constData());
+            out.append("}}");
+        }
+
+        // 先复制再校验：复制期间被写入端覆盖的槽位全部丢弃
+        const uint64_t headBefore = buffer->head.load(std::memory_order_acquire);
+        const uint64_t begin = std::max(headBefore > kBufferCapacity ? headBefore - kBufferCapacity : 0,
+                                        buffer->floor.load(std::memory_order_relaxed));
+        snapshot.clear();
+        for (uint64_t i = begin; i < headBefore; ++i) {
+            snapshot.push_back(buffer->events[i & kBufferMask]);
+        }
+        std::atomic_thread_fence(std::memory_order_acquire);
+        const uint64_t headAfter = buffer->head.load(std::memory_order_relaxed);
+        const uint64_t firstValid = headAfter >= kBufferCapacity ? headAfter - kBufferCapacity + 1 : 0;
+
+        for (uint64_t i = begin; i < headBefore; ++i) {
+            if (i < firstValid) {
+                continue;
+            }
+            const TraceEvent& event = snapshot[i - begin];
+            separator();
+            out.append("{\"name\":");
+            appendJsonString(out, event.name);
+            out.append(",\"cat\":");
+            appendJsonString(out, event.category);
+            switch (event.kind) {
+                case EventKind::Complete:
+                    out.append(",\"ph\":\"X\",\"dur\":").append(QByteArray::number(event.value));
+                    break;
+                case EventKind::Instant:
+                    out.append(",\"ph\":\"i\",\"s\":\"t\"");
+                    break;
+                case EventKind::Counter:
+                    out.append(",\"ph\":\"C\",\"args\":{\"value\":").append(QByteArray::number(event.value)).append('}');
+                    break;
+            }
+            out.append(",\"ts\":").append(QByteArray::number(event.timestamp));
+            out.append(",\"pid\":").append(QByteArray::number(pid));
+            out.append(",\"tid\":").append(QByteArray::number(buffer->threadId));
+            out.append('}');
+
+            if (out.size() > (1 << 20)) {
+                file.write(out);
+                out.clear();
+            }
+        }
+    }
+
+    out.append("]}\n");
+    file.write(out);
+    return file.error() == QFileDevice::NoError;
+}
+
+/**
+ * @brief 清空所有线程缓冲区
+ *
+ * head 只能由所属线程写入，因此这里只推进导出起点。
+ */
+void Tracer::clear()
+{
+    std::lock_guard<std::mutex> lock(registry().mutex);
+    for (const auto& buffer : registry().buffers) {
+        buffer->floor.store(buffer->head.load(std::memory_order_acquire), std::memory_order_relaxed);
+    }
+}
@@ -0,0 +1,152 @@
+/********************************************************************************
+ * @file   : Tracer.h
+ * @brief  : 声明了 Tracer 类及分阶段追踪宏。
+ *
+ * 该文件声明了低开销的作用域追踪事件。事件写入每个线程独立的无锁环形缓冲区，
+ * 可按需导出为 Chrome trace_event JSON，在 Perfetto / chrome://tracing 中查看。
+ *
+ * 编译期开关：AURORAPLAYER_ENABLE_TRACING（未定义时所有宏展开为空）。
+ * 运行期开关：Tracer::setEnabled()（关闭时每个作用域仅一次 relaxed 原子读）。
+ *
+ * @author : polarours
+ * @date   : 2026/10/18
+ ********************************************************************************/
+
+#ifndef AURORAPLAYER_TRACER_H
+#define AURORAPLAYER_TRACER_H
+
+#include <QString>
+
+#include <atomic>
+#include <cstdint>
+
+class Tracer
+{
+public:
+    /**
+     * @brief 获取追踪是否在运行期启用
+     *
+     * @return bool 是否启用
+     */
+    static bool isEnabled()
+    {
+        return s_enabled.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief 运行期启用/关闭追踪
+     *
+     * @param enabled 是否启用
+     */
+    static void setEnabled(bool enabled);
+
+    /**
+     * @brief 获取当前时间戳（微秒，相对进程内追踪起点）
+     *
+     * @return int64_t 时间戳
+     */
+    static int64_t now();
+
+    /**
+     * @brief 记录一个完整事件（Chrome trace 中的 "X" 事件）
+     *
+     * @param category 分类（必须是静态字符串）
+     * @param name     名称（必须是静态字符串）
+     * @param startUs  开始时间戳（微秒）
+     * @param durUs    持续时间（微秒）
+     */
+    static void recordComplete(const char* category, const char* name, int64_t startUs, int64_t durUs);
+
+    /**
+     * @brief 记录一个瞬时事件（Chrome trace 中的 "i" 事件）
+     *
+     * @param category 分类（必须是静态字符串）
+     * @param name     名称（必须是静态字符串）
+     */
+    static void recordInstant(const char* category, const char* name);
+
+    /**
+     * @brief 记录一个计数器采样（Chrome trace 中的 "C" 事件）
+     *
+     * @param category 分类（必须是静态字符串）
+     * @param name     名称（必须是静态字符串）
+     * @param value    采样值
+     */
+    static void recordCounter(const char* category, const char* name, int64_t value);
+
+    /**
+     * @brief 为当前线程设置在追踪视图中显示的名称
+     *
+     * @param name 线程名称
+     */
+    static void setThreadName(const QString& name);
+
+    /**
+     * @brief 将所有线程缓冲区中的事件导出为 Chrome trace_event JSON
+     *
+     * @param filePath 输出文件路径
+     * @return bool 是否写入成功
+     */
+    static bool writeChromeTrace(const QString& filePath);
+
+    /**
+     * @brief 清空所有线程缓冲区
+     */
+    static void clear();
+
+private:
+    static std::atomic<bool> s_enabled; ///< 运行期开关
+};
+
+/**
+ * @class TraceScope
+ * @brief 作用域追踪事件
+ *
+ * 构造时记录开始时间，析构时写入一个完整事件。追踪关闭时不读取时钟。
+ */
+class TraceScope
+{
+public:
+    TraceScope(const char* category, const char* name)
+        : m_category(category)
+        , m_name(name)
+        , m_start(Tracer::isEnabled() ? Tracer::now() : -1)
+    {
+    }
+
+    ~TraceScope()
+    {
+        if (m_start >= 0) {
+            Tracer::recordComplete(m_category, m_name, m_start, Tracer::now() - m_start);
+        }
+    }
+
+    TraceScope(const TraceScope&) = delete;
+    TraceScope& operator=(const TraceScope&) = delete;
+
+private:
+    const char* m_category; ///< 分类
+    const char* m_name;     ///< 名称
+    int64_t m_start;        ///< 开始时间戳，-1 表示未记录
+};
+
+// --- 追踪宏 --- //
+#define AURORA_TRACE_CONCAT_INNER(a, b) a##b
+#define AURORA_TRACE_CONCAT(a, b) AURORA_TRACE_CONCAT_INNER(a, b)
+
+#ifdef AURORAPLAYER_ENABLE_TRACING
+#define AURORA_TRACE_SCOPE(category, name) \
+    TraceScope AURORA_TRACE_CONCAT(auroraTraceScope_, __LINE__)(category, name)
+#define AURORA_TRACE_INSTANT(category, name) \
+    do { if (Tracer::isEnabled()) Tracer::recordInstant(category, name); } while (0)
+#define AURORA_TRACE_COUNTER(category, name, value) \
+    do { if (Tracer::isEnabled()) Tracer::recordCounter(category, name, (value)); } while (0)
+#define AURORA_TRACE_THREAD_NAME(name) Tracer::setThreadName(name)
+#else
+#define AURORA_TRACE_SCOPE(category, name) do {} while (0)
+#define AURORA_TRACE_INSTANT(category, name) do {} while (0)
+#define AURORA_TRACE_COUNTER(category, name, value) do {} while (0)
+#define AURORA_TRACE_THREAD_NAME(name) do {} while (0)
+#endif
+
+#endif // AURORAPLAYER_TRACER_H
@@ -9,10 +9,64 @@
  ********************************************************************************/
 
 #include <QApplication>
+#include <QCommandLineParser>
+#include <QFileInfo>
+#include <QGuiApplication>
 
+#include "core/LibraryIndex.h"
+#include "core/PlaybackBackend.h"
+#include "core/SingleInstance.h"
+#include "core/StartupTimeline.h"
+#include "core/Tracer.h"
+#include "player/HeadlessPlayer.h"
+#include "player/MetadataService.h"
+#include "player/PlayerController.h"
 #include "ui/MainWindow.h"
+#include "ui/VideoWallWindow.h"
 #include "utils/Utils.h"
 
+namespace {
+
+    /**
+     * @brief 设置应用程序信息，并按环境变量开启追踪
+     *
+     * @param app 应用程序对象
+     */
+    void setupApplication(QCoreApplication& app)
+    {
+        // 设置应用程序信息
+        app.setApplicationName("AuroraPlayer");
+        app.setApplicationVersion("1.0.0");
+        app.setOrganizationName("AuroraPlayer");
+
+        // 设置环境变量 AURORAPLAYER_TRACE=<文件> 时从启动开始追踪，退出时导出
+        const QString traceFile = qEnvironmentVariable("AURORAPLAYER_TRACE");
+        if (!traceFile.isEmpty()) {
+            Tracer::setEnabled(true);
+            QObject::connect(&app, &QCoreApplication::aboutToQuit, [traceFile]() {
+                Tracer::writeChromeTrace(traceFile);
+            });
+        }
+        AURORA_TRACE_THREAD_NAME(QStringLiteral("main"));
+    }
+
+    /**
+     * @brief 设置环境变量 AURORAPLAYER_METRICS=<文件> 时定期追加播放指标（JSON Lines）
+     *
+     * @param controller 播放控制器
+     */
+    void setupMetricsDump(PlayerController* controller)
+    {
+        const QString metricsFile = qEnvironmentVariable("AURORAPLAYER_METRICS");
+        if (!metricsFile.isEmpty()) {
+            bool ok = false;
+            const int interval = qEnvironmentVariableIntValue("AURORAPLAYER_METRICS_INTERVAL", &ok);
+            controller->setMetricsDumpFile(metricsFile, ok ? interval : 10000);
+        }
+    }
+
+} // namespace
+
 /**
  * @brief 程序入口。
  *
@@ -20,20 +74,148 @@
  */
 int main(int argc, char *argv[])
 {
+    StartupTimeline::mark("main");
+
+    // 解析命令行：AuroraPlayer [--new-instance] [--headless ... | --wall] [文件...]
+    QCommandLineParser parser;
+    parser.setApplicationDescription(QStringLiteral("AuroraPlayer media player"));
+    parser.addHelpOption();
+    parser.addVersionOption();
+    const QCommandLineOption newInstanceOption(QStringLiteral("new-instance"),
+                                               QStringLiteral("Start a separate player instead of handing files to the running one."));
+    const QCommandLineOption headlessOption(QStringLiteral("headless"),
+                                            QStringLiteral("Play the given files and playlists without a window, then exit."));
+    const QCommandLineOption dumpVideoOption(QStringLiteral("dump-video"),
+                                             QStringLiteral("Headless: append raw decoded video frames to <file>."),
+                                             QStringLiteral("file"));
+    const QCommandLineOption nullAudioOption(QStringLiteral("null-audio"),
+                                             QStringLiteral("Headless: decode audio but discard it in real time instead of using a sound device."));
+    const QCommandLineOption loopOption(QStringLiteral("loop"),
+                                        QStringLiteral("Headless: repeat the playlist until stopped."));
+    const QCommandLineOption durationOption(QStringLiteral("duration"),
+                                            QStringLiteral("Headless: stop after <seconds>."),
+                                            QStringLiteral("seconds"));
+    const QCommandLineOption reportOption(QStringLiteral("report-interval"),
+                                          QStringLiteral("Headless: print a JSON metrics line every <ms> (0 = only at exit)."),
+                                          QStringLiteral("ms"), QStringLiteral("1000"));
+    const QCommandLineOption wallOption(QStringLiteral("wall"),
+                                        QStringLiteral("Play up to 16 files side by side in a video wall on a shared clock."));
+    parser.addOptions({newInstanceOption, headlessOption, dumpVideoOption, nullAudioOption,
+                       loopOption, durationOption, reportOption, wallOption});
+    parser.addPositionalArgument(QStringLiteral("files"), QStringLiteral("Media files to play."), QStringLiteral("[files...]"));
+
+    // 在创建 QApplication 之前解析，已有实例时把文件转交过去后立即退出
+    QStringList arguments;
+    for (int i = 0; i < argc; ++i) {
+        arguments.append(QString::fromLocal8Bit(argv[i]));
+    }
+    const bool parsed = parser.parse(arguments);
+    QStringList files;
+    for (const QString& argument : parser.positionalArguments()) {
+        files.append(AuroraPlayer::Utils::isNetworkUrl(argument) ? argument : QFileInfo(argument).absoluteFilePath());
+    }
+
+    // --- 无界面模式 --- //
+    if (parsed && parser.isSet(headlessOption)) {
+        // 没有显示器时使用 offscreen 平台插件
+        if (!qEnvironmentVariableIsSet("QT_QPA_PLATFORM")) {
+            qputenv("QT_QPA_PLATFORM", "offscreen");
+        }
+        QGuiApplication app(argc, argv);
+        setupApplication(app);
+        parser.process(app);
+
+        AuroraPlayer::Utils::initializeFFmpeg();
+
+        HeadlessPlayer::Options options;
+        options.videoDumpPath = parser.value(dumpVideoOption);
+        options.nullAudio = parser.isSet(nullAudioOption);
+        options.loop = parser.isSet(loopOption);
+        options.durationSec = parser.value(durationOption).toInt();
+        options.reportIntervalMs = parser.value(reportOption).toInt();
+
+        HeadlessPlayer player(options);
+        // 无界面模式默认使用自带的 FFmpeg 引擎，AURORAPLAYER_BACKEND 可覆盖
+        if (!qEnvironmentVariableIsSet("AURORAPLAYER_BACKEND")) {
+            player.controller()->setBackend(PlaybackBackend::Type::FFmpeg);
+        }
+        setupMetricsDump(player.controller());
+        if (!player.start(files)) {
+            return 1;
+        }
+        return app.exec();
+    }
+
+    // --- 视频墙：独立窗口，不转交给已运行的实例 --- //
+    if (parsed && parser.isSet(wallOption)) {
+        QApplication app(argc, argv);
+        setupApplication(app);
+        parser.process(app);
+
+        AuroraPlayer::Utils::initializeFFmpeg();
+
+        auto* wall = new VideoWallWindow(files);
+        wall->show();
+        return app.exec();
+    }
+
+    const bool singleInstance = parsed && !parser.isSet(newInstanceOption)
+                             && !parser.isSet(QStringLiteral("help")) && !parser.isSet(QStringLiteral("version"));
+    if (singleInstance && SingleInstance::forward(files)) {
+        return 0;
+    }
+    StartupTimeline::mark("singleInstance");
+
     // 创建QApplication对象
     QApplication app(argc, argv);
+    StartupTimeline::mark("qapplication");
+    setupApplication(app);
 
-    // 设置应用程序信息
-    app.setApplicationName("AuroraPlayer");
-    app.setApplicationVersion("1.0.0");
-    app.setOrganizationName("AuroraPlayer");
+    // 处理 --help/--version 和解析错误（需要 QApplication）
+    parser.process(app);
 
     // 初始化FFmpeg
     AuroraPlayer::Utils::initializeFFmpeg();
+    StartupTimeline::mark("ffmpeg");
+
+    // 映射媒体库索引：只校验文件头，条目在被访问时才读取
+    LibraryIndex libraryIndex;
+    libraryIndex.open(LibraryIndex::defaultPath());
+    QObject::connect(&app, &QCoreApplication::aboutToQuit, [&libraryIndex]() {
+        libraryIndex.save();
+    });
+    StartupTimeline::mark("libraryIndex");
 
     // 创建主窗口
     MainWindow window;
+    window.controller()->metadataService()->setLibraryIndex(&libraryIndex);
+    StartupTimeline::mark("mainWindow");
     window.show();
+    StartupTimeline::mark("show");
+
+    // 后续启动的实例把文件转交过来：加入播放列表并立即播放，窗口提到前台
+    SingleInstance instance;
+    if (singleInstance) {
+        QObject::connect(&instance, &SingleInstance::filesReceived, &window, [&window](const QStringList& received) {
+            window.openFiles(received, true);
+            window.setWindowState((window.windowState() & ~Qt::WindowMinimized) | Qt::WindowActive);
+            window.raise();
+            window.activateWindow();
+        });
+        instance.listen();
+    }
+
+    // 命令行中的文件在窗口首次绘制后再打开，先让窗口出现
+    StartupTimeline::onFirstExpose(&window, [&window, files]() {
+        StartupTimeline::mark("firstExpose");
+        if (files.isEmpty()) {
+            StartupTimeline::finish();
+            return;
+        }
+        window.openFiles(files);
+    });
+
+    setupMetricsDump(window.controller());
 
     return app.exec();
-}
\ No newline at end of file
+}
@@ -0,0 +1,345 @@
+/********************************************************************************
+ * @file   : DuplicateFinder.cpp
+ * @brief  : 实现了 DuplicateFinder 类。
+ *
+ * @author : polarours
+ * @date   : 2026/10/18
+ ********************************************************************************/
+
+#include "DuplicateFinder.h"
+#include "../core/Tracer.h"
+#include "../utils/ContentHash.h"
+
+#include <QFileInfo>
+#include <QSet>
+#include <QTimer>
+
+#include <algorithm>
+#include <atomic>
+#include <tuple>
+
+namespace {
+
+    constexpr int kFlushIntervalMs = 100; ///< 进度回送间隔（毫秒）
+    constexpr size_t kSizeChunk = 256;    ///< 读取大小阶段每个任务的文件数
+    constexpr size_t kSampleChunk = 16;   ///< 抽样哈希阶段每个任务的文件数
+
+    /**
+     * @brief 单个文件的查找结果
+     */
+    struct FileEntry {
+        QString path;                ///< 文件路径
+        qint64 size = -1;            ///< 文件大小，-1 表示无法读取
+        quint64 sampleHash = 0;      ///< 抽样哈希
+        quint64 fullHash = 0;        ///< 完整哈希
+        bool sampleComplete = false; ///< 抽样是否已覆盖全部内容
+        bool sampled = false;        ///< 抽样哈希是否成功
+        bool confirmed = false;      ///< 完整哈希是否可用
+    };
+
+    /**
+     * @brief 按键排序后取出元素数不少于 2 的组
+     */
+    template <typename Key>
+    std::vector<std::vector<int>> groupBy(std::vector<int> indices, Key key)
+    {
+        std::stable_sort(indices.begin(), indices.end(), [&key](int a, int b) { return key(a) < key(b); });
+
+        std::vector<std::vector<int>> groups;
+        size_t begin = 0;
+        while (begin < indices.size()) {
+            size_t end = begin + 1;
+            while (end < indices.size() && key(indices[end]) == key(indices[begin])) {
+                ++end;
+            }
+            if (end - begin >= 2) {
+                groups.emplace_back(indices.begin() + begin, indices.begin() + end);
+            }
+            begin = end;
+        }
+        return groups;
+    }
+
+} // namespace
+
+/**
+ * @brief 一次查找的共享状态，工作线程任务持有其引用，查找器可随时放弃
+ *
+ * files 在各阶段只被处理本块的任务按下标写入，阶段切换由 pendingTasks 的
+ * acq_rel 递减建立先后关系，因此不需要加锁。
+ */
+struct DuplicateFinder::FindState {
+    TaskScheduler::Group* tasks = nullptr;               ///< 所属任务组
+    std::atomic<bool> cancelled{false};                  ///< 是否已取消
+    std::atomic<int> pendingTasks{0};                    ///< 当前阶段未完成的任务数
+    std::atomic<int> stage{int(Stage::Size)};            ///< 当前阶段
+    std::atomic<int> stageDone{0};                       ///< 当前阶段已处理的文件数
+    std::atomic<int> stageTotal{0};                      ///< 当前阶段需要处理的文件数
+    std::atomic<qint64> bytesRead{0};                    ///< 累计读取的字节数
+    std::atomic<bool> done{false};                       ///< 结果是否已就绪
+    std::vector<FileEntry> files;                        ///< 全部文件
+    std::vector<int> work;                               ///< 当前阶段处理的文件下标
+    QList<QStringList> groups;                           ///< 结果（done 之后只读）
+    qint64 redundantBytes = 0;                           ///< 可节省的字节数（done 之后只读）
+};
+
+/**
+ * @brief 构造函数
+ *
+ * @param parent 父对象
+ */
+DuplicateFinder::DuplicateFinder(QObject* parent)
+    : QObject(parent)
+    , m_flushTimer(new QTimer(this))
+{
+    m_flushTimer->setInterval(kFlushIntervalMs);
+    connect(m_flushTimer, &QTimer::timeout, this, &DuplicateFinder::flush);
+}
+
+/**
+ * @brief 析构函数，取消并等待未完成的任务
+ */
+DuplicateFinder::~DuplicateFinder()
+{
+    if (m_state) {
+        m_state->cancelled.store(true, std::memory_order_relaxed);
+    }
+    m_tasks.wait();
+}
+
+/**
+ * @brief 开始查找
+ *
+ * @param filePaths 文件路径列表
+ */
+void DuplicateFinder::start(const QStringList& filePaths)
+{
+    if (isRunning()) {
+        cancel();
+    }
+
+    m_state = std::make_shared<FindState>();
+    m_state->tasks = &m_tasks;
+
+    QSet<QString> seen;
+    seen.reserve(filePaths.size());
+    m_state->files.reserve(static_cast<size_t>(filePaths.size()));
+    for (const QString& path : filePaths) {
+        if (!seen.contains(path)) {
+            seen.insert(path);
+            FileEntry entry;
+            entry.path = path;
+            m_state->files.push_back(std::move(entry));
+        }
+    }
+
+    std::vector<int> indices(m_state->files.size());
+    for (size_t i = 0; i < indices.size(); ++i) {
+        indices[i] = static_cast<int>(i);
+    }
+    startStage(m_state, Stage::Size, std::move(indices));
+    m_flushTimer->start();
+}
+
+/**
+ * @brief 是否正在查找
+ *
+ * @return bool 是否正在查找
+ */
+bool DuplicateFinder::isRunning() const
+{
+    return m_state != nullptr;
+}
+
+/**
+ * @brief 取消查找
+ *
+ * 排队中的任务检查取消标志后立即返回；正在计算完整哈希的任务在下一个
+ * 读取块之前返回。
+ */
+void DuplicateFinder::cancel()
+{
+    if (!m_state) {
+        return;
+    }
+
+    m_state->cancelled.store(true, std::memory_order_relaxed);
+    m_state.reset();
+    m_flushTimer->stop();
+    emit finished(true);
+}
+
+/**
+ * @brief 向界面线程报告进度和结果
+ */
+void DuplicateFinder::flush()
+{
+    if (!m_state) {
+        return;
+    }
+
+    if (m_state->done.load(std::memory_order_acquire)) {
+        const std::shared_ptr<FindState> state = std::move(m_state);
+        m_flushTimer->stop();
+        emit duplicatesFound(state->groups, state->redundantBytes);
+        emit finished(false);
+        return;
+    }
+
+    emit progress(static_cast<Stage>(m_state->stage.load(std::memory_order_relaxed)),
+                  m_state->stageDone.load(std::memory_order_relaxed),
+                  m_state->stageTotal.load(std::memory_order_relaxed),
+                  m_state->bytesRead.load(std::memory_order_relaxed));
+}
+
+/**
+ * @brief 启动一个阶段
+ *
+ * 先一次性登记全部任务数再提交，避免较早完成的任务误判阶段结束。
+ */
+void DuplicateFinder::startStage(const std::shared_ptr<FindState>& state, Stage stage, std::vector<int> indices)
+{
+    if (state->cancelled.load(std::memory_order_relaxed)) {
+        return;
+    }
+    if (indices.empty()) {
+        advance(state, stage);
+        return;
+    }
+
+    const size_t chunk = stage == Stage::Size ? kSizeChunk : stage == Stage::Sample ? kSampleChunk : 1;
+    const size_t count = indices.size();
+    const int tasks = static_cast<int>((count + chunk - 1) / chunk);
+
+    state->work = std::move(indices);
+    state->stageDone.store(0, std::memory_order_relaxed);
+    state->stageTotal.store(static_cast<int>(count), std::memory_order_relaxed);
+    state->stage.store(int(stage), std::memory_order_relaxed);
+    state->pendingTasks.store(tasks, std::memory_order_release);
+
+    for (size_t begin = 0; begin < count; begin += chunk) {
+        const size_t end = qMin(begin + chunk, count);
+        TaskScheduler::instance().submit(TaskScheduler::Priority::Background, [state, stage, begin, end]() {
+            processChunk(state, stage, begin, end);
+            if (state->pendingTasks.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                advance(state, stage);
+            }
+        }, state->tasks);
+    }
+}
+
+/**
+ * @brief 处理一个任务块（在工作线程执行）
+ */
+void DuplicateFinder::processChunk(const std::shared_ptr<FindState>& state, Stage stage, size_t begin, size_t end)
+{
+    AURORA_TRACE_SCOPE("duplicates", stage == Stage::Size ? "stat" : stage == Stage::Sample ? "sampleHash" : "fullHash");
+
+    for (size_t i = begin; i < end; ++i) {
+        if (state->cancelled.load(std::memory_order_relaxed)) {
+            return;
+        }
+
+        FileEntry& file = state->files[static_cast<size_t>(state->work[i])];
+        switch (stage) {
+            case Stage::Size: {
+                const QFileInfo info(file.path);
+                if (info.isFile()) {
+                    file.size = info.size();
+                }
+                break;
+            }
+            case Stage::Sample:
+                file.sampled = AuroraPlayer::Utils::sampledFileHash(file.path, file.size, &file.sampleHash,
+                                                                    &file.sampleComplete, &state->bytesRead);
+                break;
+            case Stage::Full:
+                file.confirmed = AuroraPlayer::Utils::fullFileHash(file.path, &file.fullHash,
+                                                                   &state->cancelled, &state->bytesRead);
+                break;
+        }
+        state->stageDone.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+/**
+ * @brief 阶段结束后分组并启动下一阶段
+ */
+void DuplicateFinder::advance(const std::shared_ptr<FindState>& state, Stage finishedStage)
+{
+    AURORA_TRACE_SCOPE("duplicates", "group");
+
+    if (state->cancelled.load(std::memory_order_relaxed)) {
+        return;
+    }
+
+    std::vector<FileEntry>& files = state->files;
+    switch (finishedStage) {
+        case Stage::Size: {
+            // 空文件内容必然相同，不作为重复报告
+            std::vector<int> sized;
+            for (size_t i = 0; i < files.size(); ++i) {
+                if (files[i].size > 0) {
+                    sized.push_back(static_cast<int>(i));
+                }
+            }
+
+            std::vector<int> candidates;
+            for (const auto& group : groupBy(std::move(sized), [&files](int i) { return files[i].size; })) {
+                candidates.insert(candidates.end(), group.begin(), group.end());
+            }
+            startStage(state, Stage::Sample, std::move(candidates));
+            return;
+        }
+        case Stage::Sample: {
+            std::vector<int> sampled;
+            for (const int i : state->work) {
+                if (files[i].sampled) {
+                    sampled.push_back(i);
+                }
+            }
+
+            std::vector<int> needFull;
+            const auto key = [&files](int i) { return std::make_tuple(files[i].size, files[i].sampleHash); };
+            for (const auto& group : groupBy(std::move(sampled), key)) {
+                for (const int i : group) {
+                    if (files[i].sampleComplete) {
+                        // 抽样已覆盖全部内容，抽样哈希即完整哈希
+                        files[i].fullHash = files[i].sampleHash;
+                        files[i].confirmed = true;
+                    } else {
+                        needFull.push_back(i);
+                    }
+                }
+            }
+            startStage(state, Stage::Full, std::move(needFull));
+            return;
+        }
+        case Stage::Full: {
+            std::vector<int> confirmed;
+            for (size_t i = 0; i < files.size(); ++i) {
+                if (files[i].confirmed) {
+                    confirmed.push_back(static_cast<int>(i));
+                }
+            }
+
+            const auto key = [&files](int i) { return std::make_tuple(files[i].size, files[i].fullHash); };
+            std::vector<std::vector<int>> groups = groupBy(std::move(confirmed), key);
+            // 组按首个文件的输入顺序排列，组内已由 stable_sort 保持输入顺序
+            std::sort(groups.begin(), groups.end(),
+                      [](const std::vector<int>& a, const std::vector<int>& b) { return a.front() < b.front(); });
+
+            for (const auto& group : groups) {
+                QStringList paths;
+                paths.reserve(static_cast<qsizetype>(group.size()));
+                for (const int i : group) {
+                    paths.append(files[i].path);
+                }
+                state->groups.append(paths);
+                state->redundantBytes += files[group.front()].size * static_cast<qint64>(group.size() - 1);
+            }
+            state->done.store(true, std::memory_order_release);
+            return;
+        }
+    }
+}
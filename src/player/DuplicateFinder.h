@@ -0,0 +1,140 @@
+/********************************************************************************
+ * @file   : DuplicateFinder.h
+ * @brief  : 声明了 DuplicateFinder 类。
+ *
+ * 该文件声明了查找内容重复文件的查找器：先按大小分组，再对候选文件做
+ * 抽样哈希，只有抽样哈希仍然相同的文件才读取完整内容确认。
+ *
+ * @author : polarours
+ * @date   : 2026/10/18
+ ********************************************************************************/
+
+#ifndef AURORAPLAYER_DUPLICATEFINDER_H
+#define AURORAPLAYER_DUPLICATEFINDER_H
+
+#include <QList>
+#include <QObject>
+#include <QStringList>
+
+#include <memory>
+#include <vector>
+
+#include "../core/TaskScheduler.h"
+
+class QTimer;
+
+/**
+ * @class DuplicateFinder
+ * @brief 重复文件查找器
+ *
+ * 三个阶段依次以后台任务在共享调度器上执行，每个阶段的最后一个任务负责分组并启动下一阶段：
+ * 读取大小、抽样哈希（开头、中间、结尾各 64 KB）、完整哈希。大小唯一的文件
+ * 不读取内容，抽样哈希唯一的文件不读取全部内容，因此大多数文件只需三次
+ * 小块读取。
+ */
+class DuplicateFinder : public QObject
+{
+    Q_OBJECT
+
+public:
+    /**
+     * @brief 查找阶段
+     */
+    enum class Stage {
+        Size,    ///< 读取文件大小
+        Sample,  ///< 抽样哈希
+        Full     ///< 完整哈希确认
+    };
+    Q_ENUM(Stage)
+
+    /**
+     * @brief 构造函数
+     *
+     * @param parent 父对象
+     */
+    explicit DuplicateFinder(QObject* parent = nullptr);
+
+    /**
+     * @brief 析构函数，取消并等待未完成的任务
+     */
+    ~DuplicateFinder();
+
+    /**
+     * @brief 开始查找
+     *
+     * 正在查找时先取消上一次查找。重复的路径只计一次。
+     *
+     * @param filePaths 文件路径列表
+     */
+    void start(const QStringList& filePaths);
+
+    /**
+     * @brief 是否正在查找
+     *
+     * @return bool 是否正在查找
+     */
+    bool isRunning() const;
+
+public slots:
+    /**
+     * @brief 取消查找
+     */
+    void cancel();
+
+signals:
+    /**
+     * @brief 查找进度
+     *
+     * @param stage     当前阶段
+     * @param done      本阶段已处理的文件数
+     * @param total     本阶段需要处理的文件数
+     * @param bytesRead 累计读取的字节数
+     */
+    void progress(DuplicateFinder::Stage stage, int done, int total, qint64 bytesRead);
+
+    /**
+     * @brief 查找完成（在 finished(false) 之前发出）
+     *
+     * @param groups         重复文件组，组内按输入顺序排列
+     * @param redundantBytes 每组只保留一份时可节省的字节数
+     */
+    void duplicatesFound(const QList<QStringList>& groups, qint64 redundantBytes);
+
+    /**
+     * @brief 查找结束
+     *
+     * @param cancelled 是否被取消
+     */
+    void finished(bool cancelled);
+
+private slots:
+    /**
+     * @brief 向界面线程报告进度和结果
+     */
+    void flush();
+
+private:
+    struct FindState;
+
+    /**
+     * @brief 启动一个阶段（indices 为空时直接进入下一阶段）
+     */
+    static void startStage(const std::shared_ptr<FindState>& state, Stage stage, std::vector<int> indices);
+
+    /**
+     * @brief 处理一个任务块（在工作线程执行）
+     */
+    static void processChunk(const std::shared_ptr<FindState>& state, Stage stage, size_t begin, size_t end);
+
+    /**
+     * @brief 阶段结束后分组并启动下一阶段（由阶段的最后一个任务调用）
+     */
+    static void advance(const std::shared_ptr<FindState>& state, Stage finishedStage);
+
+private:
+    TaskScheduler::Group m_tasks;       ///< 已提交的查找任务
+    QTimer* m_flushTimer;               ///< 进度回送定时器
+    std::shared_ptr<FindState> m_state; ///< 当前查找的共享状态
+};
+
+#endif // AURORAPLAYER_DUPLICATEFINDER_H
@@ -0,0 +1,221 @@
+/********************************************************************************
+ * @file   : FolderImporter.cpp
+ * @brief  : 实现了 FolderImporter 类。
+ *
+ * @author : polarours
+ * @date   : 2026/10/18
+ ********************************************************************************/
+
+#include "FolderImporter.h"
+#include "../core/Tracer.h"
+#include "../utils/MediaSniffer.h"
+
+#include <QDirIterator>
+#include <QFileInfo>
+#include <QMutex>
+#include <QMutexLocker>
+#include <QTimer>
+
+#include <atomic>
+
+namespace {
+
+    constexpr int kSniffChunkSize = 128;  ///< 每个嗅探任务处理的文件数
+    constexpr int kFlushIntervalMs = 100; ///< 结果回送间隔（毫秒）
+
+} // namespace
+
+/**
+ * @brief 一次导入的共享状态，工作线程任务持有其引用，导入器可随时放弃
+ */
+struct FolderImporter::ImportState {
+    TaskScheduler::Group* tasks = nullptr; ///< 所属任务组
+    std::atomic<bool> cancelled{false};    ///< 是否已取消
+    std::atomic<int> pendingTasks{0};      ///< 未完成的任务数
+    std::atomic<int> scannedDirs{0};       ///< 已扫描目录数
+    std::atomic<int> scannedFiles{0};      ///< 已检查文件数
+    std::atomic<int> mediaFiles{0};        ///< 已识别的媒体文件数
+    QMutex mutex;                          ///< 保护 readyBatches
+    QList<QStringList> readyBatches;       ///< 待回送的结果批次
+};
+
+/**
+ * @brief 构造函数
+ *
+ * @param parent 父对象
+ */
+FolderImporter::FolderImporter(QObject* parent)
+    : QObject(parent)
+    , m_flushTimer(new QTimer(this))
+{
+    m_flushTimer->setInterval(kFlushIntervalMs);
+    connect(m_flushTimer, &QTimer::timeout, this, &FolderImporter::flush);
+}
+
+/**
+ * @brief 析构函数，取消并等待未完成的任务
+ */
+FolderImporter::~FolderImporter()
+{
+    if (m_state) {
+        m_state->cancelled.store(true, std::memory_order_relaxed);
+    }
+    m_tasks.wait();
+}
+
+/**
+ * @brief 开始导入
+ *
+ * @param rootPaths 根目录列表
+ */
+void FolderImporter::start(const QStringList& rootPaths)
+{
+    if (isRunning()) {
+        cancel();
+    }
+
+    m_state = std::make_shared<ImportState>();
+    m_state->tasks = &m_tasks;
+    for (const QString& rootPath : rootPaths) {
+        submitDirectory(m_state, rootPath);
+    }
+    m_flushTimer->start();
+}
+
+/**
+ * @brief 是否正在导入
+ *
+ * @return bool 是否正在导入
+ */
+bool FolderImporter::isRunning() const
+{
+    return m_state != nullptr;
+}
+
+/**
+ * @brief 取消导入
+ *
+ * 排队中的任务检查取消标志后立即返回，无需等待。
+ */
+void FolderImporter::cancel()
+{
+    if (!m_state) {
+        return;
+    }
+
+    m_state->cancelled.store(true, std::memory_order_relaxed);
+    m_state.reset();
+    m_flushTimer->stop();
+    emit finished(true);
+}
+
+/**
+ * @brief 将工作线程积累的结果回送到界面线程
+ */
+void FolderImporter::flush()
+{
+    if (!m_state) {
+        return;
+    }
+
+    // 先读任务数再取结果：任务在递减计数前已提交结果，读到 0 时结果一定完整
+    const bool done = m_state->pendingTasks.load(std::memory_order_acquire) == 0;
+
+    QList<QStringList> batches;
+    {
+        QMutexLocker locker(&m_state->mutex);
+        batches.swap(m_state->readyBatches);
+    }
+
+    // 合并为一个批次，播放列表每个周期只插入一次
+    QStringList merged;
+    for (const QStringList& batch : batches) {
+        merged.append(batch);
+    }
+    if (!merged.isEmpty()) {
+        emit batchReady(merged);
+    }
+
+    emit progress(m_state->scannedDirs.load(std::memory_order_relaxed),
+                  m_state->scannedFiles.load(std::memory_order_relaxed),
+                  m_state->mediaFiles.load(std::memory_order_relaxed));
+
+    if (done) {
+        m_state.reset();
+        m_flushTimer->stop();
+        emit finished(false);
+    }
+}
+
+/**
+ * @brief 提交一个目录扫描任务
+ */
+void FolderImporter::submitDirectory(const std::shared_ptr<ImportState>& state, const QString& dirPath)
+{
+    state->pendingTasks.fetch_add(1, std::memory_order_relaxed);
+    TaskScheduler::instance().submit(TaskScheduler::Priority::Background, [state, dirPath]() {
+        scanDirectory(state, dirPath);
+        state->pendingTasks.fetch_sub(1, std::memory_order_release);
+    }, state->tasks);
+}
+
+/**
+ * @brief 扫描单个目录（在工作线程执行）
+ *
+ * 子目录作为新任务提交，本目录的文件按名称排序后分块并行嗅探。
+ */
+void FolderImporter::scanDirectory(const std::shared_ptr<ImportState>& state, const QString& dirPath)
+{
+    AURORA_TRACE_SCOPE("import", "scanDirectory");
+
+    if (state->cancelled.load(std::memory_order_relaxed)) {
+        return;
+    }
+
+    QStringList files;
+    QDirIterator it(dirPath, QDir::Files | QDir::Dirs | QDir::NoDotAndDotDot);
+    while (it.hasNext()) {
+        if (state->cancelled.load(std::memory_order_relaxed)) {
+            return;
+        }
+
+        const QString path = it.next();
+        const QFileInfo info = it.fileInfo();
+        if (info.isDir()) {
+            // 不跟随目录符号链接，避免环路
+            if (!info.isSymLink()) {
+                submitDirectory(state, path);
+            }
+        } else {
+            files.append(path);
+        }
+    }
+    state->scannedDirs.fetch_add(1, std::memory_order_relaxed);
+    files.sort();
+
+    for (qsizetype begin = 0; begin < files.size(); begin += kSniffChunkSize) {
+        const QStringList chunk = files.mid(begin, kSniffChunkSize);
+        state->pendingTasks.fetch_add(1, std::memory_order_relaxed);
+        TaskScheduler::instance().submit(TaskScheduler::Priority::Background, [state, chunk]() {
+            AURORA_TRACE_SCOPE("import", "sniffFiles");
+
+            QStringList media;
+            for (const QString& filePath : chunk) {
+                if (state->cancelled.load(std::memory_order_relaxed)) {
+                    break;
+                }
+                state->scannedFiles.fetch_add(1, std::memory_order_relaxed);
+                if (AuroraPlayer::Utils::sniffMediaFile(filePath) != AuroraPlayer::Utils::MediaKind::Unknown) {
+                    media.append(filePath);
+                }
+            }
+
+            if (!media.isEmpty()) {
+                state->mediaFiles.fetch_add(static_cast<int>(media.size()), std::memory_order_relaxed);
+                QMutexLocker locker(&state->mutex);
+                state->readyBatches.append(media);
+            }
+            state->pendingTasks.fetch_sub(1, std::memory_order_release);
+        }, state->tasks);
+    }
+}
@@ -0,0 +1,112 @@
+/********************************************************************************
+ * @file   : FolderImporter.h
+ * @brief  : 声明了 FolderImporter 类。
+ *
+ * 该文件声明了并行递归导入文件夹的导入器：每个目录作为一个后台任务在共享
+ * 任务调度器上读取，文件通过嗅探开头字节识别媒体类型，结果分批回送到界面线程。
+ *
+ * @author : polarours
+ * @date   : 2026/10/18
+ ********************************************************************************/
+
+#ifndef AURORAPLAYER_FOLDERIMPORTER_H
+#define AURORAPLAYER_FOLDERIMPORTER_H
+
+#include <QObject>
+#include <QStringList>
+
+#include <memory>
+
+#include "../core/TaskScheduler.h"
+
+class QTimer;
+
+class FolderImporter : public QObject
+{
+    Q_OBJECT
+
+public:
+    /**
+     * @brief 构造函数
+     *
+     * @param parent 父对象
+     */
+    explicit FolderImporter(QObject* parent = nullptr);
+
+    /**
+     * @brief 析构函数，取消并等待未完成的任务
+     */
+    ~FolderImporter();
+
+    /**
+     * @brief 开始导入
+     *
+     * 正在导入时先取消上一次导入。
+     *
+     * @param rootPaths 根目录列表
+     */
+    void start(const QStringList& rootPaths);
+
+    /**
+     * @brief 是否正在导入
+     *
+     * @return bool 是否正在导入
+     */
+    bool isRunning() const;
+
+public slots:
+    /**
+     * @brief 取消导入（已回送的批次保留）
+     */
+    void cancel();
+
+signals:
+    /**
+     * @brief 一批媒体文件已就绪
+     *
+     * @param filePaths 文件路径列表（同一目录内按名称排序）
+     */
+    void batchReady(const QStringList& filePaths);
+
+    /**
+     * @brief 导入进度
+     *
+     * @param scannedDirs  已扫描目录数
+     * @param scannedFiles 已检查文件数
+     * @param mediaFiles   已识别的媒体文件数
+     */
+    void progress(int scannedDirs, int scannedFiles, int mediaFiles);
+
+    /**
+     * @brief 导入结束
+     *
+     * @param cancelled 是否被取消
+     */
+    void finished(bool cancelled);
+
+private slots:
+    /**
+     * @brief 将工作线程积累的结果回送到界面线程
+     */
+    void flush();
+
+private:
+    struct ImportState;
+
+    /**
+     * @brief 提交一个目录扫描任务
+     */
+    static void submitDirectory(const std::shared_ptr<ImportState>& state, const QString& dirPath);
+
+    /**
+     * @brief 扫描单个目录（在工作线程执行）
+     */
+    static void scanDirectory(const std::shared_ptr<ImportState>& state, const QString& dirPath);
+
+private:
+    TaskScheduler::Group m_tasks;          ///< 已提交的扫描和嗅探任务
+    QTimer* m_flushTimer;                  ///< 结果回送定时器
+    std::shared_ptr<ImportState> m_state;  ///< 当前导入的共享状态
+};
+
+#endif // AURORAPLAYER_FOLDERIMPORTER_H
@@ -0,0 +1,336 @@
+/********************************************************************************
+ * @file   : HeadlessPlayer.cpp
+ * @brief  : 实现了 HeadlessPlayer 类。
+ *
+ * @author : polarours
+ * @date   : 2026/10/18
+ ********************************************************************************/
+
+#include "HeadlessPlayer.h"
+#include "PlayerController.h"
+#include "PlaylistLoader.h"
+#include "PlaylistManager.h"
+#include "../core/DecoderPool.h"
+#include "../core/TaskScheduler.h"
+
+#include <QCoreApplication>
+#include <QFileInfo>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QTimer>
+#include <QVideoFrame>
+#include <QVideoFrameFormat>
+#include <QVideoSink>
+#include <QtDebug>
+
+#include <cstdio>
+
+namespace {
+
+    /**
+     * @brief 判断输入是否为播放列表文件（按扩展名）
+     */
+    bool isPlaylistFile(const QString& path)
+    {
+        const QString suffix = QFileInfo(path).suffix().toLower();
+        return suffix == QLatin1String("m3u") || suffix == QLatin1String("m3u8") || suffix == QLatin1String("apl");
+    }
+
+    /**
+     * @brief 获取像素格式第 plane 个平面每行的有效字节数和行数
+     *
+     * 平面格式按实际宽度和色度子采样写出（不含对齐填充），单平面的打包格式
+     * 按整行写出；其余多平面格式的平面尺寸无法可靠推算，不支持导出。
+     *
+     * @return bool 是否支持该像素格式
+     */
+    bool planeGeometry(const QVideoFrame& frame, int plane, int* rowBytes, int* rows)
+    {
+        const int width = frame.width();
+        const int height = frame.height();
+        const int chromaWidth = (width + 1) / 2;
+        const int chromaHeight = (height + 1) / 2;
+
+        int bytesPerSample = 1;  // 每个分量的字节数
+        int chromaSamples = 1;   // 色度平面每个位置的分量数（半平面交错 UV 为 2）
+        int chromaRows = chromaHeight;
+        switch (frame.pixelFormat()) {
+            case QVideoFrameFormat::Format_YUV420P:
+            case QVideoFrameFormat::Format_YV12:
+                break;
+#if QT_VERSION >= QT_VERSION_CHECK(6, 4, 0)
+            case QVideoFrameFormat::Format_YUV420P10:
+                bytesPerSample = 2;
+                break;
+#endif
+            case QVideoFrameFormat::Format_YUV422P:
+                chromaRows = height;
+                break;
+            case QVideoFrameFormat::Format_NV12:
+            case QVideoFrameFormat::Format_NV21:
+                chromaSamples = 2;
+                break;
+            case QVideoFrameFormat::Format_P010:
+            case QVideoFrameFormat::Format_P016:
+                bytesPerSample = 2;
+                chromaSamples = 2;
+                break;
+            default:
+                if (frame.planeCount() != 1) {
+                    return false;
+                }
+                *rowBytes = frame.bytesPerLine(plane);
+                *rows = height;
+                return true;
+        }
+
+        *rowBytes = (plane == 0 ? width : chromaWidth * chromaSamples) * bytesPerSample;
+        *rows = plane == 0 ? height : chromaRows;
+        return true;
+    }
+
+} // namespace
+
+/**
+ * @brief 构造函数
+ *
+ * @param options 运行选项
+ * @param parent  父对象
+ */
+HeadlessPlayer::HeadlessPlayer(const Options& options, QObject* parent)
+    : QObject(parent)
+    , m_options(options)
+    , m_controller(new PlayerController(this))
+    , m_playlistLoader(new PlaylistLoader(this))
+    , m_videoSink(new QVideoSink(this))
+    , m_reportTimer(new QTimer(this))
+    , m_started(false)
+    , m_finished(false)
+    , m_consecutiveFailures(0)
+    , m_framesDumped(0)
+{
+    m_controller->setVideoSink(m_videoSink);
+    m_controller->setAudioOutputEnabled(!m_options.nullAudio);
+    if (m_options.loop) {
+        m_controller->playlistManager()->setPlaylistMode(AuroraPlayer::State::PlaylistMode::Loop);
+    }
+
+    connect(m_controller, &PlayerController::mediaFinished, this, [this]() { advance(false); });
+    connect(m_controller, &PlayerController::errorOccured, this, [this]() { advance(true); });
+    connect(m_controller, &PlayerController::metaDataChanged, this, [this]() { m_consecutiveFailures = 0; });
+
+    connect(m_playlistLoader, &PlaylistLoader::batchReady, this, [this](const QStringList& filePaths) {
+                m_controller->playlistManager()->addFiles(filePaths);
+                startPlaybackIfReady();
+            });
+    connect(m_playlistLoader, &PlaylistLoader::finished, this, &HeadlessPlayer::processNextInput);
+    connect(m_playlistLoader, &PlaylistLoader::failed, this, [this](const QString& message) {
+                qWarning() << "Failed to load playlist:" << message;
+                processNextInput();
+            });
+
+    connect(m_reportTimer, &QTimer::timeout, this, &HeadlessPlayer::report);
+}
+
+/**
+ * @brief 析构函数
+ */
+HeadlessPlayer::~HeadlessPlayer()
+{
+    m_videoDump.close();
+}
+
+/**
+ * @brief 获取播放控制器
+ *
+ * @return PlayerController* 播放控制器
+ */
+PlayerController* HeadlessPlayer::controller() const
+{
+    return m_controller;
+}
+
+/**
+ * @brief 开始播放
+ *
+ * @param inputs 文件和播放列表路径
+ * @return bool 是否有可播放的输入
+ */
+bool HeadlessPlayer::start(const QStringList& inputs)
+{
+    if (inputs.isEmpty()) {
+        qWarning() << "Headless mode needs at least one file or playlist";
+        return false;
+    }
+
+    if (!m_options.videoDumpPath.isEmpty()) {
+        m_videoDump.setFileName(m_options.videoDumpPath);
+        if (!m_videoDump.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+            qWarning() << "Failed to open video dump file:" << m_options.videoDumpPath;
+            return false;
+        }
+        // 只在需要写文件时才映射帧数据；否则帧送达后直接丢弃
+        connect(m_videoSink, &QVideoSink::videoFrameChanged, this, &HeadlessPlayer::dumpFrame);
+    }
+
+    if (m_options.reportIntervalMs > 0) {
+        m_reportTimer->start(m_options.reportIntervalMs);
+    }
+    if (m_options.durationSec > 0) {
+        QTimer::singleShot(m_options.durationSec * 1000, this, [this]() { finish(0); });
+    }
+
+    m_pendingInputs = inputs;
+    QTimer::singleShot(0, this, &HeadlessPlayer::processNextInput);
+    return true;
+}
+
+/**
+ * @brief 处理下一个输入
+ */
+void HeadlessPlayer::processNextInput()
+{
+    // 连续的媒体文件一次加入，遇到播放列表时交给加载器，加载完再继续
+    QStringList files;
+    while (!m_pendingInputs.isEmpty()) {
+        const QString input = m_pendingInputs.takeFirst();
+        if (isPlaylistFile(input)) {
+            m_controller->playlistManager()->addFiles(files);
+            startPlaybackIfReady();
+            m_playlistLoader->start(input);
+            return;
+        }
+        files.append(input);
+    }
+    m_controller->playlistManager()->addFiles(files);
+    startPlaybackIfReady();
+
+    if (m_controller->playlistManager()->count() == 0) {
+        qWarning() << "Nothing to play";
+        finish(1);
+    }
+}
+
+/**
+ * @brief 播放列表中已有条目时开始播放
+ */
+void HeadlessPlayer::startPlaybackIfReady()
+{
+    if (m_started || m_controller->playlistManager()->count() == 0) {
+        return;
+    }
+    m_started = true;
+    m_controller->play();
+}
+
+/**
+ * @brief 切换到下一个媒体
+ *
+ * @param failed 当前媒体是否失败
+ */
+void HeadlessPlayer::advance(bool failed)
+{
+    if (m_finished) {
+        return;
+    }
+
+    PlaylistManager* playlistManager = m_controller->playlistManager();
+    if (failed) {
+        m_consecutiveFailures += 1;
+        // 循环模式下全部失败会无限重试，整轮都失败时退出
+        if (m_consecutiveFailures >= playlistManager->count()) {
+            finish(1);
+            return;
+        }
+    }
+
+    if (!playlistManager->next()) {
+        finish(m_consecutiveFailures > 0 ? 1 : 0);
+        return;
+    }
+    m_controller->play();
+}
+
+/**
+ * @brief 将视频帧追加到输出文件
+ *
+ * @param frame 视频帧
+ */
+void HeadlessPlayer::dumpFrame(const QVideoFrame& frame)
+{
+    if (!frame.isValid() || !m_videoDump.isOpen()) {
+        return;
+    }
+
+    QVideoFrame mapped(frame);
+    if (!mapped.map(QVideoFrame::ReadOnly)) {
+        return;
+    }
+
+    int rowBytes = 0;
+    int rows = 0;
+    if (!planeGeometry(mapped, 0, &rowBytes, &rows)) {
+        qWarning().noquote() << "Cannot dump frames in pixel format"
+                             << QVideoFrameFormat::pixelFormatToString(mapped.pixelFormat()) << "- video dump stopped";
+        mapped.unmap();
+        m_videoDump.close();
+        return;
+    }
+
+    if (m_framesDumped == 0) {
+        qInfo().noquote() << QStringLiteral("Dumping %1x%2 %3 frames to %4")
+                                 .arg(mapped.width())
+                                 .arg(mapped.height())
+                                 .arg(QVideoFrameFormat::pixelFormatToString(mapped.pixelFormat()))
+                                 .arg(m_videoDump.fileName());
+    }
+
+    for (int plane = 0; plane < mapped.planeCount(); ++plane) {
+        planeGeometry(mapped, plane, &rowBytes, &rows);
+        const uchar* bits = mapped.bits(plane);
+        const int stride = mapped.bytesPerLine(plane);
+        for (int row = 0; row < rows; ++row) {
+            m_videoDump.write(reinterpret_cast<const char*>(bits + row * stride), rowBytes);
+        }
+    }
+    mapped.unmap();
+    m_framesDumped += 1;
+}
+
+/**
+ * @brief 向标准输出打印一行指标
+ */
+void HeadlessPlayer::report()
+{
+    QJsonObject line = m_controller->metrics().toJson();
+    line.insert(QStringLiteral("file"), m_controller->playlistManager()->currentFile());
+    line.insert(QStringLiteral("positionMs"), m_controller->position());
+    line.insert(QStringLiteral("framesDumped"), m_framesDumped);
+    line.insert(QStringLiteral("tasks"), TaskScheduler::instance().toJson());
+    line.insert(QStringLiteral("decoders"), DecoderPool::instance().toJson());
+
+    const QByteArray json = QJsonDocument(line).toJson(QJsonDocument::Compact);
+    std::fwrite(json.constData(), 1, static_cast<size_t>(json.size()), stdout);
+    std::fputc('\n', stdout);
+    std::fflush(stdout);
+}
+
+/**
+ * @brief 打印最终指标并结束事件循环
+ *
+ * @param exitCode 退出码
+ */
+void HeadlessPlayer::finish(int exitCode)
+{
+    if (m_finished) {
+        return;
+    }
+    m_finished = true;
+
+    m_reportTimer->stop();
+    m_playlistLoader->cancel();
+    report();
+    m_controller->stop();
+    m_videoDump.flush();
+    QCoreApplication::exit(exitCode);
+}
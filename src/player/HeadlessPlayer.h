@@ -0,0 +1,126 @@
+/********************************************************************************
+ * @file   : HeadlessPlayer.h
+ * @brief  : 声明了 HeadlessPlayer 类。
+ *
+ * 该文件声明了无界面播放器：不创建 MainWindow，通过 PlayerController 按顺序播放
+ * 命令行给出的文件和播放列表。视频帧送往独立的 QVideoSink，可选地以原始格式
+ * 写入文件；音频可以关闭设备输出、按实时节奏丢弃。运行中按固定间隔向标准输出
+ * 打印一行 JSON 指标，用于在没有显示器的服务器和 CI 容器中做长时间浸泡测试。
+ *
+ * @author : polarours
+ * @date   : 2026/10/18
+ ********************************************************************************/
+
+#ifndef AURORAPLAYER_HEADLESSPLAYER_H
+#define AURORAPLAYER_HEADLESSPLAYER_H
+
+#include <QFile>
+#include <QObject>
+#include <QStringList>
+
+// --- 前向声明 --- //
+class PlayerController;
+class PlaylistLoader;
+class QTimer;
+class QVideoFrame;
+class QVideoSink;
+
+class HeadlessPlayer : public QObject
+{
+    Q_OBJECT
+
+public:
+    /**
+     * @brief 运行选项
+     */
+    struct Options {
+        QString videoDumpPath;     ///< 原始视频帧输出文件，为空时丢弃视频帧
+        bool nullAudio = false;    ///< 不输出到音频设备，按实时节奏丢弃音频
+        bool loop = false;         ///< 播放列表循环播放
+        int durationSec = 0;       ///< 运行时长上限（秒），0 表示播放完为止
+        int reportIntervalMs = 1000; ///< 指标输出间隔（毫秒），0 表示只在结束时输出
+    };
+
+    /**
+     * @brief 构造函数
+     *
+     * @param options 运行选项
+     * @param parent  父对象
+     */
+    explicit HeadlessPlayer(const Options& options, QObject* parent = nullptr);
+
+    /**
+     * @brief 析构函数
+     */
+    ~HeadlessPlayer() override;
+
+    /**
+     * @brief 获取播放控制器
+     *
+     * @return PlayerController* 播放控制器
+     */
+    PlayerController* controller() const;
+
+    /**
+     * @brief 开始播放
+     *
+     * 扩展名为 .m3u/.m3u8/.apl 的输入作为播放列表加载，其余作为媒体文件，
+     * 按给出的顺序加入播放列表。全部播放完（或达到时长上限）后退出事件循环。
+     *
+     * @param inputs 文件和播放列表路径
+     * @return bool 是否有可播放的输入（视频输出文件无法打开时也返回 false）
+     */
+    bool start(const QStringList& inputs);
+
+private:
+    /**
+     * @brief 处理下一个输入：媒体文件直接加入，播放列表交给加载器
+     */
+    void processNextInput();
+
+    /**
+     * @brief 播放列表中已有条目时开始播放（只执行一次）
+     */
+    void startPlaybackIfReady();
+
+    /**
+     * @brief 当前媒体结束或失败后切换到下一个，没有下一个时结束
+     *
+     * @param failed 当前媒体是否打开/解码失败
+     */
+    void advance(bool failed);
+
+    /**
+     * @brief 将视频帧追加到输出文件
+     *
+     * @param frame 视频帧
+     */
+    void dumpFrame(const QVideoFrame& frame);
+
+    /**
+     * @brief 向标准输出打印一行指标
+     */
+    void report();
+
+    /**
+     * @brief 打印最终指标并以指定退出码结束事件循环
+     *
+     * @param exitCode 退出码
+     */
+    void finish(int exitCode);
+
+private:
+    Options m_options;                 ///< 运行选项
+    PlayerController* m_controller;    ///< 播放控制器
+    PlaylistLoader* m_playlistLoader;  ///< 播放列表加载器
+    QVideoSink* m_videoSink;           ///< 视频帧接收端
+    QTimer* m_reportTimer;             ///< 指标输出定时器
+    QFile m_videoDump;                 ///< 原始视频帧输出文件
+    QStringList m_pendingInputs;       ///< 尚未处理的输入
+    bool m_started;                    ///< 是否已开始播放
+    bool m_finished;                   ///< 是否已结束
+    int m_consecutiveFailures;         ///< 连续失败的媒体数
+    qint64 m_framesDumped;             ///< 已写出的视频帧数
+};
+
+#endif // AURORAPLAYER_HEADLESSPLAYER_H
@@ -0,0 +1,280 @@
+/********************************************************************************
+ * @file   : MetadataService.cpp
+ * @brief  : 实现了 MetadataService 类。
+ *
+ * @author : polarours
+ * @date   : 2026/10/18
+ ********************************************************************************/
+
+#include "MetadataService.h"
+#include "../core/LibraryIndex.h"
+#include "../core/Tracer.h"
+
+#include <QMutexLocker>
+#include <QThread>
+#include <QTimer>
+
+namespace {
+
+    constexpr int kMaxVisibleRequests = 256; ///< 可见行请求上限，超出时丢弃最旧的
+    constexpr int kFlushIntervalMs = 100;    ///< 结果合并间隔（毫秒）
+
+} // namespace
+
+/**
+ * @brief 构造函数
+ *
+ * @param playlistManager 播放列表管理器
+ * @param parent          父对象
+ */
+MetadataService::MetadataService(PlaylistManager* playlistManager, QObject* parent)
+    : QObject(parent)
+    , m_playlistManager(playlistManager)
+    , m_libraryIndex(nullptr)
+    , m_flushTimer(new QTimer(this))
+    , m_maxConcurrent(0)
+    , m_running(0)
+    , m_dispatchQueued(false)
+{
+    // 探测与播放争用磁盘和 CPU，默认只占用少量线程
+    setMaxConcurrentProbes(qBound(2, QThread::idealThreadCount() / 2, 4));
+
+    m_flushTimer->setSingleShot(true);
+    m_flushTimer->setInterval(kFlushIntervalMs);
+    connect(m_flushTimer, &QTimer::timeout, this, &MetadataService::flush);
+
+    // 清空后旧的条目 ID 全部失效
+    connect(m_playlistManager, &PlaylistManager::playlistReset, this, &MetadataService::cancelPending);
+}
+
+/**
+ * @brief 析构函数
+ */
+MetadataService::~MetadataService()
+{
+    cancelPending();
+    m_tasks.wait();
+}
+
+/**
+ * @brief 请求探测单个条目
+ *
+ * @param id       条目 ID
+ * @param priority 优先级
+ */
+void MetadataService::request(ItemId id, Priority priority)
+{
+    if (id == PlaylistStorage::InvalidId || m_inFlight.contains(id) || m_playlistManager->hasMetadata(id)) {
+        return;
+    }
+
+    switch (priority) {
+        case Priority::Visible:
+            m_visible.push_back(id);
+            if (m_visible.size() > kMaxVisibleRequests) {
+                // 最旧的请求对应早已滚出视野的行，再次可见时会重新请求
+                m_visible.pop_front();
+            }
+            break;
+        case Priority::Upcoming:
+            m_upcoming.push_back(id);
+            break;
+        case Priority::Background:
+            m_background.push_back({id, id});
+            break;
+    }
+
+    scheduleDispatch();
+}
+
+/**
+ * @brief 以后台优先级请求一段连续的条目 ID
+ *
+ * @param firstId 起始条目 ID
+ * @param lastId  结束条目 ID（包含）
+ */
+void MetadataService::requestRange(ItemId firstId, ItemId lastId)
+{
+    if (firstId == PlaylistStorage::InvalidId || lastId < firstId) {
+        return;
+    }
+
+    m_background.push_back({firstId, lastId});
+    scheduleDispatch();
+}
+
+/**
+ * @brief 设置媒体库索引
+ *
+ * @param libraryIndex 媒体库索引
+ */
+void MetadataService::setLibraryIndex(LibraryIndex* libraryIndex)
+{
+    m_libraryIndex = libraryIndex;
+}
+
+/**
+ * @brief 获取媒体库索引
+ *
+ * @return LibraryIndex* 媒体库索引
+ */
+LibraryIndex* MetadataService::libraryIndex() const
+{
+    return m_libraryIndex;
+}
+
+/**
+ * @brief 设置同时进行的探测数上限
+ *
+ * @param count 上限
+ */
+void MetadataService::setMaxConcurrentProbes(int count)
+{
+    m_maxConcurrent = qMax(1, count);
+}
+
+/**
+ * @brief 丢弃所有排队中的请求
+ */
+void MetadataService::cancelPending()
+{
+    m_visible.clear();
+    m_upcoming.clear();
+    m_background.clear();
+}
+
+/**
+ * @brief 在空闲名额内启动排队中的探测
+ *
+ * 只在有空闲名额时取出请求，其余请求留在队列里，
+ * 使后到的高优先级请求能够插到前面。
+ */
+void MetadataService::dispatch()
+{
+    m_dispatchQueued = false;
+    while (m_running < m_maxConcurrent) {
+        int row = -1;
+        Priority priority = Priority::Background;
+        const ItemId id = takeNext(row, priority);
+        if (id == PlaylistStorage::InvalidId) {
+            return;
+        }
+
+        const QString filePath = m_playlistManager->filePathAt(row);
+        m_inFlight.insert(id);
+        ++m_running;
+        LibraryIndex* libraryIndex = m_libraryIndex;
+        // 可见行的探测结果用户正在等，其余的按后台优先级
+        const TaskScheduler::Priority taskPriority = priority == Priority::Visible
+                                                   ? TaskScheduler::Priority::Interactive
+                                                   : TaskScheduler::Priority::Background;
+        TaskScheduler::instance().submit(taskPriority, [this, id, filePath, libraryIndex]() {
+            MediaMetadata metadata;
+            if (!libraryIndex || !libraryIndex->lookupFresh(filePath, &metadata)) {
+                metadata = MediaMetadata::probe(filePath);
+                if (libraryIndex) {
+                    libraryIndex->insert(filePath, metadata);
+                }
+            }
+            {
+                QMutexLocker locker(&m_resultMutex);
+                m_results.append(qMakePair(id, std::move(metadata)));
+            }
+            QMetaObject::invokeMethod(this, [this]() {
+                        --m_running;
+                        if (!m_flushTimer->isActive()) {
+                            m_flushTimer->start();
+                        }
+                        dispatch();
+                    }, Qt::QueuedConnection);
+        }, &m_tasks);
+    }
+}
+
+/**
+ * @brief 合并同一事件循环周期内的调度请求
+ *
+ * 一次重绘会为每个可见行调用 request()，只需调度一次。
+ */
+void MetadataService::scheduleDispatch()
+{
+    if (!m_dispatchQueued) {
+        m_dispatchQueued = true;
+        QMetaObject::invokeMethod(this, &MetadataService::dispatch, Qt::QueuedConnection);
+    }
+}
+
+/**
+ * @brief 将已完成的结果整批写回播放列表
+ */
+void MetadataService::flush()
+{
+    AURORA_TRACE_SCOPE("metadata", "flush");
+
+    QList<QPair<ItemId, MediaMetadata>> results;
+    {
+        QMutexLocker locker(&m_resultMutex);
+        results.swap(m_results);
+    }
+
+    for (const auto& result : results) {
+        m_inFlight.remove(result.first);
+    }
+    m_playlistManager->setMetadata(results);
+}
+
+/**
+ * @brief 取出下一个需要探测的条目
+ *
+ * @param row      输出条目所在行
+ * @param priority 输出条目所在队列的优先级
+ * @return ItemId 条目 ID，队列为空时为 InvalidId
+ */
+MetadataService::ItemId MetadataService::takeNext(int& row, Priority& priority)
+{
+    while (!m_visible.empty()) {
+        const ItemId id = m_visible.back();
+        m_visible.pop_back();
+        if (needsProbe(id, row)) {
+            priority = Priority::Visible;
+            return id;
+        }
+    }
+
+    while (!m_upcoming.empty()) {
+        const ItemId id = m_upcoming.front();
+        m_upcoming.pop_front();
+        if (needsProbe(id, row)) {
+            priority = Priority::Upcoming;
+            return id;
+        }
+    }
+
+    while (!m_background.empty()) {
+        IdRange& range = m_background.front();
+        const ItemId id = range.first;
+        if (range.first == range.last) {
+            m_background.pop_front();
+        } else {
+            ++range.first;
+        }
+        if (needsProbe(id, row)) {
+            priority = Priority::Background;
+            return id;
+        }
+    }
+
+    return PlaylistStorage::InvalidId;
+}
+
+/**
+ * @brief 条目是否仍需要探测（仍在列表中、未在探测、没有元数据）
+ */
+bool MetadataService::needsProbe(ItemId id, int& row) const
+{
+    if (m_inFlight.contains(id) || m_playlistManager->hasMetadata(id)) {
+        return false;
+    }
+    row = m_playlistManager->indexOfItem(id);
+    return row >= 0;
+}
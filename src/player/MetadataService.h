@@ -0,0 +1,170 @@
+/********************************************************************************
+ * @file   : MetadataService.h
+ * @brief  : 声明了 MetadataService 类。
+ *
+ * 该文件声明了后台元数据提取服务：在共享任务调度器上探测播放列表条目的
+ * 时长、标签、编码和分辨率，按优先级调度，结果分批写回 PlaylistManager。
+ *
+ * @author : polarours
+ * @date   : 2026/10/18
+ ********************************************************************************/
+
+#ifndef AURORAPLAYER_METADATASERVICE_H
+#define AURORAPLAYER_METADATASERVICE_H
+
+#include <QList>
+#include <QMutex>
+#include <QObject>
+#include <QPair>
+#include <QSet>
+
+#include <deque>
+
+#include "PlaylistManager.h"
+#include "../core/MediaMetadata.h"
+#include "../core/TaskScheduler.h"
+
+class LibraryIndex;
+class QTimer;
+
+/**
+ * @class MetadataService
+ * @brief 后台元数据提取服务
+ *
+ * 三级队列：可见行（后进先出，最近滚动到的行最先探测，过旧的请求被丢弃）、
+ * 即将播放的条目（先进先出）、其余条目（按连续的条目 ID 区间排队，不逐条保存）。
+ * 同时进行的探测数不超过设定上限，可见行的探测以交互优先级提交，其余以后台
+ * 优先级提交；界面线程只负责调度和合并结果。
+ * 设置了媒体库索引时，文件未修改的条目直接从索引读取，不再探测。
+ */
+class MetadataService : public QObject
+{
+    Q_OBJECT
+
+public:
+    using ItemId = PlaylistManager::ItemId;
+
+    /**
+     * @brief 请求优先级
+     */
+    enum class Priority {
+        Visible,  ///< 列表中可见的行
+        Upcoming, ///< 即将播放的条目
+        Background ///< 其余条目
+    };
+
+    /**
+     * @brief 构造函数
+     *
+     * @param playlistManager 播放列表管理器（结果写回目标）
+     * @param parent          父对象
+     */
+    explicit MetadataService(PlaylistManager* playlistManager, QObject* parent = nullptr);
+
+    /**
+     * @brief 析构函数，丢弃排队请求并等待正在进行的探测
+     */
+    ~MetadataService();
+
+    /**
+     * @brief 请求探测单个条目
+     *
+     * 已有元数据或正在探测的条目会被忽略。
+     *
+     * @param id       条目 ID
+     * @param priority 优先级（Visible 或 Upcoming）
+     */
+    void request(ItemId id, Priority priority);
+
+    /**
+     * @brief 以后台优先级请求一段连续的条目 ID
+     *
+     * @param firstId 起始条目 ID
+     * @param lastId  结束条目 ID（包含）
+     */
+    void requestRange(ItemId firstId, ItemId lastId);
+
+    /**
+     * @brief 设置媒体库索引（作为探测结果的持久缓存）
+     *
+     * @param libraryIndex 媒体库索引，生命周期须长于本服务；为空时不使用缓存
+     */
+    void setLibraryIndex(LibraryIndex* libraryIndex);
+
+    /**
+     * @brief 获取媒体库索引
+     *
+     * @return LibraryIndex* 媒体库索引，未设置时为 nullptr
+     */
+    LibraryIndex* libraryIndex() const;
+
+    /**
+     * @brief 设置同时进行的探测数上限
+     *
+     * @param count 上限
+     */
+    void setMaxConcurrentProbes(int count);
+
+    /**
+     * @brief 丢弃所有排队中的请求
+     */
+    void cancelPending();
+
+private slots:
+    /**
+     * @brief 在空闲名额内启动排队中的探测
+     */
+    void dispatch();
+
+    /**
+     * @brief 将已完成的结果整批写回播放列表
+     */
+    void flush();
+
+private:
+    /**
+     * @brief 合并同一事件循环周期内的调度请求
+     */
+    void scheduleDispatch();
+
+    /**
+     * @brief 取出下一个需要探测的条目
+     *
+     * @param row      输出条目所在行
+     * @param priority 输出条目所在队列的优先级
+     * @return ItemId 条目 ID，队列为空时为 InvalidId
+     */
+    ItemId takeNext(int& row, Priority& priority);
+
+    /**
+     * @brief 条目是否仍需要探测
+     */
+    bool needsProbe(ItemId id, int& row) const;
+
+private:
+    /**
+     * @brief 后台请求的条目 ID 区间
+     */
+    struct IdRange {
+        ItemId first; ///< 起始条目 ID
+        ItemId last;  ///< 结束条目 ID（包含）
+    };
+
+    PlaylistManager* m_playlistManager;  ///< 播放列表管理器
+    LibraryIndex* m_libraryIndex;        ///< 媒体库索引
+    TaskScheduler::Group m_tasks;        ///< 已提交的探测任务
+    QTimer* m_flushTimer;                ///< 结果合并定时器
+    int m_maxConcurrent;                 ///< 同时进行的探测数上限
+    int m_running;                       ///< 正在进行的探测数
+    bool m_dispatchQueued;               ///< 是否已排队一次调度
+
+    std::deque<ItemId> m_visible;        ///< 可见行请求（末尾最新）
+    std::deque<ItemId> m_upcoming;       ///< 即将播放请求
+    std::deque<IdRange> m_background;    ///< 后台请求区间
+    QSet<ItemId> m_inFlight;             ///< 正在探测的条目
+
+    QMutex m_resultMutex;                               ///< 保护 m_results
+    QList<QPair<ItemId, MediaMetadata>> m_results;      ///< 已完成、待写回的结果
+};
+
+#endif // AURORAPLAYER_METADATASERVICE_H
@@ -0,0 +1,159 @@
+/********************************************************************************
+ * @file   : PathArena.cpp
+ * @brief  : 实现了 PathArena 类。
+ *
+ * @author : polarours
+ * @date   : 2026/10/18
+ ********************************************************************************/
+
+#include "PathArena.h"
+#include <CommonUtils.h>
+
+#include <limits>
+
+/**
+ * @brief 添加路径
+ *
+ * 超过 16 位长度的文件名（实际文件系统不会出现）整体放入目录部分，
+ * 保证引用仍能还原出原始路径。
+ *
+ * @param path 文件路径
+ * @return Ref 路径引用
+ */
+PathArena::Ref PathArena::add(const QString& path)
+{
+    // 与建立检索索引时使用同一个拆分规则，fileName() 才能还原出被索引的文本
+    const qsizetype nameStart = AuroraPlayer::Utils::fileNameOffset(path);
+    const QStringView directory = QStringView(path).left(nameStart);
+    const QStringView name = QStringView(path).mid(nameStart);
+
+    const QByteArray nameUtf8 = name.toUtf8();
+    constexpr qsizetype kMaxName = std::numeric_limits<quint16>::max();
+    if (nameUtf8.size() > kMaxName || name.size() > kMaxName) {
+        return appendName(internDirectory(path.toUtf8(), static_cast<int>(path.size())), nullptr, 0, 0);
+    }
+
+    return appendName(internDirectory(directory.toUtf8(), static_cast<int>(directory.size())),
+                      nameUtf8.constData(), nameUtf8.size(), static_cast<int>(name.size()));
+}
+
+/**
+ * @brief 从另一个池复制路径
+ *
+ * @param other 源字符串池
+ * @param ref   源路径引用
+ * @return Ref 本池中的路径引用
+ */
+PathArena::Ref PathArena::add(const PathArena& other, const Ref& ref)
+{
+    const Directory& directory = other.m_directories[ref.directory];
+    return appendName(internDirectory(directory.utf8, directory.chars),
+                      other.m_names.constData() + ref.nameOffset, ref.nameBytes, ref.nameChars);
+}
+
+/**
+ * @brief 构造完整路径
+ *
+ * @param ref 路径引用
+ * @return QString 文件路径
+ */
+QString PathArena::path(const Ref& ref) const
+{
+    const Directory& directory = m_directories[ref.directory];
+    QString result;
+    result.reserve(directory.chars + ref.nameChars);
+    result.append(QString::fromUtf8(directory.utf8));
+    result.append(QString::fromUtf8(m_names.constData() + ref.nameOffset, ref.nameBytes));
+    return result;
+}
+
+/**
+ * @brief 构造文件名部分
+ *
+ * @param ref 路径引用
+ * @return QString 文件名
+ */
+QString PathArena::fileName(const Ref& ref) const
+{
+    return QString::fromUtf8(m_names.constData() + ref.nameOffset, ref.nameBytes);
+}
+
+/**
+ * @brief 路径的 UTF-16 长度
+ *
+ * @param ref 路径引用
+ * @return qsizetype 字符数
+ */
+qsizetype PathArena::pathLength(const Ref& ref) const
+{
+    return m_directories[ref.directory].chars + ref.nameChars;
+}
+
+/**
+ * @brief 文件名缓冲区已用字节数
+ *
+ * @return qsizetype 字节数
+ */
+qsizetype PathArena::nameBytes() const
+{
+    return m_names.size();
+}
+
+/**
+ * @brief 估算池占用的内存
+ *
+ * @return qsizetype 字节数
+ */
+qsizetype PathArena::memoryUsage() const
+{
+    qsizetype bytes = m_names.capacity();
+    bytes += static_cast<qsizetype>(m_directories.capacity() * sizeof(Directory));
+    for (const Directory& directory : m_directories) {
+        bytes += directory.utf8.capacity();
+    }
+    // 哈希节点：键（共享数据，仅句柄）与值
+    bytes += m_directoryIds.capacity() * static_cast<qsizetype>(sizeof(QByteArray) + sizeof(quint32));
+    return bytes;
+}
+
+/**
+ * @brief 清空
+ */
+void PathArena::clear()
+{
+    m_names = QByteArray();
+    std::vector<Directory>().swap(m_directories);
+    m_directoryIds = QHash<QByteArray, quint32>();
+}
+
+/**
+ * @brief 去重并返回目录编号
+ */
+quint32 PathArena::internDirectory(const QByteArray& utf8, int chars)
+{
+    const auto it = m_directoryIds.constFind(utf8);
+    if (it != m_directoryIds.constEnd()) {
+        return it.value();
+    }
+
+    const quint32 id = static_cast<quint32>(m_directories.size());
+    m_directories.push_back({utf8, chars});
+    m_directoryIds.insert(utf8, id);
+    return id;
+}
+
+/**
+ * @brief 追加文件名
+ */
+PathArena::Ref PathArena::appendName(quint32 directory, const char* utf8, qsizetype bytes, int chars)
+{
+    Ref ref;
+    ref.directory = directory;
+    ref.nameOffset = static_cast<quint32>(m_names.size());
+    ref.nameBytes = static_cast<quint16>(bytes);
+    ref.nameChars = static_cast<quint16>(chars);
+    if (bytes > 0) {
+        m_names.append(utf8, bytes);
+    }
+    return ref;
+}
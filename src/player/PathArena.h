@@ -0,0 +1,130 @@
+/********************************************************************************
+ * @file   : PathArena.h
+ * @brief  : 声明了 PathArena 类。
+ *
+ * 该文件声明了播放列表使用的紧凑路径存储：目录前缀去重，文件名以 UTF-8
+ * 连续存放，需要时才构造 QString。
+ *
+ * @author : polarours
+ * @date   : 2026/10/18
+ ********************************************************************************/
+
+#ifndef AURORAPLAYER_PATHARENA_H
+#define AURORAPLAYER_PATHARENA_H
+
+#include <QByteArray>
+#include <QHash>
+#include <QString>
+
+#include <vector>
+
+/**
+ * @class PathArena
+ * @brief 路径字符串池
+ *
+ * 路径在最后一个 '/' 或 '\' 处拆分：目录部分（含结尾的分隔符）整体去重，同一目录
+ * 下的文件共享一份；文件名追加到一块连续的 UTF-8 缓冲区。每条路径只需
+ * 一个 12 字节的 Ref，而 QString 每条都有独立的堆分配和 UTF-16 副本。
+ *
+ * 池只追加不回收，删除条目留下的空间由调用方在适当时机通过
+ * 向新池重新添加的方式压缩。
+ */
+class PathArena
+{
+public:
+    /**
+     * @brief 池中一条路径的引用
+     */
+    struct Ref {
+        quint32 directory;  ///< 目录编号
+        quint32 nameOffset; ///< 文件名在缓冲区中的偏移
+        quint16 nameBytes;  ///< 文件名的 UTF-8 字节数
+        quint16 nameChars;  ///< 文件名的 UTF-16 长度
+    };
+
+    /**
+     * @brief 添加路径
+     *
+     * @param path 文件路径
+     * @return Ref 路径引用
+     */
+    Ref add(const QString& path);
+
+    /**
+     * @brief 从另一个池复制路径（用于压缩，不经过 UTF-16 转换）
+     *
+     * @param other 源字符串池
+     * @param ref   源路径引用
+     * @return Ref 本池中的路径引用
+     */
+    Ref add(const PathArena& other, const Ref& ref);
+
+    /**
+     * @brief 构造完整路径
+     *
+     * @param ref 路径引用
+     * @return QString 文件路径
+     */
+    QString path(const Ref& ref) const;
+
+    /**
+     * @brief 构造文件名部分
+     *
+     * @param ref 路径引用
+     * @return QString 文件名
+     */
+    QString fileName(const Ref& ref) const;
+
+    /**
+     * @brief 路径的 UTF-16 长度（不构造 QString）
+     *
+     * @param ref 路径引用
+     * @return qsizetype 字符数
+     */
+    qsizetype pathLength(const Ref& ref) const;
+
+    /**
+     * @brief 文件名缓冲区已用字节数
+     *
+     * @return qsizetype 字节数
+     */
+    qsizetype nameBytes() const;
+
+    /**
+     * @brief 估算池占用的内存（字节）
+     *
+     * @return qsizetype 字节数
+     */
+    qsizetype memoryUsage() const;
+
+    /**
+     * @brief 清空
+     */
+    void clear();
+
+private:
+    /**
+     * @brief 已去重的目录
+     */
+    struct Directory {
+        QByteArray utf8; ///< UTF-8 目录（与哈希键共享数据）
+        int chars;       ///< UTF-16 长度
+    };
+
+    /**
+     * @brief 去重并返回目录编号
+     */
+    quint32 internDirectory(const QByteArray& utf8, int chars);
+
+    /**
+     * @brief 追加文件名
+     */
+    Ref appendName(quint32 directory, const char* utf8, qsizetype bytes, int chars);
+
+private:
+    QByteArray m_names;                       ///< 文件名缓冲区（UTF-8）
+    std::vector<Directory> m_directories;     ///< 目录表
+    QHash<QByteArray, quint32> m_directoryIds; ///< 目录 → 编号
+};
+
+#endif // AURORAPLAYER_PATHARENA_H
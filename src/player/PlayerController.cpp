@@ -10,10 +10,51 @@
 
 #include "PlayerController.h"
 #include "PlaylistManager.h"
+#include "MetadataService.h"
+#include "../core/DecoderPool.h"
+#include "../core/PositionNotifier.h"
+#include "../core/StartupTimeline.h"
+#include "../core/TaskScheduler.h"
+#include "../core/Tracer.h"
 #include <QVideoWidget>
-#include <QUrl>
-#include <QAudioOutput>
-#include <QMediaMetaData>
+#include <QVideoSink>
+#include <QVideoFrame>
+#include <QTimer>
+#include <QFile>
+#include <QJsonDocument>
+#include <QDebug>
+
+extern "C" {
+#include <libavutil/pixfmt.h>
+}
+
+namespace {
+
+    constexpr qint64 kLateFrameThresholdMs = 40; ///< 视频帧落后播放位置超过该值视为迟到
+
+    /**
+     * @brief 将 Qt 像素格式映射为 FFmpeg 像素格式，统一统计显示
+     */
+    int toAVPixelFormat(QVideoFrameFormat::PixelFormat format)
+    {
+        switch (format) {
+            case QVideoFrameFormat::Format_YUV420P: return AV_PIX_FMT_YUV420P;
+            case QVideoFrameFormat::Format_YUV422P: return AV_PIX_FMT_YUV422P;
+            case QVideoFrameFormat::Format_NV12:    return AV_PIX_FMT_NV12;
+            case QVideoFrameFormat::Format_NV21:    return AV_PIX_FMT_NV21;
+            case QVideoFrameFormat::Format_P010:    return AV_PIX_FMT_P010LE;
+            case QVideoFrameFormat::Format_BGRA8888: return AV_PIX_FMT_BGRA;
+            case QVideoFrameFormat::Format_RGBA8888: return AV_PIX_FMT_RGBA;
+            case QVideoFrameFormat::Format_ARGB8888: return AV_PIX_FMT_ARGB;
+            case QVideoFrameFormat::Format_RGBX8888: return AV_PIX_FMT_RGB0;
+            case QVideoFrameFormat::Format_BGRX8888: return AV_PIX_FMT_BGR0;
+            case QVideoFrameFormat::Format_UYVY:    return AV_PIX_FMT_UYVY422;
+            case QVideoFrameFormat::Format_YUYV:    return AV_PIX_FMT_YUYV422;
+            default:                                return AV_PIX_FMT_NONE;
+        }
+    }
+
+} // namespace
 
 /**
  * @brief 构造函数。
@@ -22,27 +63,28 @@
  */
 PlayerController::PlayerController(QObject *parent)
     : QObject(parent)                                    ///< 继承自 QObject
-    , mediaPlayer(new QMediaPlayer(this))          ///< 创建媒体播放器
-    , audioOutput(new QAudioOutput(this))          ///< 创建音频输出
+    , m_backend(nullptr)                           ///< 播放后端（见 ensureBackend）
+    , m_backendType(PlaybackBackend::defaultType()) ///< 默认后端类型
+    , m_audioOutputEnabled(true)                   ///< 默认输出到音频设备
+    , m_videoVisible(true)                         ///< 默认画面可见
+    , m_volume(100)                                ///< 默认音量
     , m_playlistManager(new PlaylistManager(this)) ///< 创建播放列表管理器
+    , m_metadataService(new MetadataService(m_playlistManager, this)) ///< 创建元数据服务
+    , m_positionNotifier(new PositionNotifier(this)) ///< 创建合并播放位置通知
+    , m_metricsDumpTimer(new QTimer(this))         ///< 创建指标导出定时器
 {
-    mediaPlayer->setAudioOutput(audioOutput);
-    
-    // 设置播放器的视频输出为默认的null对象，稍后会通过setVideoOutput设置
-    mediaPlayer->setVideoOutput(nullptr);
-    
-    connect(mediaPlayer, &QMediaPlayer::durationChanged, this, &PlayerController::durationChanged);
-    connect(mediaPlayer, &QMediaPlayer::positionChanged, this, &PlayerController::positionChanged);
-    connect(mediaPlayer, &QMediaPlayer::playbackStateChanged, this, &PlayerController::playbackStateChanged);
-    connect(mediaPlayer, &QMediaPlayer::metaDataChanged, this, &PlayerController::metaDataChanged);
-    connect(mediaPlayer, &QMediaPlayer::errorOccurred, this, [this](QMediaPlayer::Error error) {
-                qDebug() << "Media player error:" << error << "-" << mediaPlayer->errorString();
-                //emit errorOccurred();
-            });
+    connect(m_positionNotifier, &PositionNotifier::positionChanged, this, &PlayerController::positionChanged);
+    connect(m_metricsDumpTimer, &QTimer::timeout, this, &PlayerController::dumpMetrics);
     
     // 连接播放列表管理器的信号
     connect(m_playlistManager, &PlaylistManager::currentIndexChanged, this, &PlayerController::onCurrentMediaChanged);
     connect(m_playlistManager, &PlaylistManager::playlistChanged, this, &PlayerController::playlistChanged);
+
+    // 新加入的条目以后台优先级排队（同一批次的条目 ID 连续）
+    connect(m_playlistManager, &PlaylistManager::rowsInserted, this, [this](int first, int last) {
+                m_metadataService->requestRange(m_playlistManager->itemIdAt(first), m_playlistManager->itemIdAt(last));
+            });
+    connect(m_playlistManager, &PlaylistManager::currentIndexChanged, this, &PlayerController::prefetchUpcomingMetadata);
 }
 
 /**
@@ -50,7 +92,136 @@ PlayerController::PlayerController(QObject *parent)
  */
 PlayerController::~PlayerController()
 {
-    // TODO: 释放资源
+    // 子对象由 QObject 在本类成员析构之后才释放，而后端的播放线程写入 m_stats/m_metrics，
+    // 元数据探测任务读取播放列表：先停止它们，再让成员析构
+    m_metricsDumpTimer->stop();
+    delete m_backend;
+    m_backend = nullptr;
+    delete m_metadataService;
+    m_metadataService = nullptr;
+}
+
+/**
+ * @brief 创建后端并连接信号
+ *
+ * @param type 后端类型
+ */
+void PlayerController::createBackend(PlaybackBackend::Type type)
+{
+    AURORA_TRACE_SCOPE("startup", "createBackend");
+
+    m_backendType = type;
+    m_backend = PlaybackBackend::create(type, this);
+    m_backend->setInstrumentation(&m_stats, &m_metrics);
+    m_backend->setVolume(m_volume);
+    m_backend->setAudioOutputEnabled(m_audioOutputEnabled);
+    m_backend->setVideoVisible(m_videoVisible);
+    if (m_videoWidget) {
+        m_backend->setVideoOutput(m_videoWidget);
+    } else {
+        m_backend->setVideoSink(m_videoSink);
+    }
+
+    connect(m_backend, &PlaybackBackend::durationChanged, this, &PlayerController::durationChanged);
+    connect(m_backend, &PlaybackBackend::stateChanged, this, &PlayerController::playbackStateChanged);
+    connect(m_backend, &PlaybackBackend::stateChanged, this, &PlayerController::stateChanged);
+    connect(m_backend, &PlaybackBackend::metadataChanged, this, &PlayerController::metaDataChanged);
+    connect(m_backend, &PlaybackBackend::metadataChanged, this, &PlayerController::updateBitrate);
+    connect(m_backend, &PlaybackBackend::positionChanged, this, [this](qint64 position) {
+                m_lastPositionMs.store(position, std::memory_order_relaxed);
+                m_positionNotifier->publish(position);
+
+                // 纯音频没有视频帧，以位置更新作为跳转完成和启动完成
+                if (!m_backend->hasVideo()) {
+                    const qint64 seekStart = m_seekStartUs.exchange(-1, std::memory_order_relaxed);
+                    if (seekStart >= 0) {
+                        m_metrics.seekLatency.record(PlayerMetrics::nowUs() - seekStart);
+                    }
+                    if (position > 0 && !StartupTimeline::isFinished()) {
+                        StartupTimeline::mark("firstAudio");
+                        StartupTimeline::finish();
+                    }
+                }
+            });
+    connect(m_backend, &PlaybackBackend::mediaStatusChanged, this, &PlayerController::onMediaStatusChanged);
+    connect(m_backend, &PlaybackBackend::errorOccurred, this, [this](const QString& message) {
+                qDebug() << "Media player error:" << PlaybackBackend::typeName(m_backend->type()) << "-" << message;
+                emit errorOccured();
+            });
+}
+
+/**
+ * @brief 获取播放后端，尚未创建时创建
+ *
+ * @return PlaybackBackend* 播放后端
+ */
+PlaybackBackend* PlayerController::ensureBackend()
+{
+    if (!m_backend) {
+        createBackend(m_backendType);
+    }
+    return m_backend;
+}
+
+/**
+ * @brief 切换播放后端
+ *
+ * @param type 后端类型
+ */
+void PlayerController::setBackend(PlaybackBackend::Type type)
+{
+    if (m_backendType == type) {
+        return;
+    }
+
+    // 尚未创建后端时只记录类型，打开媒体时再创建
+    if (!m_backend) {
+        m_backendType = type;
+        emit backendChanged(type);
+        return;
+    }
+
+    const qint64 position = m_backend->position();
+    const AuroraPlayer::State::PlayerState state = m_backend->state();
+
+    // 先停掉旧后端，避免两个后端同时占用音频设备
+    m_backend->stop();
+    delete m_backend;
+    createBackend(type);
+
+    if (!m_source.isEmpty()) {
+        loadSource(m_source);
+        if (position > 0) {
+            m_backend->setPosition(position);
+        }
+        if (state == AuroraPlayer::State::PlayerState::Playing) {
+            m_backend->play();
+        } else if (state == AuroraPlayer::State::PlayerState::Paused) {
+            m_backend->pause();
+        }
+    }
+
+    emit backendChanged(type);
+}
+
+/**
+ * @brief 获取当前播放后端
+ *
+ * @return PlaybackBackend* 播放后端
+ */
+PlaybackBackend* PlayerController::backend() const
+{
+    return m_backend;
+}
+
+/**
+ * @brief 获取当前选择的后端类型
+ *
+ * @return PlaybackBackend::Type 后端类型
+ */
+PlaybackBackend::Type PlayerController::backendType() const
+{
+    return m_backendType;
 }
 
 /**
@@ -60,7 +231,71 @@ PlayerController::~PlayerController()
  */
 void PlayerController::setVideoOutput(QVideoWidget *widget)
 {
-    mediaPlayer->setVideoOutput(widget);
+    m_videoWidget = widget;
+    if (m_backend) {
+        m_backend->setVideoOutput(widget);
+    }
+
+    // 切换输出时先断开旧接收端，避免同一帧被重复统计
+    disconnect(m_frameConnection);
+    if (!widget) {
+        return;
+    }
+
+    // 视频帧可能在渲染线程送达，这里只更新原子计数器
+    m_frameConnection = connect(widget->videoSink(), &QVideoSink::videoFrameChanged,
+                                this, &PlayerController::onVideoFrame, Qt::DirectConnection);
+}
+
+/**
+ * @brief 设置独立的视频帧接收端
+ *
+ * @param sink 视频帧接收端
+ */
+void PlayerController::setVideoSink(QVideoSink* sink)
+{
+    m_videoWidget = nullptr;
+    m_videoSink = sink;
+    if (m_backend) {
+        m_backend->setVideoSink(sink);
+    }
+
+    disconnect(m_frameConnection);
+    if (!sink) {
+        return;
+    }
+    m_frameConnection = connect(sink, &QVideoSink::videoFrameChanged,
+                                this, &PlayerController::onVideoFrame, Qt::DirectConnection);
+}
+
+/**
+ * @brief 启用/关闭音频设备输出
+ *
+ * @param enabled 是否输出到音频设备
+ */
+void PlayerController::setAudioOutputEnabled(bool enabled)
+{
+    m_audioOutputEnabled = enabled;
+    if (m_backend) {
+        m_backend->setAudioOutputEnabled(enabled);
+    }
+}
+
+/**
+ * @brief 设置画面是否可见
+ *
+ * @param visible 是否可见
+ */
+void PlayerController::setVideoVisible(bool visible)
+{
+    if (m_videoVisible == visible) {
+        return;
+    }
+    m_videoVisible = visible;
+    AURORA_TRACE_INSTANT("present", visible ? "videoVisible" : "videoHidden");
+    if (m_backend) {
+        m_backend->setVideoVisible(visible);
+    }
 }
 
 /**
@@ -72,7 +307,26 @@ void PlayerController::setMedia(const QString& mediaPath)
 {
     m_playlistManager->addFile(mediaPath);
     m_playlistManager->setCurrentIndex(m_playlistManager->count() - 1);
-    mediaPlayer->setSource(QUrl::fromLocalFile(mediaPath));
+    if (mediaPath != m_source) {
+        loadSource(mediaPath);
+    }
+}
+
+/**
+ * @brief 在后端上打开媒体文件
+ *
+ * @param mediaPath 媒体文件路径
+ */
+void PlayerController::loadSource(const QString& mediaPath)
+{
+    m_stats.reset();
+    m_lastPositionMs.store(0, std::memory_order_relaxed);
+    m_lastFrameWallUs.store(-1, std::memory_order_relaxed);
+    m_lastFramePtsUs.store(-1, std::memory_order_relaxed);
+    m_openStartUs.store(PlayerMetrics::nowUs(), std::memory_order_relaxed);
+
+    m_source = mediaPath;
+    ensureBackend()->setMedia(mediaPath);
 }
 
 /**
@@ -85,6 +339,16 @@ PlaylistManager* PlayerController::playlistManager() const
     return m_playlistManager;
 }
 
+/**
+ * @brief 获取元数据服务
+ *
+ * @return MetadataService* 元数据服务实例
+ */
+MetadataService* PlayerController::metadataService() const
+{
+    return m_metadataService;
+}
+
 /**
  * @brief 获取媒体是否正在播放。
  *
@@ -93,7 +357,7 @@ PlaylistManager* PlayerController::playlistManager() const
  */
 bool PlayerController::isPlaying() const
 {
-    return mediaPlayer->playbackState() == QMediaPlayer::PlayingState;
+    return m_backend && m_backend->state() == AuroraPlayer::State::PlayerState::Playing;
 }
 
 /**
@@ -103,7 +367,7 @@ bool PlayerController::isPlaying() const
  */
 qint64 PlayerController::duration() const
 {
-    return mediaPlayer->duration();
+    return m_backend ? m_backend->duration() : 0;
 }
 
 /**
@@ -113,7 +377,7 @@ qint64 PlayerController::duration() const
  */
 qint64 PlayerController::position() const
 {
-    return mediaPlayer->position();
+    return m_backend ? m_backend->position() : 0;
 }
 
 /**
@@ -123,7 +387,10 @@ qint64 PlayerController::position() const
  */
 void PlayerController::play()
 {
-    mediaPlayer->play();
+    // 没有打开过媒体时无可播放内容，不为此创建后端
+    if (m_backend) {
+        m_backend->play();
+    }
 }
 
 /**
@@ -131,7 +398,9 @@ void PlayerController::play()
  */
 void PlayerController::pause()
 {
-    mediaPlayer->pause();
+    if (m_backend) {
+        m_backend->pause();
+    }
 }
 
 /**
@@ -139,7 +408,9 @@ void PlayerController::pause()
  */
 void PlayerController::stop()
 {
-    mediaPlayer->stop();
+    if (m_backend) {
+        m_backend->stop();
+    }
 }
 
 /**
@@ -149,7 +420,11 @@ void PlayerController::stop()
  */
 void PlayerController::setPosition(qint64 position)
 {
-    mediaPlayer->setPosition(position);
+    if (!m_backend) {
+        return;
+    }
+    m_seekStartUs.store(PlayerMetrics::nowUs(), std::memory_order_relaxed);
+    m_backend->setPosition(position);
 }
 
 /**
@@ -160,8 +435,10 @@ void PlayerController::setPosition(qint64 position)
 void PlayerController::setVolume(int volume)
 {
     // 确保音量在有效范围内
-    int clampedVolume = qBound(0, volume, 100);
-    audioOutput->setVolume(clampedVolume / 100.0);
+    m_volume = qBound(0, volume, 100);
+    if (m_backend) {
+        m_backend->setVolume(m_volume);
+    }
 }
 
 /**
@@ -171,7 +448,152 @@ void PlayerController::setVolume(int volume)
  */
 int PlayerController::volume() const
 {
-    return static_cast<int>(audioOutput->volume() * 100);
+    return m_backend ? m_backend->volume() : m_volume;
+}
+
+/**
+ * @brief 获取播放统计计数器
+ *
+ * @return const PlaybackStats& 统计计数器
+ */
+const PlaybackStats& PlayerController::stats() const
+{
+    return m_stats;
+}
+
+/**
+ * @brief 从媒体元数据更新码率统计
+ */
+void PlayerController::updateBitrate()
+{
+    m_stats.bitrate.store(m_backend->bitrate(), std::memory_order_relaxed);
+}
+
+/**
+ * @brief 获取播放指标快照
+ *
+ * @return MetricsSnapshot 指标快照
+ */
+MetricsSnapshot PlayerController::metrics() const
+{
+    return m_metrics.snapshot(m_stats);
+}
+
+/**
+ * @brief 设置指标定期导出文件
+ *
+ * @param filePath   导出文件路径，为空时停止导出
+ * @param intervalMs 导出间隔（毫秒）
+ */
+void PlayerController::setMetricsDumpFile(const QString& filePath, int intervalMs)
+{
+    m_metricsDumpPath = filePath;
+    if (filePath.isEmpty()) {
+        m_metricsDumpTimer->stop();
+        return;
+    }
+    m_metricsDumpTimer->start(qMax(intervalMs, 100));
+}
+
+/**
+ * @brief 设置 positionChanged 信号的最高发出频率
+ *
+ * @param hz 每秒最多发出次数
+ */
+void PlayerController::setPositionUpdateRate(double hz)
+{
+    m_positionNotifier->setRefreshRate(hz);
+}
+
+/**
+ * @brief 处理媒体加载状态变化
+ *
+ * @param status 媒体状态
+ */
+void PlayerController::onMediaStatusChanged(PlaybackBackend::MediaStatus status)
+{
+    switch (status) {
+        case PlaybackBackend::MediaStatus::Loaded: {
+            const qint64 openStart = m_openStartUs.exchange(-1, std::memory_order_relaxed);
+            if (openStart >= 0) {
+                m_metrics.openLatency.record(PlayerMetrics::nowUs() - openStart);
+            }
+            StartupTimeline::mark("mediaLoaded");
+            break;
+        }
+        case PlaybackBackend::MediaStatus::Stalled:
+            m_metrics.bufferUnderruns.fetch_add(1, std::memory_order_relaxed);
+            break;
+        case PlaybackBackend::MediaStatus::Invalid:
+            m_openStartUs.store(-1, std::memory_order_relaxed);
+            break;
+        case PlaybackBackend::MediaStatus::EndOfMedia:
+            emit mediaFinished();
+            break;
+        default:
+            break;
+    }
+}
+
+/**
+ * @brief 处理视频帧送达
+ *
+ * @param frame 视频帧
+ */
+void PlayerController::onVideoFrame(const QVideoFrame& frame)
+{
+    const qint64 nowUs = PlayerMetrics::nowUs();
+
+    if (!StartupTimeline::isFinished() && frame.isValid()) {
+        StartupTimeline::mark("firstFrame");
+        StartupTimeline::finish();
+    }
+
+    m_stats.framesPresented.fetch_add(1, std::memory_order_relaxed);
+    m_stats.pixelFormat.store(toAVPixelFormat(frame.pixelFormat()), std::memory_order_relaxed);
+    m_stats.videoWidth.store(frame.width(), std::memory_order_relaxed);
+    m_stats.videoHeight.store(frame.height(), std::memory_order_relaxed);
+
+    const qint64 seekStart = m_seekStartUs.exchange(-1, std::memory_order_relaxed);
+    if (seekStart >= 0) {
+        m_metrics.seekLatency.record(nowUs - seekStart);
+    }
+
+    const qint64 ptsUs = frame.startTime();
+    if (ptsUs < 0) {
+        return;
+    }
+
+    const qint64 drift = ptsUs / 1000 - m_lastPositionMs.load(std::memory_order_relaxed);
+    m_stats.avDriftMs.store(drift, std::memory_order_relaxed);
+    if (drift < -kLateFrameThresholdMs) {
+        m_stats.framesLate.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // 抖动 = 实际送达间隔与时间戳间隔之差；跳转等不连续处不计入
+    const qint64 lastWallUs = m_lastFrameWallUs.exchange(nowUs, std::memory_order_relaxed);
+    const qint64 lastPtsUs = m_lastFramePtsUs.exchange(ptsUs, std::memory_order_relaxed);
+    const qint64 ptsDelta = ptsUs - lastPtsUs;
+    if (lastWallUs >= 0 && lastPtsUs >= 0 && ptsDelta > 0 && ptsDelta < 1000000) {
+        m_metrics.presentJitter.record(qAbs((nowUs - lastWallUs) - ptsDelta));
+    }
+}
+
+/**
+ * @brief 将当前指标追加到导出文件
+ */
+void PlayerController::dumpMetrics()
+{
+    QFile file(m_metricsDumpPath);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Append)) {
+        qWarning() << "Failed to open metrics file:" << m_metricsDumpPath;
+        return;
+    }
+    QJsonObject object = metrics().toJson();
+    object.insert(QStringLiteral("tasks"), TaskScheduler::instance().toJson());
+    object.insert(QStringLiteral("decoders"), DecoderPool::instance().toJson());
+    file.write(QJsonDocument(object).toJson(QJsonDocument::Compact));
+    file.write("\n");
 }
 
 /**
@@ -180,7 +602,10 @@ int PlayerController::volume() const
 void PlayerController::nextMedia()
 {
     if (m_playlistManager->next()) {
-        mediaPlayer->setSource(QUrl::fromLocalFile(m_playlistManager->currentFile()));
+        // 切换当前项时 onCurrentMediaChanged 通常已打开新文件
+        if (m_playlistManager->currentFile() != m_source) {
+            loadSource(m_playlistManager->currentFile());
+        }
         play();
     }
 }
@@ -191,7 +616,10 @@ void PlayerController::nextMedia()
 void PlayerController::previousMedia()
 {
     if (m_playlistManager->previous()) {
-        mediaPlayer->setSource(QUrl::fromLocalFile(m_playlistManager->currentFile()));
+        // 切换当前项时 onCurrentMediaChanged 通常已打开新文件
+        if (m_playlistManager->currentFile() != m_source) {
+            loadSource(m_playlistManager->currentFile());
+        }
         play();
     }
 }
@@ -203,5 +631,16 @@ void PlayerController::previousMedia()
  */
 void PlayerController::onCurrentMediaChanged(const QString& mediaPath)
 {
-    mediaPlayer->setSource(QUrl::fromLocalFile(mediaPath));
-}
\ No newline at end of file
+    loadSource(mediaPath);
+}
+
+/**
+ * @brief 以较高优先级请求接下来将要播放的条目的元数据
+ */
+void PlayerController::prefetchUpcomingMetadata()
+{
+    constexpr int kUpcomingCount = 8;
+    for (int index : m_playlistManager->upcomingIndexes(kUpcomingCount)) {
+        m_metadataService->request(m_playlistManager->itemIdAt(index), MetadataService::Priority::Upcoming);
+    }
+}
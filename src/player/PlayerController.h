@@ -12,14 +12,23 @@
 #define AURORAPLAYER_PLAYERCONTROLLER_H
 
 #include <QObject>
-#include <QMediaPlayer>
-#include <QAudioOutput>
+#include <QPointer>
 #include <QVideoWidget>
 #include <QString>
 #include "CommonState.h"
+#include "../core/PlaybackBackend.h"
+#include "../core/PlaybackStats.h"
+#include "../core/Metrics.h"
+
+#include <atomic>
 
 // 前向声明
+class MetadataService;
 class PlaylistManager;
+class PositionNotifier;
+class QTimer;
+class QVideoFrame;
+class QVideoSink;
 
 class PlayerController : public QObject
 {
@@ -45,6 +54,58 @@ public:
      */
     void setVideoOutput(QVideoWidget* widget);
 
+    /**
+     * @brief 设置独立的视频帧接收端（无界面运行时代替视频输出组件）
+     *
+     * @param sink 视频帧接收端
+     */
+    void setVideoSink(QVideoSink* sink);
+
+    /**
+     * @brief 启用/关闭音频设备输出
+     *
+     * 关闭时音频仍然解码并按实时节奏丢弃，用于没有声卡的环境。
+     *
+     * @param enabled 是否输出到音频设备
+     */
+    void setAudioOutputEnabled(bool enabled);
+
+    /**
+     * @brief 设置画面是否可见
+     *
+     * 窗口最小化、被遮挡或视频区域隐藏时由界面调用，后端停止视频解码和显示，
+     * 音频照常播放。
+     *
+     * @param visible 是否可见
+     */
+    void setVideoVisible(bool visible);
+
+    /**
+     * @brief 切换播放后端
+     *
+     * 当前媒体在新后端上重新打开，并恢复播放位置和播放/暂停状态，
+     * 便于在同一媒体上对比两种后端。
+     *
+     * @param type 后端类型
+     */
+    void setBackend(PlaybackBackend::Type type);
+
+    /**
+     * @brief 获取当前播放后端
+     *
+     * 后端在第一次打开媒体时才创建，之前返回 nullptr。
+     *
+     * @return PlaybackBackend* 播放后端
+     */
+    PlaybackBackend* backend() const;
+
+    /**
+     * @brief 获取当前选择的后端类型（不会触发后端创建）
+     *
+     * @return PlaybackBackend::Type 后端类型
+     */
+    PlaybackBackend::Type backendType() const;
+
     /**
      * @brief 设置媒体文件路径
      *
@@ -59,6 +120,13 @@ public:
      */
     PlaylistManager* playlistManager() const;
 
+    /**
+     * @brief 获取元数据服务
+     *
+     * @return MetadataService* 元数据服务实例
+     */
+    MetadataService* metadataService() const;
+
     /**
      * @brief 获取媒体是否正在播放。
      *
@@ -88,6 +156,43 @@ public:
      */
     int volume() const;
 
+    /**
+     * @brief 获取播放统计计数器
+     *
+     * 计数器为原子变量，可在任意线程以任意频率读取。
+     *
+     * @return const PlaybackStats& 统计计数器
+     */
+    const PlaybackStats& stats() const;
+
+    /**
+     * @brief 获取播放指标快照
+     *
+     * 指标由无锁计数器和直方图组成，可在任意线程频繁调用。
+     *
+     * @return MetricsSnapshot 指标快照
+     */
+    MetricsSnapshot metrics() const;
+
+    /**
+     * @brief 设置指标定期导出文件
+     *
+     * 每隔 intervalMs 向文件追加一行 JSON（JSON Lines 格式）。
+     *
+     * @param filePath   导出文件路径，为空时停止导出
+     * @param intervalMs 导出间隔（毫秒）
+     */
+    void setMetricsDumpFile(const QString& filePath, int intervalMs = 10000);
+
+    /**
+     * @brief 设置 positionChanged 信号的最高发出频率
+     *
+     * 后端每次位置更新只写入原子变量并最多排队一次通知，界面按该频率合并发出。
+     *
+     * @param hz 每秒最多发出次数（通常为显示刷新率）
+     */
+    void setPositionUpdateRate(double hz);
+
 public slots:
     /**
      * @brief 播放媒体文件
@@ -141,6 +246,8 @@ signals:
     /**
      * @brief 媒体播放位置变化信号
      *
+     * 已合并，最多每个刷新周期发出一次。
+     *
      * @param position  播放位置（毫秒）
      */
     void positionChanged(qint64 position);
@@ -165,13 +272,25 @@ signals:
      *
      * @param state 播放状态
      */
-    void playbackStateChanged(QMediaPlayer::PlaybackState state);
+    void playbackStateChanged(AuroraPlayer::State::PlayerState state);
     
     /**
      * @brief 媒体元数据变化信号
      */
     void metaDataChanged();
 
+    /**
+     * @brief 播放后端已切换
+     *
+     * @param type 新的后端类型
+     */
+    void backendChanged(PlaybackBackend::Type type);
+
+    /**
+     * @brief 当前媒体已播放到结尾
+     */
+    void mediaFinished();
+
 private slots:
     /**
      * @brief 处理当前媒体文件变化
@@ -180,10 +299,88 @@ private slots:
      */
     void onCurrentMediaChanged(const QString& mediaPath);
 
+    /**
+     * @brief 以较高优先级请求接下来将要播放的条目的元数据
+     */
+    void prefetchUpcomingMetadata();
+
+    /**
+     * @brief 从媒体元数据更新码率统计
+     */
+    void updateBitrate();
+
+    /**
+     * @brief 处理媒体加载状态变化（统计打开延迟和缓冲欠载）
+     *
+     * @param status 媒体状态
+     */
+    void onMediaStatusChanged(PlaybackBackend::MediaStatus status);
+
+    /**
+     * @brief 将当前指标追加到导出文件
+     */
+    void dumpMetrics();
+
 private:
-    QMediaPlayer* mediaPlayer;          ///< 媒体播放器
-    QAudioOutput* audioOutput;          ///< 音频输出
+    /**
+     * @brief 创建后端并连接信号
+     *
+     * @param type 后端类型
+     */
+    void createBackend(PlaybackBackend::Type type);
+
+    /**
+     * @brief 获取播放后端，尚未创建时按当前选择的类型创建
+     *
+     * 后端（及其音频设备、多媒体插件）推迟到第一次打开媒体时创建，
+     * 不占用启动时间。
+     *
+     * @return PlaybackBackend* 播放后端
+     */
+    PlaybackBackend* ensureBackend();
+
+    /**
+     * @brief 在后端上打开媒体文件，并重置本次播放的统计
+     *
+     * @param mediaPath 媒体文件路径
+     */
+    void loadSource(const QString& mediaPath);
+
+    /**
+     * @brief 处理视频帧送达（统计显示帧、抖动和跳转延迟）
+     *
+     * 可能在渲染线程调用，只能访问原子变量。
+     *
+     * @param frame 视频帧
+     */
+    void onVideoFrame(const QVideoFrame& frame);
+
+private:
+    PlaybackBackend* m_backend;         ///< 播放后端（延迟创建）
+    PlaybackBackend::Type m_backendType; ///< 选择的后端类型
+    QPointer<QVideoWidget> m_videoWidget; ///< 视频输出组件
+    QPointer<QVideoSink> m_videoSink;   ///< 独立的视频帧接收端（无界面时）
+    QMetaObject::Connection m_frameConnection; ///< 当前视频帧接收端到 onVideoFrame 的连接
+    bool m_audioOutputEnabled;          ///< 是否输出到音频设备
+    bool m_videoVisible;                ///< 画面是否可见
+    QString m_source;                   ///< 后端当前打开的媒体文件
+    int m_volume;                       ///< 音量（0-100），切换后端时沿用
     PlaylistManager* m_playlistManager; ///< 播放列表管理器
+    MetadataService* m_metadataService; ///< 元数据服务
+    PositionNotifier* m_positionNotifier; ///< 合并播放位置通知
+
+    // --- 统计 --- //
+    PlaybackStats m_stats;                  ///< 播放统计计数器
+    std::atomic<qint64> m_lastPositionMs{0}; ///< 最近一次播放位置（用于计算音视频偏差）
+
+    // --- 指标 --- //
+    PlayerMetrics m_metrics;                   ///< 播放指标
+    std::atomic<qint64> m_openStartUs{-1};     ///< 打开媒体的开始时间，-1 表示无
+    std::atomic<qint64> m_seekStartUs{-1};     ///< 跳转的开始时间，-1 表示无
+    std::atomic<qint64> m_lastFrameWallUs{-1}; ///< 上一帧送达时间
+    std::atomic<qint64> m_lastFramePtsUs{-1};  ///< 上一帧时间戳
+    QTimer* m_metricsDumpTimer;                ///< 指标导出定时器
+    QString m_metricsDumpPath;                 ///< 指标导出文件路径
 };
 
 #endif // AURORAPLAYER_PLAYERCONTROLLER_H
\ No newline at end of file
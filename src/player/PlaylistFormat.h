@@ -0,0 +1,60 @@
+/********************************************************************************
+ * @file   : PlaylistFormat.h
+ * @brief  : 定义了播放列表文件格式。
+ *
+ * 该文件定义了播放列表文件的格式枚举和紧凑二进制格式的文件头。二进制格式
+ * 由文件头、count + 1 个字符串偏移和 UTF-8 路径区组成，可直接内存映射读取。
+ *
+ * @author : polarours
+ * @date   : 2026/10/18
+ ********************************************************************************/
+
+#ifndef AURORAPLAYER_PLAYLISTFORMAT_H
+#define AURORAPLAYER_PLAYLISTFORMAT_H
+
+#include <QString>
+#include <QtGlobal>
+
+/**
+ * @brief 播放列表文件格式
+ */
+enum class PlaylistFileFormat {
+    M3U8,  ///< 扩展 M3U（UTF-8）
+    Binary ///< 紧凑二进制格式（.apl）
+};
+
+/**
+ * @struct PlaylistBinaryHeader
+ * @brief 二进制播放列表文件头（64 字节）
+ */
+struct PlaylistBinaryHeader
+{
+    static constexpr char kMagic[8] = {'A', 'U', 'R', 'P', 'L', 'S', '\0', '\0'}; ///< 文件魔数
+    static constexpr quint32 kVersion = 1;                                        ///< 格式版本
+    static constexpr quint32 kByteOrderMark = 0x01020304;                         ///< 字节序标记
+
+    char magic[8];          ///< 文件魔数
+    quint32 version;        ///< 格式版本
+    quint32 byteOrder;      ///< 写入时的字节序标记
+    quint64 count;          ///< 条目数量
+    quint64 offsetsOffset;  ///< 偏移数组（quint64 × (count + 1)）的文件偏移
+    quint64 stringsOffset;  ///< 路径区的文件偏移
+    quint64 stringsSize;    ///< 路径区大小
+    quint8 reserved[16];    ///< 保留
+};
+
+static_assert(sizeof(PlaylistBinaryHeader) == 64, "PlaylistBinaryHeader layout changed");
+
+/**
+ * @brief 根据扩展名选择保存格式
+ *
+ * @param filePath 文件路径
+ * @return PlaylistFileFormat 文件格式
+ */
+inline PlaylistFileFormat playlistFormatForPath(const QString& filePath)
+{
+    return filePath.endsWith(QStringLiteral(".apl"), Qt::CaseInsensitive) ? PlaylistFileFormat::Binary
+                                                                          : PlaylistFileFormat::M3U8;
+}
+
+#endif // AURORAPLAYER_PLAYLISTFORMAT_H
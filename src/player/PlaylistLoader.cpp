@@ -0,0 +1,339 @@
+/********************************************************************************
+ * @file   : PlaylistLoader.cpp
+ * @brief  : 实现了 PlaylistLoader 类。
+ *
+ * @author : polarours
+ * @date   : 2026/10/18
+ ********************************************************************************/
+
+#include "PlaylistLoader.h"
+#include "PlaylistFormat.h"
+#include "../core/Tracer.h"
+
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QMutex>
+#include <QMutexLocker>
+#include <QTimer>
+#include <QUrl>
+
+#include <atomic>
+#include <cstring>
+
+namespace {
+
+    constexpr int kBatchSize = 8192;      ///< 每批回送的条目数
+    constexpr int kFlushIntervalMs = 100; ///< 结果回送间隔（毫秒）
+
+} // namespace
+
+/**
+ * @brief 一次加载的共享状态
+ */
+struct PlaylistLoader::LoadState {
+    std::atomic<bool> cancelled{false};      ///< 是否已取消
+    std::atomic<bool> done{false};           ///< 工作线程是否已结束
+    std::atomic<qint64> processedBytes{0};   ///< 已处理字节数
+    std::atomic<qint64> totalBytes{0};       ///< 文件总字节数
+    QMutex mutex;                            ///< 保护以下成员
+    QList<QStringList> readyBatches;         ///< 待回送的结果批次
+    QString error;                           ///< 错误信息
+
+    /**
+     * @brief 提交一批结果
+     */
+    void push(QStringList& batch)
+    {
+        if (batch.isEmpty()) {
+            return;
+        }
+        QMutexLocker locker(&mutex);
+        readyBatches.append(std::move(batch));
+        batch = QStringList();
+        batch.reserve(kBatchSize);
+    }
+
+    /**
+     * @brief 记录错误
+     */
+    void fail(const QString& message)
+    {
+        QMutexLocker locker(&mutex);
+        error = message;
+    }
+};
+
+/**
+ * @brief 构造函数
+ *
+ * @param parent 父对象
+ */
+PlaylistLoader::PlaylistLoader(QObject* parent)
+    : QObject(parent)
+    , m_flushTimer(new QTimer(this))
+{
+    m_flushTimer->setInterval(kFlushIntervalMs);
+    connect(m_flushTimer, &QTimer::timeout, this, &PlaylistLoader::flush);
+}
+
+/**
+ * @brief 析构函数，取消并等待加载任务
+ */
+PlaylistLoader::~PlaylistLoader()
+{
+    if (m_state) {
+        m_state->cancelled.store(true, std::memory_order_relaxed);
+    }
+    m_tasks.wait();
+}
+
+/**
+ * @brief 开始加载
+ *
+ * @param filePath 播放列表文件路径
+ */
+void PlaylistLoader::start(const QString& filePath)
+{
+    if (isRunning()) {
+        cancel();
+    }
+
+    auto state = std::make_shared<LoadState>();
+    m_state = state;
+    // 用户在等待列表出现，按交互优先级执行
+    TaskScheduler::instance().submit(TaskScheduler::Priority::Interactive, [state, filePath]() {
+        // 按魔数判断格式
+        QFile file(filePath);
+        char magic[sizeof(PlaylistBinaryHeader::kMagic)] = {};
+        const bool binary = file.open(QIODevice::ReadOnly)
+                            && file.read(magic, sizeof(magic)) == static_cast<qint64>(sizeof(magic))
+                            && std::memcmp(magic, PlaylistBinaryHeader::kMagic, sizeof(magic)) == 0;
+        file.close();
+
+        if (binary) {
+            readBinary(state, filePath);
+        } else {
+            parseM3U(state, filePath);
+        }
+        state->done.store(true, std::memory_order_release);
+    }, &m_tasks);
+    m_flushTimer->start();
+}
+
+/**
+ * @brief 是否正在加载
+ *
+ * @return bool 是否正在加载
+ */
+bool PlaylistLoader::isRunning() const
+{
+    return m_state != nullptr;
+}
+
+/**
+ * @brief 取消加载
+ */
+void PlaylistLoader::cancel()
+{
+    if (!m_state) {
+        return;
+    }
+
+    m_state->cancelled.store(true, std::memory_order_relaxed);
+    m_state.reset();
+    m_flushTimer->stop();
+    emit finished(true);
+}
+
+/**
+ * @brief 将工作线程积累的结果回送到界面线程
+ */
+void PlaylistLoader::flush()
+{
+    if (!m_state) {
+        return;
+    }
+
+    // 先读完成标志再取结果：工作线程在置位前已提交全部结果
+    const bool done = m_state->done.load(std::memory_order_acquire);
+
+    QList<QStringList> batches;
+    QString error;
+    {
+        QMutexLocker locker(&m_state->mutex);
+        batches.swap(m_state->readyBatches);
+        error = m_state->error;
+    }
+
+    QStringList merged;
+    for (QStringList& batch : batches) {
+        if (merged.isEmpty()) {
+            merged = std::move(batch);
+        } else {
+            merged.append(batch);
+        }
+    }
+    if (!merged.isEmpty()) {
+        emit batchReady(merged);
+    }
+
+    emit progress(m_state->processedBytes.load(std::memory_order_relaxed),
+                  m_state->totalBytes.load(std::memory_order_relaxed));
+
+    if (done) {
+        m_state.reset();
+        m_flushTimer->stop();
+        if (error.isEmpty()) {
+            emit finished(false);
+        } else {
+            emit failed(error);
+        }
+    }
+}
+
+/**
+ * @brief 流式解析 M3U/M3U8
+ *
+ * 文件整体映射后按行扫描，注释和 #EXTINF 行直接跳过，每个条目只在
+ * 最终构造 QString 时分配一次。相对路径相对于播放列表所在目录解析。
+ */
+void PlaylistLoader::parseM3U(const std::shared_ptr<LoadState>& state, const QString& filePath)
+{
+    AURORA_TRACE_SCOPE("playlist", "parseM3U");
+
+    QFile file(filePath);
+    if (!file.open(QIODevice::ReadOnly)) {
+        state->fail(file.errorString());
+        return;
+    }
+
+    const qint64 size = file.size();
+    state->totalBytes.store(size, std::memory_order_relaxed);
+
+    // 无法映射时（如管道、特殊文件系统）退回一次性读取
+    QByteArray fallback;
+    const char* data = nullptr;
+    qint64 length = 0;
+    if (size > 0) {
+        data = reinterpret_cast<const char*>(file.map(0, size));
+        length = size;
+    }
+    if (!data) {
+        fallback = file.readAll();
+        data = fallback.constData();
+        length = fallback.size();
+    }
+
+    const QString baseDir = QFileInfo(filePath).absolutePath();
+    QStringList batch;
+    batch.reserve(kBatchSize);
+
+    qint64 pos = 0;
+    if (length >= 3 && std::memcmp(data, "\xEF\xBB\xBF", 3) == 0) {
+        pos = 3; // UTF-8 BOM
+    }
+
+    while (pos < length) {
+        const char* lineStart = data + pos;
+        const char* newline = static_cast<const char*>(std::memchr(lineStart, '\n', static_cast<size_t>(length - pos)));
+        const qint64 lineEnd = newline ? newline - data : length;
+        pos = lineEnd + 1;
+
+        // 去除首尾空白（包括 Windows 换行的 \r）
+        qint64 begin = lineStart - data;
+        qint64 end = lineEnd;
+        while (begin < end && static_cast<uchar>(data[begin]) <= ' ') {
+            ++begin;
+        }
+        while (end > begin && static_cast<uchar>(data[end - 1]) <= ' ') {
+            --end;
+        }
+        if (begin == end || data[begin] == '#') {
+            continue;
+        }
+
+        QString entry = QString::fromUtf8(data + begin, static_cast<qsizetype>(end - begin));
+        if (entry.startsWith(QStringLiteral("file:"), Qt::CaseInsensitive)) {
+            entry = QUrl(entry).toLocalFile();
+        } else if (!entry.contains(QStringLiteral("://")) && QDir::isRelativePath(entry)) {
+            entry = QDir::cleanPath(baseDir + QLatin1Char('/') + entry);
+        }
+        batch.append(std::move(entry));
+
+        if (batch.size() >= kBatchSize) {
+            if (state->cancelled.load(std::memory_order_relaxed)) {
+                return;
+            }
+            state->push(batch);
+            state->processedBytes.store(pos, std::memory_order_relaxed);
+        }
+    }
+
+    state->push(batch);
+    state->processedBytes.store(length, std::memory_order_relaxed);
+}
+
+/**
+ * @brief 内存映射读取二进制播放列表
+ *
+ * 路径区为连续的 UTF-8 字节，按偏移数组直接切分，无需逐行解析。
+ */
+void PlaylistLoader::readBinary(const std::shared_ptr<LoadState>& state, const QString& filePath)
+{
+    AURORA_TRACE_SCOPE("playlist", "readBinary");
+
+    QFile file(filePath);
+    if (!file.open(QIODevice::ReadOnly)) {
+        state->fail(file.errorString());
+        return;
+    }
+
+    const qint64 size = file.size();
+    state->totalBytes.store(size, std::memory_order_relaxed);
+    const uchar* data = size >= static_cast<qint64>(sizeof(PlaylistBinaryHeader)) ? file.map(0, size) : nullptr;
+    if (!data) {
+        state->fail(tr("Invalid playlist file"));
+        return;
+    }
+
+    const PlaylistBinaryHeader* header = reinterpret_cast<const PlaylistBinaryHeader*>(data);
+    const quint64 fileSize = static_cast<quint64>(size);
+    if (header->version != PlaylistBinaryHeader::kVersion
+        || header->byteOrder != PlaylistBinaryHeader::kByteOrderMark
+        || header->offsetsOffset % sizeof(quint64) != 0
+        || header->count >= fileSize / sizeof(quint64)
+        || header->offsetsOffset > fileSize
+        || (header->count + 1) * sizeof(quint64) > fileSize - header->offsetsOffset
+        || header->stringsOffset > fileSize
+        || header->stringsSize > fileSize - header->stringsOffset) {
+        state->fail(tr("Unsupported playlist file version"));
+        return;
+    }
+
+    const quint64* offsets = reinterpret_cast<const quint64*>(data + header->offsetsOffset);
+    const char* strings = reinterpret_cast<const char*>(data + header->stringsOffset);
+
+    QStringList batch;
+    batch.reserve(kBatchSize);
+    for (quint64 i = 0; i < header->count; ++i) {
+        const quint64 begin = offsets[i];
+        const quint64 end = offsets[i + 1];
+        if (begin > end || end > header->stringsSize) {
+            state->fail(tr("Corrupted playlist file"));
+            break;
+        }
+        batch.append(QString::fromUtf8(strings + begin, static_cast<qsizetype>(end - begin)));
+
+        if (batch.size() >= kBatchSize) {
+            if (state->cancelled.load(std::memory_order_relaxed)) {
+                return;
+            }
+            state->push(batch);
+            state->processedBytes.store(static_cast<qint64>(header->stringsOffset + end), std::memory_order_relaxed);
+        }
+    }
+
+    state->push(batch);
+    state->processedBytes.store(size, std::memory_order_relaxed);
+}
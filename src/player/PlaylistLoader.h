@@ -0,0 +1,124 @@
+/********************************************************************************
+ * @file   : PlaylistLoader.h
+ * @brief  : 声明了 PlaylistLoader 类。
+ *
+ * 该文件声明了播放列表加载器：在工作线程上流式解析 M3U/M3U8 或内存映射
+ * 读取二进制播放列表，条目分批回送到界面线程。
+ *
+ * @author : polarours
+ * @date   : 2026/10/18
+ ********************************************************************************/
+
+#ifndef AURORAPLAYER_PLAYLISTLOADER_H
+#define AURORAPLAYER_PLAYLISTLOADER_H
+
+#include <QObject>
+#include <QStringList>
+
+#include <memory>
+
+#include "../core/TaskScheduler.h"
+
+class QTimer;
+
+/**
+ * @class PlaylistLoader
+ * @brief 播放列表加载器
+ *
+ * 文件格式按开头的魔数判断，与扩展名无关。
+ */
+class PlaylistLoader : public QObject
+{
+    Q_OBJECT
+
+public:
+    /**
+     * @brief 构造函数
+     *
+     * @param parent 父对象
+     */
+    explicit PlaylistLoader(QObject* parent = nullptr);
+
+    /**
+     * @brief 析构函数，取消并等待加载任务
+     */
+    ~PlaylistLoader();
+
+    /**
+     * @brief 开始加载
+     *
+     * 正在加载时先取消上一次加载。
+     *
+     * @param filePath 播放列表文件路径
+     */
+    void start(const QString& filePath);
+
+    /**
+     * @brief 是否正在加载
+     *
+     * @return bool 是否正在加载
+     */
+    bool isRunning() const;
+
+public slots:
+    /**
+     * @brief 取消加载（已回送的批次保留）
+     */
+    void cancel();
+
+signals:
+    /**
+     * @brief 一批条目已就绪
+     *
+     * @param filePaths 文件路径列表（保持文件中的顺序）
+     */
+    void batchReady(const QStringList& filePaths);
+
+    /**
+     * @brief 加载进度
+     *
+     * @param processedBytes 已处理字节数
+     * @param totalBytes     文件总字节数
+     */
+    void progress(qint64 processedBytes, qint64 totalBytes);
+
+    /**
+     * @brief 加载结束
+     *
+     * @param cancelled 是否被取消
+     */
+    void finished(bool cancelled);
+
+    /**
+     * @brief 加载失败（之后不再发出 finished）
+     *
+     * @param message 错误信息
+     */
+    void failed(const QString& message);
+
+private slots:
+    /**
+     * @brief 将工作线程积累的结果回送到界面线程
+     */
+    void flush();
+
+private:
+    struct LoadState;
+
+    /**
+     * @brief 流式解析 M3U/M3U8（在工作线程执行）
+     */
+    static void parseM3U(const std::shared_ptr<LoadState>& state, const QString& filePath);
+
+    /**
+     * @brief 内存映射读取二进制播放列表（在工作线程执行）
+     */
+    static void readBinary(const std::shared_ptr<LoadState>& state, const QString& filePath);
+
+private:
+    TaskScheduler::Group m_tasks;       ///< 已提交的加载任务
+    QTimer* m_flushTimer;               ///< 结果回送定时器
+    std::shared_ptr<LoadState> m_state; ///< 当前加载的共享状态
+};
+
+#endif // AURORAPLAYER_PLAYLISTLOADER_H
@@ -13,11 +13,25 @@
 #include <QDir>
 #include <QUrl>
 #include <QDebug>
-#include <random>
+#include <algorithm>
+#include <functional>
 
-// 创建一个静态随机数生成器
-static std::random_device rd;
-static std::mt19937 gen(rd());
+#include "../core/Tracer.h"
+#include "../utils/ParallelSort.h"
+
+#include <limits>
+
+namespace {
+
+    /**
+     * @brief 取路径中的文件名部分（不构造 QFileInfo）
+     */
+    QStringView fileNameOf(const QString& path)
+    {
+        return QStringView(path).mid(AuroraPlayer::Utils::fileNameOffset(path));
+    }
+
+} // namespace
 
 /**
  * @brief PlaylistManager 的构造函数。
@@ -28,8 +42,8 @@ PlaylistManager::PlaylistManager(QObject *parent)
     : QObject(parent)
     , m_currentIndex(-1)
     , m_playlistMode(AuroraPlayer::State::PlaylistMode::Sequential)
+    , m_shuffle(&m_playlist)
 {
-    // TODO:
 }
 
 /**
@@ -37,7 +51,7 @@ PlaylistManager::PlaylistManager(QObject *parent)
  */
 PlaylistManager::~PlaylistManager()
 {
-    // TODO: 清理资源
+    // 成员均为值类型，随对象一起释放；探测结果由 MetadataService 在其析构前停止写入
 }
 
 /**
@@ -47,13 +61,7 @@ PlaylistManager::~PlaylistManager()
  */
 void PlaylistManager::addFile(const QString& filePath)
 {
-    m_playlist.append(filePath);
-    emit playlistChanged();
-    
-    // 如果是第一个文件，则设置为当前文件
-    if (m_playlist.size() == 1) {
-        setCurrentIndex(0);
-    }
+    insertFiles(m_playlist.size(), QStringList{filePath});
 }
 
 /**
@@ -63,11 +71,38 @@ void PlaylistManager::addFile(const QString& filePath)
  */
 void PlaylistManager::addFiles(const QStringList& filePaths)
 {
-    m_playlist.append(filePaths);
+    insertFiles(m_playlist.size(), filePaths);
+}
+
+/**
+ * @brief 在指定位置之前批量插入文件。
+ *
+ * @param index      插入位置。
+ * @param filePaths  文件路径列表。
+ */
+void PlaylistManager::insertFiles(int index, const QStringList& filePaths)
+{
+    if (filePaths.isEmpty()) {
+        return;
+    }
+
+    index = qBound(0, index, m_playlist.size());
+    const int last = index + filePaths.size() - 1;
+
+    emit rowsAboutToBeInserted(index, last);
+    m_playlist.insert(index, filePaths);
+    m_shuffle.invalidate();
+    for (int i = 0; i < filePaths.size(); ++i) {
+        m_searchIndex.addText(m_playlist.idAt(index + i), fileNameOf(filePaths.at(i)));
+    }
+    if (m_currentIndex >= index) {
+        m_currentIndex += filePaths.size();
+    }
+    emit rowsInserted(index, last);
     emit playlistChanged();
-    
+
     // 如果是第一次添加文件，则设置第一个文件为当前文件
-    if (m_currentIndex == -1 && !filePaths.isEmpty()) {
+    if (m_currentIndex == -1) {
         setCurrentIndex(0);
     }
 }
@@ -79,28 +114,130 @@ void PlaylistManager::addFiles(const QStringList& filePaths)
  */
 void PlaylistManager::removeFile(int index)
 {
-    if (index >= 0 && index < m_playlist.size()) {
-        m_playlist.removeAt(index);
-        
-        // 调整当前索引
-        if (m_currentIndex >= m_playlist.size()) {
-            m_currentIndex = m_playlist.size() - 1;
-        } else if (m_currentIndex > index) {
-            m_currentIndex--;
-        } else if (m_currentIndex == index) {
-            // 如果删除的是当前文件，则尝试播放下一个文件
-            if (m_currentIndex < m_playlist.size()) {
-                // 当前索引仍然有效
-            } else if (!m_playlist.isEmpty()) {
-                // 当前索引超出范围，设置为最后一个文件
-                m_currentIndex = m_playlist.size() - 1;
-            } else {
-                // 播放列表为空
-                m_currentIndex = -1;
-            }
-            emit playlistChanged();
+    removeFiles(index, 1);
+}
+
+/**
+ * @brief 从播放列表中移除连续的若干文件。
+ *
+ * @param first  起始索引。
+ * @param count  文件数量。
+ */
+void PlaylistManager::removeFiles(int first, int count)
+{
+    if (removeRange(first, count)) {
+        emit playlistChanged();
+    }
+}
+
+/**
+ * @brief 从播放列表中移除任意若干文件。
+ *
+ * 从后往前按连续区间删除，前面区间的索引不受影响。
+ *
+ * @param indexes  文件索引列表。
+ */
+void PlaylistManager::removeFiles(QList<int> indexes)
+{
+    std::sort(indexes.begin(), indexes.end(), std::greater<int>());
+    indexes.erase(std::unique(indexes.begin(), indexes.end()), indexes.end());
+
+    bool changed = false;
+    int i = 0;
+    while (i < indexes.size()) {
+        // 合并连续区间 [low, high]
+        const int high = indexes.at(i);
+        int low = high;
+        while (i + 1 < indexes.size() && indexes.at(i + 1) == low - 1) {
+            ++i;
+            --low;
         }
+        ++i;
+        changed |= removeRange(low, high - low + 1);
+    }
+
+    if (changed) {
+        emit playlistChanged();
+    }
+}
+
+/**
+ * @brief 将连续的若干文件移动到目标位置之前。
+ *
+ * @param first        起始索引。
+ * @param count        文件数量。
+ * @param destination  目标位置（移动前的索引）。
+ * @return bool  是否移动成功。
+ */
+bool PlaylistManager::moveFiles(int first, int count, int destination)
+{
+    const int size = m_playlist.size();
+    if (first < 0 || count <= 0 || first + count > size
+        || destination < 0 || destination > size
+        || (destination >= first && destination <= first + count)) {
+        return false;
     }
+
+    const int last = first + count - 1;
+    emit rowsAboutToBeMoved(first, last, destination);
+    m_playlist.move(first, count, destination);
+    m_shuffle.invalidate();
+
+    // 调整当前索引
+    if (m_currentIndex >= first && m_currentIndex <= last) {
+        const int offset = m_currentIndex - first;
+        m_currentIndex = destination < first ? destination + offset : destination - count + offset;
+    } else if (destination < first && m_currentIndex >= destination && m_currentIndex < first) {
+        m_currentIndex += count;
+    } else if (destination > last && m_currentIndex > last && m_currentIndex < destination) {
+        m_currentIndex -= count;
+    }
+
+    emit rowsMoved(first, last, destination);
+    emit playlistChanged();
+    return true;
+}
+
+/**
+ * @brief 按指定依据对整个播放列表排序
+ *
+ * 当前播放的条目保持不变，只更新其行号；不发出 currentIndexChanged。
+ *
+ * @param key   排序依据
+ * @param order 升序或降序
+ */
+void PlaylistManager::sort(SortKey key, Qt::SortOrder order)
+{
+    AURORA_TRACE_SCOPE("playlist", "sort");
+
+    if (m_playlist.size() < 2) {
+        return;
+    }
+
+    const bool descending = order == Qt::DescendingOrder;
+    std::vector<quint32> rows;
+    switch (key) {
+        case SortKey::FileName:
+        case SortKey::FilePath:
+        case SortKey::Title:
+        case SortKey::Artist:
+        case SortKey::Album:
+            rows = sortedByText(key, descending);
+            break;
+        case SortKey::Duration:
+        case SortKey::ModifiedTime:
+        case SortKey::FileSize:
+            rows = sortedByNumber(key, descending);
+            break;
+    }
+
+    const ItemId currentId = m_playlist.idAt(m_currentIndex);
+    emit layoutAboutToBeChanged();
+    m_playlist.permute(rows);
+    m_shuffle.invalidate();
+    m_currentIndex = m_playlist.rowOf(currentId);
+    emit layoutChanged();
+    emit playlistChanged();
 }
 
 /**
@@ -108,8 +245,13 @@ void PlaylistManager::removeFile(int index)
  */
 void PlaylistManager::clear()
 {
+    emit playlistAboutToBeReset();
     m_playlist.clear();
+    m_metadata.clear();
+    m_searchIndex.clear();
+    m_shuffle.reset();
     m_currentIndex = -1;
+    emit playlistReset();
     emit playlistChanged();
 }
 
@@ -141,10 +283,169 @@ int PlaylistManager::currentIndex() const
  */
 QString PlaylistManager::filePathAt(int index) const
 {
-    if (index >= 0 && index < m_playlist.size()) {
-        return m_playlist.at(index);
+    return m_playlist.pathAt(index);
+}
+
+/**
+ * @brief 统计播放列表路径占用的内存
+ *
+ * @return PlaylistStorage::MemoryStats 内存统计
+ */
+PlaylistStorage::MemoryStats PlaylistManager::pathMemoryStats() const
+{
+    return m_playlist.memoryStats();
+}
+
+/**
+ * @brief 获取指定索引的稳定条目 ID
+ *
+ * @param index 文件索引
+ * @return ItemId 条目 ID
+ */
+PlaylistManager::ItemId PlaylistManager::itemIdAt(int index) const
+{
+    return m_playlist.idAt(index);
+}
+
+/**
+ * @brief 根据条目 ID 查找当前索引
+ *
+ * @param id 条目 ID
+ * @return int 文件索引，不存在时为 -1
+ */
+int PlaylistManager::indexOfItem(ItemId id) const
+{
+    return m_playlist.rowOf(id);
+}
+
+/**
+ * @brief 获取指定索引的元数据
+ *
+ * @param index 文件索引
+ * @return const MediaMetadata* 元数据，尚未探测时为 nullptr
+ */
+const MediaMetadata* PlaylistManager::metadataAt(int index) const
+{
+    const auto it = m_metadata.constFind(m_playlist.idAt(index));
+    return it != m_metadata.constEnd() ? &it.value() : nullptr;
+}
+
+/**
+ * @brief 条目是否已有元数据
+ *
+ * @param id 条目 ID
+ * @return bool 是否已有元数据
+ */
+bool PlaylistManager::hasMetadata(ItemId id) const
+{
+    return m_metadata.contains(id);
+}
+
+/**
+ * @brief 批量写入元数据
+ *
+ * 受影响的行一般不连续，只发出一次覆盖最小到最大行的 metadataChanged，
+ * 视图只会重绘其中可见的部分。
+ *
+ * @param batch 条目 ID 与元数据列表
+ */
+void PlaylistManager::setMetadata(const QList<QPair<ItemId, MediaMetadata>>& batch)
+{
+    int first = -1;
+    int last = -1;
+    for (const auto& item : batch) {
+        const int row = m_playlist.rowOf(item.first);
+        if (row < 0) {
+            continue;
+        }
+        m_metadata.insert(item.first, item.second);
+        m_searchIndex.addText(item.first, item.second.title);
+        m_searchIndex.addText(item.first, item.second.artist);
+        m_searchIndex.addText(item.first, item.second.album);
+        first = first < 0 ? row : qMin(first, row);
+        last = qMax(last, row);
+    }
+
+    if (first >= 0) {
+        emit metadataChanged(first, last);
     }
-    return QString();
+}
+
+/**
+ * @brief 获取按播放顺序接下来的若干文件索引
+ *
+ * @param count 最多返回的数量
+ * @return QList<int> 文件索引列表
+ */
+QList<int> PlaylistManager::upcomingIndexes(int count) const
+{
+    QList<int> indexes;
+    const int size = m_playlist.size();
+    if (size == 0) {
+        return indexes;
+    }
+
+    if (m_playlistMode == AuroraPlayer::State::PlaylistMode::Random) {
+        for (ItemId id : m_shuffle.upcoming(m_playlist.idAt(m_currentIndex), count)) {
+            indexes.append(m_playlist.rowOf(id));
+        }
+        return indexes;
+    }
+
+    const bool loop = m_playlistMode == AuroraPlayer::State::PlaylistMode::Loop;
+    for (int i = 1; i <= count && i < size; ++i) {
+        int index = m_currentIndex + i;
+        if (index >= size) {
+            if (!loop) {
+                break;
+            }
+            index -= size;
+        }
+        indexes.append(index);
+    }
+    return indexes;
+}
+
+/**
+ * @brief 查询串是否足够长，可以使用搜索索引
+ *
+ * @param query 查询串
+ * @return bool 是否可以搜索
+ */
+bool PlaylistManager::isSearchable(const QString& query)
+{
+    return TrigramIndex::fold(query).size() >= TrigramIndex::kGramLength;
+}
+
+/**
+ * @brief 搜索文件名或标签包含查询串的文件
+ *
+ * 索引只给出包含全部三元组的候选，仍需逐个校验子串，例如 "abcd" 的
+ * 三元组可能分别来自文件名和标签。
+ *
+ * @param query 查询串
+ * @return QList<int> 匹配的文件索引（升序）
+ */
+QList<int> PlaylistManager::search(const QString& query)
+{
+    AURORA_TRACE_SCOPE("playlist", "search");
+
+    QList<int> rows;
+    const QString folded = TrigramIndex::fold(query);
+    if (folded.size() < TrigramIndex::kGramLength) {
+        return rows;
+    }
+
+    const QList<ItemId> candidates = m_searchIndex.candidates(folded);
+    rows.reserve(candidates.size());
+    for (ItemId id : candidates) {
+        const int row = m_playlist.rowOf(id);
+        if (row >= 0 && matches(row, folded)) {
+            rows.append(row);
+        }
+    }
+    std::sort(rows.begin(), rows.end());
+    return rows;
 }
 
 /**
@@ -166,7 +467,7 @@ void PlaylistManager::setCurrentIndex(int index)
 {
     if (index >= 0 && index < m_playlist.size() && index != m_currentIndex) {
         m_currentIndex = index;
-        emit currentIndexChanged(m_playlist.at(index));
+        emit currentIndexChanged(m_playlist.pathAt(index));
     }
 }
 
@@ -200,13 +501,11 @@ bool PlaylistManager::next()
             
         case AuroraPlayer::State::PlaylistMode::Random:
             if (m_playlist.size() > 1) {
-                // 简单的随机实现
-                std::uniform_int_distribution<> dis(0, m_playlist.size() - 1);
-                do {
-                    nextIndex = dis(gen);
-                } while (nextIndex == m_currentIndex && m_playlist.size() > 1);
-                setCurrentIndex(nextIndex);
-                return true;
+                nextIndex = m_playlist.rowOf(m_shuffle.next(m_playlist.idAt(m_currentIndex)));
+                if (nextIndex >= 0) {
+                    setCurrentIndex(nextIndex);
+                    return true;
+                }
             }
             break;
     }
@@ -243,12 +542,9 @@ bool PlaylistManager::previous()
             return true;
             
         case AuroraPlayer::State::PlaylistMode::Random:
-            if (m_playlist.size() > 1) {
-                // 简单的随机实现
-                std::uniform_int_distribution<> dis(0, m_playlist.size() - 1);
-                do {
-                    prevIndex = dis(gen);
-                } while (prevIndex == m_currentIndex && m_playlist.size() > 1);
+            // 沿播放历史后退，没有历史时停在当前条目
+            prevIndex = m_playlist.rowOf(m_shuffle.previous(m_playlist.idAt(m_currentIndex)));
+            if (prevIndex >= 0) {
                 setCurrentIndex(prevIndex);
                 return true;
             }
@@ -295,5 +591,152 @@ AuroraPlayer::State::PlaylistMode PlaylistManager::playlistMode() const
  */
 void PlaylistManager::setPlaylistMode(AuroraPlayer::State::PlaylistMode mode)
 {
+    if (mode == AuroraPlayer::State::PlaylistMode::Random && m_playlistMode != mode) {
+        m_shuffle.reset();
+    }
     m_playlistMode = mode;
 }
+
+/**
+ * @brief 删除连续区间并调整当前索引（不发出 playlistChanged）
+ *
+ * 删除当前文件时，当前索引指向原位置的下一个文件（或最后一个文件），
+ * 不发出 currentIndexChanged，避免打断正在进行的播放。
+ *
+ * @param first  起始索引。
+ * @param count  文件数量。
+ * @return bool  是否删除了文件。
+ */
+bool PlaylistManager::removeRange(int first, int count)
+{
+    if (first < 0 || count <= 0 || first >= m_playlist.size()) {
+        return false;
+    }
+
+    count = qMin(count, m_playlist.size() - first);
+    const int last = first + count - 1;
+
+    emit rowsAboutToBeRemoved(first, last);
+    for (int i = first; i <= last; ++i) {
+        const ItemId id = m_playlist.idAt(i);
+        m_metadata.remove(id);
+        m_searchIndex.remove(id);
+    }
+    m_playlist.remove(first, count);
+    m_shuffle.invalidate();
+
+    if (m_currentIndex > last) {
+        m_currentIndex -= count;
+    } else if (m_currentIndex >= first) {
+        m_currentIndex = m_playlist.isEmpty() ? -1 : qMin(first, m_playlist.size() - 1);
+    }
+
+    emit rowsRemoved(first, last);
+    return true;
+}
+
+/**
+ * @brief 判断条目是否包含已折叠的查询串
+ *
+ * @param index       文件索引
+ * @param foldedQuery 已大小写折叠的查询串
+ * @return bool 是否匹配
+ */
+bool PlaylistManager::matches(int index, const QString& foldedQuery) const
+{
+    if (m_playlist.fileNameAt(index).contains(foldedQuery, Qt::CaseInsensitive)) {
+        return true;
+    }
+
+    const MediaMetadata* metadata = metadataAt(index);
+    return metadata
+           && (metadata->title.contains(foldedQuery, Qt::CaseInsensitive)
+               || metadata->artist.contains(foldedQuery, Qt::CaseInsensitive)
+               || metadata->album.contains(foldedQuery, Qt::CaseInsensitive));
+}
+
+/**
+ * @brief 按文本键排序，返回新顺序
+ *
+ * 键在排序前统一做大小写折叠，比较时只做码位比较。空键（无标签）排在最后。
+ *
+ * @param key        排序依据
+ * @param descending 是否降序
+ * @return std::vector<quint32> 新顺序
+ */
+std::vector<quint32> PlaylistManager::sortedByText(SortKey key, bool descending) const
+{
+    const size_t count = static_cast<size_t>(m_playlist.size());
+    std::vector<QString> keys(count);
+    AuroraPlayer::Utils::parallelFor(count, [this, key, &keys](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            const int row = static_cast<int>(i);
+            QString text;
+            if (key == SortKey::FileName) {
+                text = m_playlist.fileNameAt(row);
+            } else if (key == SortKey::FilePath) {
+                text = m_playlist.pathAt(row);
+            } else if (const MediaMetadata* metadata = metadataAt(row)) {
+                text = key == SortKey::Title ? metadata->title
+                       : key == SortKey::Artist ? metadata->artist
+                                                : metadata->album;
+            }
+            keys[i] = text.toCaseFolded();
+        }
+    });
+
+    std::vector<quint32> rows(count);
+    for (size_t i = 0; i < count; ++i) {
+        rows[i] = static_cast<quint32>(i);
+    }
+    AuroraPlayer::Utils::parallelStableSort(rows, [&keys, descending](quint32 a, quint32 b) {
+        const QString& left = keys[a];
+        const QString& right = keys[b];
+        if (left.isEmpty() || right.isEmpty()) {
+            return !left.isEmpty() && right.isEmpty();
+        }
+        return descending ? right < left : left < right;
+    });
+    return rows;
+}
+
+/**
+ * @brief 按数值键排序，返回新顺序
+ *
+ * 键与行号打包成 16 字节的连续数组，比较时不再访问元数据哈希表。
+ * 降序通过对键取反实现，未知值映射为最大值，因此总在最后。
+ *
+ * @param key        排序依据
+ * @param descending 是否降序
+ * @return std::vector<quint32> 新顺序
+ */
+std::vector<quint32> PlaylistManager::sortedByNumber(SortKey key, bool descending) const
+{
+    struct Item {
+        qint64 key;
+        quint32 row;
+    };
+
+    const size_t count = static_cast<size_t>(m_playlist.size());
+    std::vector<Item> items(count);
+    AuroraPlayer::Utils::parallelFor(count, [this, key, descending, &items](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            qint64 value = -1;
+            if (const MediaMetadata* metadata = metadataAt(static_cast<int>(i))) {
+                value = key == SortKey::Duration ? metadata->durationMs
+                        : key == SortKey::ModifiedTime ? metadata->modifiedMs
+                                                       : metadata->fileSize;
+            }
+            items[i].key = value < 0 ? std::numeric_limits<qint64>::max() : (descending ? -value : value);
+            items[i].row = static_cast<quint32>(i);
+        }
+    });
+
+    AuroraPlayer::Utils::parallelStableSort(items, [](const Item& a, const Item& b) { return a.key < b.key; });
+
+    std::vector<quint32> rows(count);
+    for (size_t i = 0; i < count; ++i) {
+        rows[i] = items[i].row;
+    }
+    return rows;
+}
@@ -11,9 +11,18 @@
 #ifndef PLAYLISTMANAGER_H
 #define PLAYLISTMANAGER_H
 
+#include <QHash>
 #include <QObject>
+#include <QPair>
 #include <QStringList>
+
+#include <vector>
+
 #include "CommonState.h"
+#include "PlaylistStorage.h"
+#include "ShuffleBag.h"
+#include "TrigramIndex.h"
+#include "../core/MediaMetadata.h"
 
 /**
  * @class PlaylistManager
@@ -27,6 +36,25 @@ class PlaylistManager : public QObject
     Q_OBJECT
 
 public:
+    using ItemId = PlaylistStorage::ItemId;
+
+    /**
+     * @brief 排序依据
+     *
+     * 时长、修改时间、文件大小和标签来自已探测的元数据，尚未探测的条目
+     * 无论升序降序都排在最后。
+     */
+    enum class SortKey {
+        FileName,     ///< 文件名
+        FilePath,     ///< 完整路径
+        Duration,     ///< 时长
+        ModifiedTime, ///< 修改时间
+        FileSize,     ///< 文件大小
+        Title,        ///< 标题
+        Artist,       ///< 艺术家
+        Album         ///< 专辑
+    };
+
     /**
      * @brief 构造函数
      * @param parent 父对象
@@ -48,10 +76,20 @@ public:
     /**
      * @brief 批量添加文件到播放列表
      *
+     * 整批只发出一次 rowsInserted 和 playlistChanged。
+     *
      * @param filePaths 文件路径列表
      */
     void addFiles(const QStringList& filePaths);
 
+    /**
+     * @brief 在指定位置之前批量插入文件
+     *
+     * @param index     插入位置
+     * @param filePaths 文件路径列表
+     */
+    void insertFiles(int index, const QStringList& filePaths);
+
     /**
      * @brief 从播放列表中移除文件
      *
@@ -59,6 +97,44 @@ public:
      */
     void removeFile(int index);
 
+    /**
+     * @brief 从播放列表中移除连续的若干文件
+     *
+     * @param first 起始索引
+     * @param count 文件数量
+     */
+    void removeFiles(int first, int count);
+
+    /**
+     * @brief 从播放列表中移除任意若干文件
+     *
+     * 索引会被排序并合并为连续区间，每个区间只平移一次。
+     *
+     * @param indexes 文件索引列表
+     */
+    void removeFiles(QList<int> indexes);
+
+    /**
+     * @brief 将连续的若干文件移动到目标位置之前
+     *
+     * @param first       起始索引
+     * @param count       文件数量
+     * @param destination 目标位置（移动前的索引）
+     * @return bool 是否移动成功
+     */
+    bool moveFiles(int first, int count, int destination);
+
+    /**
+     * @brief 按指定依据对整个播放列表排序（稳定排序）
+     *
+     * 排序键先并行提取到连续数组，再并行排序，最后一次性重排条目；
+     * 只发出一对 layoutAboutToBeChanged/layoutChanged。
+     *
+     * @param key   排序依据
+     * @param order 升序或降序
+     */
+    void sort(SortKey key, Qt::SortOrder order = Qt::AscendingOrder);
+
     /**
      * @brief 清空播放列表
      */
@@ -86,6 +162,85 @@ public:
      */
     QString filePathAt(int index) const;
 
+    /**
+     * @brief 统计播放列表路径占用的内存
+     *
+     * @return PlaylistStorage::MemoryStats 实际占用与以 QString 保存时的估算占用
+     */
+    PlaylistStorage::MemoryStats pathMemoryStats() const;
+
+    /**
+     * @brief 获取指定索引的稳定条目 ID
+     *
+     * 条目 ID 在插入、删除、移动后保持不变，可用于跨结构变化引用条目。
+     *
+     * @param index 文件索引
+     * @return ItemId 条目 ID，越界时为 PlaylistStorage::InvalidId
+     */
+    ItemId itemIdAt(int index) const;
+
+    /**
+     * @brief 根据条目 ID 查找当前索引
+     *
+     * @param id 条目 ID
+     * @return int 文件索引，不存在时为 -1
+     */
+    int indexOfItem(ItemId id) const;
+
+    /**
+     * @brief 获取指定索引的元数据
+     *
+     * @param index 文件索引
+     * @return const MediaMetadata* 元数据，尚未探测时为 nullptr
+     */
+    const MediaMetadata* metadataAt(int index) const;
+
+    /**
+     * @brief 条目是否已有元数据
+     *
+     * @param id 条目 ID
+     * @return bool 是否已有元数据
+     */
+    bool hasMetadata(ItemId id) const;
+
+    /**
+     * @brief 批量写入元数据
+     *
+     * 已不在列表中的条目被忽略；整批只发出一次 metadataChanged。
+     *
+     * @param batch 条目 ID 与元数据列表
+     */
+    void setMetadata(const QList<QPair<ItemId, MediaMetadata>>& batch);
+
+    /**
+     * @brief 获取按播放顺序接下来的若干文件索引
+     *
+     * @param count 最多返回的数量
+     * @return QList<int> 文件索引列表（随机模式下为洗牌袋预先抽出的条目）
+     */
+    QList<int> upcomingIndexes(int count) const;
+
+    /**
+     * @brief 查询串是否足够长，可以使用搜索索引
+     *
+     * 短于三个字符（大小写折叠后）的查询串无法使用三元组索引；线性扫描在大列表上
+     * 远超按键响应预算，因此不支持。
+     *
+     * @param query 查询串
+     * @return bool 是否可以搜索
+     */
+    static bool isSearchable(const QString& query);
+
+    /**
+     * @brief 搜索文件名或标签（标题、艺术家、专辑）包含查询串的文件
+     *
+     * 不区分大小写，只使用三元组索引，不做线性扫描。
+     *
+     * @param query 查询串
+     * @return QList<int> 匹配的文件索引（升序）；查询串不满足 isSearchable() 时为空
+     */
+    QList<int> search(const QString& query);
+
     /**
      * @brief 获取当前播放的文件路径
      *
@@ -145,9 +300,67 @@ public:
 signals:
     /**
      * @brief 播放列表发生变化信号
+     *
+     * 每次批量操作结束后发出一次，用于只关心“有变化”的监听者；
+     * 需要同步行的监听者应使用下面的细粒度信号。
      */
     void playlistChanged();
 
+    /**
+     * @brief 即将插入 [first, last] 行
+     */
+    void rowsAboutToBeInserted(int first, int last);
+
+    /**
+     * @brief 已插入 [first, last] 行
+     */
+    void rowsInserted(int first, int last);
+
+    /**
+     * @brief 即将删除 [first, last] 行
+     */
+    void rowsAboutToBeRemoved(int first, int last);
+
+    /**
+     * @brief 已删除 [first, last] 行
+     */
+    void rowsRemoved(int first, int last);
+
+    /**
+     * @brief 即将把 [first, last] 行移动到 destination 之前
+     */
+    void rowsAboutToBeMoved(int first, int last, int destination);
+
+    /**
+     * @brief 已把 [first, last] 行移动到 destination 之前
+     */
+    void rowsMoved(int first, int last, int destination);
+
+    /**
+     * @brief 即将整体重排（条目不变，行号改变）
+     */
+    void layoutAboutToBeChanged();
+
+    /**
+     * @brief 已整体重排
+     */
+    void layoutChanged();
+
+    /**
+     * @brief [first, last] 行中有条目的元数据已更新
+     */
+    void metadataChanged(int first, int last);
+
+    /**
+     * @brief 播放列表即将整体重置（清空）
+     */
+    void playlistAboutToBeReset();
+
+    /**
+     * @brief 播放列表已整体重置（清空）
+     */
+    void playlistReset();
+
     /**
      * @brief 当前播放项发生变化信号
      *
@@ -156,9 +369,37 @@ signals:
     void currentIndexChanged(const QString& mediaPath);
 
 private:
-    QStringList m_playlist;                           ///< 播放列表
+    /**
+     * @brief 删除连续区间并调整当前索引（不发出 playlistChanged）
+     *
+     * @param first 起始索引
+     * @param count 文件数量
+     * @return bool 是否删除了文件
+     */
+    bool removeRange(int first, int count);
+
+    /**
+     * @brief 判断条目是否包含已折叠的查询串
+     */
+    bool matches(int index, const QString& foldedQuery) const;
+
+    /**
+     * @brief 按文本键排序，返回新顺序
+     */
+    std::vector<quint32> sortedByText(SortKey key, bool descending) const;
+
+    /**
+     * @brief 按数值键排序，返回新顺序
+     */
+    std::vector<quint32> sortedByNumber(SortKey key, bool descending) const;
+
+private:
+    PlaylistStorage m_playlist;                       ///< 播放列表存储
+    QHash<ItemId, MediaMetadata> m_metadata;          ///< 已探测的元数据
+    TrigramIndex m_searchIndex;                       ///< 文件名与标签的搜索索引
     int m_currentIndex;                               ///< 当前播放索引
     AuroraPlayer::State::PlaylistMode m_playlistMode; ///< 播放列表模式
+    mutable ShuffleBag m_shuffle;                     ///< 随机模式的洗牌袋（预览会预先抽取）
 };
 
 #endif // AURORAPLAYER_PLAYER_PLAYLISTMANAGER_H
\ No newline at end of file
@@ -0,0 +1,320 @@
+/********************************************************************************
+ * @file   : PlaylistStorage.cpp
+ * @brief  : 实现了 PlaylistStorage 类。
+ *
+ * @author : polarours
+ * @date   : 2026/10/18
+ ********************************************************************************/
+
+#include "PlaylistStorage.h"
+
+#include <algorithm>
+#include <iterator>
+#include <utility>
+
+namespace {
+
+    constexpr qsizetype kMinDeadBytesToCompact = 1 << 20; ///< 触发压缩的最少空闲字节数
+
+} // namespace
+
+/**
+ * @brief 构造函数
+ */
+PlaylistStorage::PlaylistStorage()
+    : m_deadNameBytes(0)
+    , m_nextId(1)
+    , m_sortedById(true)
+    , m_indexValid(false)
+{
+}
+
+/**
+ * @brief 获取条目数量
+ *
+ * @return int 条目数量
+ */
+int PlaylistStorage::size() const
+{
+    return static_cast<int>(m_entries.size());
+}
+
+/**
+ * @brief 是否为空
+ *
+ * @return bool 是否为空
+ */
+bool PlaylistStorage::isEmpty() const
+{
+    return m_entries.empty();
+}
+
+/**
+ * @brief 预留容量
+ *
+ * @param capacity 预期条目数量
+ */
+void PlaylistStorage::reserve(int capacity)
+{
+    m_entries.reserve(static_cast<size_t>(capacity));
+}
+
+/**
+ * @brief 在末尾追加一批条目
+ *
+ * @param paths 文件路径列表
+ * @return ItemId 第一个新条目的 ID
+ */
+PlaylistStorage::ItemId PlaylistStorage::append(const QStringList& paths)
+{
+    return insert(size(), paths);
+}
+
+/**
+ * @brief 在指定行之前插入一批条目
+ *
+ * @param row   插入位置
+ * @param paths 文件路径列表
+ * @return ItemId 第一个新条目的 ID
+ */
+PlaylistStorage::ItemId PlaylistStorage::insert(int row, const QStringList& paths)
+{
+    const ItemId firstId = m_nextId;
+    if (paths.isEmpty()) {
+        return firstId;
+    }
+
+    row = qBound(0, row, size());
+    const bool atEnd = row == size();
+
+    std::vector<Entry> batch;
+    batch.reserve(static_cast<size_t>(paths.size()));
+    for (const QString& path : paths) {
+        batch.push_back({m_nextId++, m_paths.add(path)});
+    }
+
+    m_entries.insert(m_entries.begin() + row,
+                     std::make_move_iterator(batch.begin()),
+                     std::make_move_iterator(batch.end()));
+
+    if (atEnd) {
+        // 追加不改变已有条目的行号，哈希索引可以增量维护
+        if (m_indexValid) {
+            for (int i = row; i < size(); ++i) {
+                m_rowById.insert(m_entries[i].id, i);
+            }
+        }
+    } else {
+        m_sortedById = false;
+        invalidateIndex();
+    }
+
+    return firstId;
+}
+
+/**
+ * @brief 删除连续的若干行
+ *
+ * @param first 起始行
+ * @param count 行数
+ */
+void PlaylistStorage::remove(int first, int count)
+{
+    if (first < 0 || count <= 0 || first >= size()) {
+        return;
+    }
+
+    count = qMin(count, size() - first);
+    for (int i = first; i < first + count; ++i) {
+        m_deadNameBytes += m_entries[i].path.nameBytes;
+    }
+    m_entries.erase(m_entries.begin() + first, m_entries.begin() + first + count);
+    invalidateIndex();
+
+    if (m_entries.empty()) {
+        m_paths.clear();
+        m_deadNameBytes = 0;
+    } else if (m_deadNameBytes >= kMinDeadBytesToCompact && m_deadNameBytes * 2 > m_paths.nameBytes()) {
+        compactPaths();
+    }
+}
+
+/**
+ * @brief 将连续的若干行移动到目标位置之前
+ *
+ * @param first       起始行
+ * @param count       行数
+ * @param destination 目标位置
+ */
+void PlaylistStorage::move(int first, int count, int destination)
+{
+    if (first < 0 || count <= 0 || first + count > size()
+        || destination < 0 || destination > size()
+        || (destination >= first && destination <= first + count)) {
+        return;
+    }
+
+    auto begin = m_entries.begin();
+    if (destination < first) {
+        std::rotate(begin + destination, begin + first, begin + first + count);
+    } else {
+        std::rotate(begin + first, begin + first + count, begin + destination);
+    }
+
+    m_sortedById = false;
+    invalidateIndex();
+}
+
+/**
+ * @brief 按给定顺序重排全部条目
+ *
+ * @param order 新顺序
+ */
+void PlaylistStorage::permute(const std::vector<quint32>& order)
+{
+    if (order.size() != m_entries.size()) {
+        return;
+    }
+
+    std::vector<Entry> entries;
+    entries.reserve(m_entries.size());
+    for (const quint32 row : order) {
+        entries.push_back(m_entries[row]);
+    }
+    m_entries.swap(entries);
+
+    m_sortedById = false;
+    invalidateIndex();
+}
+
+/**
+ * @brief 清空
+ */
+void PlaylistStorage::clear()
+{
+    std::vector<Entry>().swap(m_entries);
+    m_paths.clear();
+    m_deadNameBytes = 0;
+    m_sortedById = true;
+    invalidateIndex();
+}
+
+/**
+ * @brief 获取指定行的文件路径
+ *
+ * @param row 行号
+ * @return QString 文件路径
+ */
+QString PlaylistStorage::pathAt(int row) const
+{
+    if (row >= 0 && row < size()) {
+        return m_paths.path(m_entries[row].path);
+    }
+    return QString();
+}
+
+/**
+ * @brief 获取指定行的文件名
+ *
+ * @param row 行号
+ * @return QString 文件名
+ */
+QString PlaylistStorage::fileNameAt(int row) const
+{
+    if (row >= 0 && row < size()) {
+        return m_paths.fileName(m_entries[row].path);
+    }
+    return QString();
+}
+
+/**
+ * @brief 获取指定行的条目 ID
+ *
+ * @param row 行号
+ * @return ItemId 条目 ID
+ */
+PlaylistStorage::ItemId PlaylistStorage::idAt(int row) const
+{
+    if (row >= 0 && row < size()) {
+        return m_entries[row].id;
+    }
+    return InvalidId;
+}
+
+/**
+ * @brief 根据条目 ID 查找所在行
+ *
+ * @param id 条目 ID
+ * @return int 行号，不存在时为 -1
+ */
+int PlaylistStorage::rowOf(ItemId id) const
+{
+    if (id == InvalidId) {
+        return -1;
+    }
+
+    if (m_sortedById) {
+        auto it = std::lower_bound(m_entries.begin(), m_entries.end(), id,
+                                   [](const Entry& entry, ItemId value) { return entry.id < value; });
+        if (it != m_entries.end() && it->id == id) {
+            return static_cast<int>(it - m_entries.begin());
+        }
+        return -1;
+    }
+
+    if (!m_indexValid) {
+        m_rowById.clear();
+        m_rowById.reserve(size());
+        for (int i = 0; i < size(); ++i) {
+            m_rowById.insert(m_entries[i].id, i);
+        }
+        m_indexValid = true;
+    }
+    return m_rowById.value(id, -1);
+}
+
+/**
+ * @brief 统计路径占用的内存
+ *
+ * 独立 QString 的估算按每条一个 QString 句柄、一个数据块头和 UTF-16
+ * 内容（含结尾的 0）计算，不计分配器的额外开销。
+ *
+ * @return MemoryStats 内存统计
+ */
+PlaylistStorage::MemoryStats PlaylistStorage::memoryStats() const
+{
+    constexpr qsizetype kStringOverhead = sizeof(QString) + 16;
+
+    MemoryStats stats;
+    stats.bytes = m_paths.memoryUsage() + size() * static_cast<qsizetype>(sizeof(PathArena::Ref));
+    for (const Entry& entry : m_entries) {
+        stats.plainBytes += kStringOverhead + (m_paths.pathLength(entry.path) + 1) * 2;
+    }
+    return stats;
+}
+
+/**
+ * @brief 标记行号索引失效
+ */
+void PlaylistStorage::invalidateIndex()
+{
+    if (m_indexValid) {
+        m_rowById.clear();
+        m_indexValid = false;
+    }
+}
+
+/**
+ * @brief 将存活条目的路径复制到新的字符串池
+ *
+ * 直接复制 UTF-8 字节，同时丢弃已无条目引用的目录。
+ */
+void PlaylistStorage::compactPaths()
+{
+    PathArena paths;
+    for (Entry& entry : m_entries) {
+        entry.path = paths.add(m_paths, entry.path);
+    }
+    m_paths = std::move(paths);
+    m_deadNameBytes = 0;
+}
@@ -0,0 +1,189 @@
+/********************************************************************************
+ * @file   : PlaylistStorage.h
+ * @brief  : 声明了 PlaylistStorage 类。
+ *
+ * 该文件声明了播放列表的存储层：连续数组保存条目，每个条目带有稳定的
+ * 条目 ID，支持 O(1) 追加以及整批插入、删除、移动。路径保存在 PathArena 中。
+ *
+ * @author : polarours
+ * @date   : 2026/10/18
+ ********************************************************************************/
+
+#ifndef AURORAPLAYER_PLAYLISTSTORAGE_H
+#define AURORAPLAYER_PLAYLISTSTORAGE_H
+
+#include <QHash>
+#include <QString>
+#include <QStringList>
+
+#include <vector>
+
+#include "PathArena.h"
+
+/**
+ * @class PlaylistStorage
+ * @brief 播放列表存储
+ *
+ * 条目 ID 单调递增且永不复用。只经历追加和删除时数组按 ID 有序，
+ * rowOf() 使用二分查找；插入到中间或移动之后改为惰性重建的哈希索引。
+ *
+ * 路径按目录前缀去重、以 UTF-8 存放，pathAt() 每次构造新的 QString。
+ * 删除留下的空闲空间超过一半时整体压缩字符串池。
+ */
+class PlaylistStorage
+{
+public:
+    using ItemId = quint64;
+    static constexpr ItemId InvalidId = 0; ///< 无效条目 ID
+
+    /**
+     * @brief 路径占用的内存
+     */
+    struct MemoryStats {
+        qsizetype bytes = 0;      ///< 实际占用（字符串池与路径引用）
+        qsizetype plainBytes = 0; ///< 以独立 QString 保存时的估算占用
+    };
+
+    /**
+     * @brief 构造函数
+     */
+    PlaylistStorage();
+
+    /**
+     * @brief 获取条目数量
+     *
+     * @return int 条目数量
+     */
+    int size() const;
+
+    /**
+     * @brief 是否为空
+     *
+     * @return bool 是否为空
+     */
+    bool isEmpty() const;
+
+    /**
+     * @brief 预留容量，避免大批量导入时反复扩容
+     *
+     * @param capacity 预期条目数量
+     */
+    void reserve(int capacity);
+
+    /**
+     * @brief 在末尾追加一批条目（均摊 O(1)）
+     *
+     * @param paths 文件路径列表
+     * @return ItemId 第一个新条目的 ID（同一批次的 ID 连续）
+     */
+    ItemId append(const QStringList& paths);
+
+    /**
+     * @brief 在指定行之前插入一批条目（一次整体平移）
+     *
+     * @param row   插入位置
+     * @param paths 文件路径列表
+     * @return ItemId 第一个新条目的 ID（同一批次的 ID 连续）
+     */
+    ItemId insert(int row, const QStringList& paths);
+
+    /**
+     * @brief 删除连续的若干行（一次整体平移）
+     *
+     * @param first 起始行
+     * @param count 行数
+     */
+    void remove(int first, int count);
+
+    /**
+     * @brief 将连续的若干行移动到目标位置之前
+     *
+     * @param first       起始行
+     * @param count       行数
+     * @param destination 目标位置（移动前的行号，不能位于被移动区间内部）
+     */
+    void move(int first, int count, int destination);
+
+    /**
+     * @brief 按给定顺序重排全部条目
+     *
+     * 只移动条目（ID 与路径引用），不复制路径字符串。
+     *
+     * @param order 新顺序，order[i] 为新第 i 行在重排前的行号，须为 0..size()-1 的排列
+     */
+    void permute(const std::vector<quint32>& order);
+
+    /**
+     * @brief 清空
+     */
+    void clear();
+
+    /**
+     * @brief 获取指定行的文件路径
+     *
+     * @param row 行号
+     * @return QString 文件路径，越界时为空
+     */
+    QString pathAt(int row) const;
+
+    /**
+     * @brief 获取指定行的文件名（不构造目录部分）
+     *
+     * @param row 行号
+     * @return QString 文件名，越界时为空
+     */
+    QString fileNameAt(int row) const;
+
+    /**
+     * @brief 获取指定行的条目 ID
+     *
+     * @param row 行号
+     * @return ItemId 条目 ID，越界时为 InvalidId
+     */
+    ItemId idAt(int row) const;
+
+    /**
+     * @brief 根据条目 ID 查找所在行
+     *
+     * @param id 条目 ID
+     * @return int 行号，不存在时为 -1
+     */
+    int rowOf(ItemId id) const;
+
+    /**
+     * @brief 统计路径占用的内存
+     *
+     * @return MemoryStats 内存统计
+     */
+    MemoryStats memoryStats() const;
+
+private:
+    /**
+     * @brief 单个条目
+     */
+    struct Entry {
+        ItemId id;          ///< 稳定条目 ID
+        PathArena::Ref path; ///< 文件路径
+    };
+
+    /**
+     * @brief 标记行号索引失效（结构变化后调用）
+     */
+    void invalidateIndex();
+
+    /**
+     * @brief 将存活条目的路径复制到新的字符串池
+     */
+    void compactPaths();
+
+private:
+    std::vector<Entry> m_entries;          ///< 条目数组
+    PathArena m_paths;                     ///< 路径字符串池
+    qsizetype m_deadNameBytes;             ///< 已删除条目在字符串池中遗留的字节数
+    ItemId m_nextId;                       ///< 下一个可分配的 ID
+    bool m_sortedById;                     ///< 数组是否按 ID 升序
+    mutable QHash<ItemId, int> m_rowById;  ///< 惰性重建的 ID → 行号索引
+    mutable bool m_indexValid;             ///< 哈希索引是否有效
+};
+
+#endif // AURORAPLAYER_PLAYLISTSTORAGE_H
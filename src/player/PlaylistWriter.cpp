@@ -0,0 +1,158 @@
+/********************************************************************************
+ * @file   : PlaylistWriter.cpp
+ * @brief  : 实现了 PlaylistWriter 类。
+ *
+ * @author : polarours
+ * @date   : 2026/10/18
+ ********************************************************************************/
+
+#include "PlaylistWriter.h"
+#include "PlaylistManager.h"
+#include "../core/Tracer.h"
+
+#include <QSaveFile>
+
+#include <cstring>
+#include <vector>
+
+namespace {
+
+    constexpr qsizetype kWriteBlockSize = 1 << 20; ///< 输出缓冲块大小
+
+    /**
+     * @brief 设置错误信息
+     */
+    bool fail(QString* errorString, const QString& message)
+    {
+        if (errorString) {
+            *errorString = message;
+        }
+        return false;
+    }
+
+    /**
+     * @brief 将标题中的换行和其他控制字符替换为空格，保证 #EXTINF 只占一行
+     */
+    QString sanitizeTitle(const QString& title)
+    {
+        QString result = title;
+        for (QChar& ch : result) {
+            if (ch.category() == QChar::Other_Control || ch == QChar::LineSeparator || ch == QChar::ParagraphSeparator) {
+                ch = QLatin1Char(' ');
+            }
+        }
+        return result.simplified();
+    }
+
+} // namespace
+
+/**
+ * @brief 保存播放列表
+ *
+ * @param filePath        文件路径
+ * @param playlistManager 播放列表
+ * @param errorString     输出错误信息
+ * @return bool 是否保存成功
+ */
+bool PlaylistWriter::save(const QString& filePath, const PlaylistManager& playlistManager, QString* errorString)
+{
+    switch (playlistFormatForPath(filePath)) {
+        case PlaylistFileFormat::Binary:
+            return saveBinary(filePath, playlistManager, errorString);
+        case PlaylistFileFormat::M3U8:
+        default:
+            return saveM3U8(filePath, playlistManager, errorString);
+    }
+}
+
+/**
+ * @brief 保存为 M3U8
+ *
+ * 已探测到元数据的条目写出 #EXTINF 行，其余条目只写路径。
+ */
+bool PlaylistWriter::saveM3U8(const QString& filePath, const PlaylistManager& playlistManager, QString* errorString)
+{
+    AURORA_TRACE_SCOPE("playlist", "saveM3U8");
+
+    QSaveFile file(filePath);
+    if (!file.open(QIODevice::WriteOnly)) {
+        return fail(errorString, file.errorString());
+    }
+
+    QByteArray buffer;
+    buffer.reserve(kWriteBlockSize + 4096);
+    buffer.append("#EXTM3U\n");
+
+    const int count = playlistManager.count();
+    for (int i = 0; i < count; ++i) {
+        if (const MediaMetadata* metadata = playlistManager.metadataAt(i)) {
+            const QString title = metadata->displayTitle();
+            if (metadata->durationMs >= 0 || !title.isEmpty()) {
+                buffer.append("#EXTINF:");
+                buffer.append(QByteArray::number(metadata->durationMs >= 0 ? metadata->durationMs / 1000 : -1));
+                buffer.append(',');
+                buffer.append(sanitizeTitle(title).toUtf8());
+                buffer.append('\n');
+            }
+        }
+        buffer.append(playlistManager.filePathAt(i).toUtf8());
+        buffer.append('\n');
+
+        if (buffer.size() >= kWriteBlockSize) {
+            if (file.write(buffer) != buffer.size()) {
+                return fail(errorString, file.errorString());
+            }
+            buffer.clear();
+        }
+    }
+
+    if (file.write(buffer) != buffer.size() || !file.commit()) {
+        return fail(errorString, file.errorString());
+    }
+    return true;
+}
+
+/**
+ * @brief 保存为紧凑二进制格式
+ *
+ * 路径区与偏移数组在内存中构造后一次写出。
+ */
+bool PlaylistWriter::saveBinary(const QString& filePath, const PlaylistManager& playlistManager, QString* errorString)
+{
+    AURORA_TRACE_SCOPE("playlist", "saveBinary");
+
+    const int count = playlistManager.count();
+
+    std::vector<quint64> offsets;
+    offsets.reserve(static_cast<size_t>(count) + 1);
+    QByteArray strings;
+    offsets.push_back(0);
+    for (int i = 0; i < count; ++i) {
+        strings.append(playlistManager.filePathAt(i).toUtf8());
+        offsets.push_back(static_cast<quint64>(strings.size()));
+    }
+
+    PlaylistBinaryHeader header{};
+    std::memcpy(header.magic, PlaylistBinaryHeader::kMagic, sizeof(header.magic));
+    header.version = PlaylistBinaryHeader::kVersion;
+    header.byteOrder = PlaylistBinaryHeader::kByteOrderMark;
+    header.count = static_cast<quint64>(count);
+    header.offsetsOffset = sizeof(PlaylistBinaryHeader);
+    header.stringsOffset = header.offsetsOffset + offsets.size() * sizeof(quint64);
+    header.stringsSize = static_cast<quint64>(strings.size());
+
+    QSaveFile file(filePath);
+    if (!file.open(QIODevice::WriteOnly)) {
+        return fail(errorString, file.errorString());
+    }
+
+    const qint64 headerBytes = static_cast<qint64>(sizeof(header));
+    const qint64 offsetsBytes = static_cast<qint64>(offsets.size() * sizeof(quint64));
+    if (file.write(reinterpret_cast<const char*>(&header), headerBytes) != headerBytes
+        || file.write(reinterpret_cast<const char*>(offsets.data()), offsetsBytes) != offsetsBytes
+        || file.write(strings) != strings.size()
+        || !file.commit()) {
+        return fail(errorString, file.errorString());
+    }
+    return true;
+}
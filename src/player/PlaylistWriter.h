@@ -0,0 +1,53 @@
+/********************************************************************************
+ * @file   : PlaylistWriter.h
+ * @brief  : 声明了 PlaylistWriter 类。
+ *
+ * 该文件声明了播放列表的保存功能，支持 M3U8 和紧凑二进制格式。
+ *
+ * @author : polarours
+ * @date   : 2026/10/18
+ ********************************************************************************/
+
+#ifndef AURORAPLAYER_PLAYLISTWRITER_H
+#define AURORAPLAYER_PLAYLISTWRITER_H
+
+#include <QString>
+
+#include "PlaylistFormat.h"
+
+class PlaylistManager;
+
+/**
+ * @class PlaylistWriter
+ * @brief 播放列表保存
+ *
+ * 输出按块缓冲后写入 QSaveFile，写入失败时原文件保持不变。
+ */
+class PlaylistWriter
+{
+public:
+    /**
+     * @brief 保存播放列表，格式由扩展名决定（.apl 为二进制，其余为 M3U8）
+     *
+     * @param filePath        文件路径
+     * @param playlistManager 播放列表
+     * @param errorString     输出错误信息，可为空
+     * @return bool 是否保存成功
+     */
+    static bool save(const QString& filePath, const PlaylistManager& playlistManager,
+                     QString* errorString = nullptr);
+
+    /**
+     * @brief 保存为 M3U8（带 #EXTINF 时长和标题）
+     */
+    static bool saveM3U8(const QString& filePath, const PlaylistManager& playlistManager,
+                         QString* errorString = nullptr);
+
+    /**
+     * @brief 保存为紧凑二进制格式
+     */
+    static bool saveBinary(const QString& filePath, const PlaylistManager& playlistManager,
+                           QString* errorString = nullptr);
+};
+
+#endif // AURORAPLAYER_PLAYLISTWRITER_H
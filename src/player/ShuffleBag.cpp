@@ -0,0 +1,314 @@
+/********************************************************************************
+ * @file   : ShuffleBag.cpp
+ * @brief  : 实现了 ShuffleBag 类。
+ *
+ * @author : polarours
+ * @date   : 2026/10/18
+ ********************************************************************************/
+
+#include "ShuffleBag.h"
+
+#include <algorithm>
+#include <utility>
+
+namespace {
+
+    constexpr int kMaxHistory = 10000; ///< 播放历史上限
+
+} // namespace
+
+/**
+ * @brief 构造函数
+ *
+ * @param storage 播放列表存储
+ */
+ShuffleBag::ShuffleBag(const PlaylistStorage* storage)
+    : m_storage(storage)
+    , m_rng(std::random_device{}())
+    , m_dirty(false)
+    , m_historyCursor(-1)
+{
+}
+
+/**
+ * @brief 获取下一首
+ *
+ * @param current 当前条目 ID
+ * @return ItemId 下一首的条目 ID
+ */
+ShuffleBag::ItemId ShuffleBag::next(ItemId current)
+{
+    syncHistory(current);
+
+    // 之前后退过：沿历史前进
+    while (m_historyCursor + 1 < static_cast<int>(m_history.size())) {
+        const ItemId id = m_history[m_historyCursor + 1];
+        if (exists(id)) {
+            ++m_historyCursor;
+            return id;
+        }
+        m_history.erase(m_history.begin() + m_historyCursor + 1);
+    }
+
+    // 已预先抽出的条目
+    while (!m_lookahead.empty()) {
+        const ItemId id = m_lookahead.front();
+        m_lookahead.pop_front();
+        if (exists(id)) {
+            pushHistory(id);
+            return id;
+        }
+    }
+
+    const ItemId id = draw(current);
+    if (id != PlaylistStorage::InvalidId) {
+        pushHistory(id);
+    }
+    return id;
+}
+
+/**
+ * @brief 获取上一首
+ *
+ * @param current 当前条目 ID
+ * @return ItemId 上一首的条目 ID
+ */
+ShuffleBag::ItemId ShuffleBag::previous(ItemId current)
+{
+    syncHistory(current);
+
+    while (m_historyCursor > 0) {
+        const ItemId id = m_history[m_historyCursor - 1];
+        --m_historyCursor;
+        if (exists(id)) {
+            return id;
+        }
+        // 已删除的条目从历史中移除，当前条目随之前移
+        m_history.erase(m_history.begin() + m_historyCursor);
+    }
+    return PlaylistStorage::InvalidId;
+}
+
+/**
+ * @brief 预览接下来将要播放的条目
+ *
+ * @param current 当前条目 ID
+ * @param count   最多返回的数量
+ * @return QList<ItemId> 条目 ID 列表
+ */
+QList<ShuffleBag::ItemId> ShuffleBag::upcoming(ItemId current, int count)
+{
+    syncHistory(current);
+
+    QList<ItemId> result;
+    count = qMin(count, m_storage->size() - 1);
+    if (count <= 0) {
+        return result;
+    }
+
+    for (int i = m_historyCursor + 1; i < static_cast<int>(m_history.size()) && result.size() < count; ++i) {
+        if (exists(m_history[i])) {
+            result.append(m_history[i]);
+        }
+    }
+    for (const ItemId id : m_lookahead) {
+        if (result.size() >= count) {
+            break;
+        }
+        if (exists(id)) {
+            result.append(id);
+        }
+    }
+
+    while (result.size() < count) {
+        const ItemId avoid = m_lookahead.empty() ? current : m_lookahead.back();
+        const ItemId id = draw(avoid);
+        if (id == PlaylistStorage::InvalidId) {
+            break;
+        }
+        m_lookahead.push_back(id);
+        result.append(id);
+    }
+    return result;
+}
+
+/**
+ * @brief 播放列表结构发生变化
+ */
+void ShuffleBag::invalidate()
+{
+    m_dirty = true;
+}
+
+/**
+ * @brief 清空历史并开始新一轮
+ */
+void ShuffleBag::reset()
+{
+    m_valueAt.clear();
+    m_positionOf.clear();
+    m_drawn.clear();
+    m_dirty = false;
+    m_history.clear();
+    m_historyCursor = -1;
+    m_lookahead.clear();
+}
+
+/**
+ * @brief 从袋中抽取一个条目
+ *
+ * @param avoid 新一轮开始时需要避开的条目
+ * @return ItemId 条目 ID
+ */
+ShuffleBag::ItemId ShuffleBag::draw(ItemId avoid)
+{
+    if (m_dirty) {
+        rebase();
+    }
+
+    const int size = m_storage->size();
+    if (size == 0) {
+        return PlaylistStorage::InvalidId;
+    }
+
+    int drawn = m_drawn.size();
+    int limit = size;
+    if (drawn >= size) {
+        // 新一轮：把刚播放的条目放到末尾，第一次抽取不包含它
+        m_valueAt.clear();
+        m_positionOf.clear();
+        m_drawn.clear();
+        drawn = 0;
+
+        const int avoidRow = m_storage->rowOf(avoid);
+        if (avoidRow >= 0 && size > 1) {
+            swapPositions(avoidRow, size - 1);
+            limit = size - 1;
+        }
+    }
+
+    std::uniform_int_distribution<int> distribution(drawn, limit - 1);
+    swapPositions(drawn, distribution(m_rng));
+
+    const ItemId id = m_storage->idAt(valueAt(drawn));
+    m_drawn.append(id);
+    return id;
+}
+
+/**
+ * @brief 按已抽出条目的 ID 重建虚拟数组前缀
+ */
+void ShuffleBag::rebase()
+{
+    m_valueAt.clear();
+    m_positionOf.clear();
+
+    QList<ItemId> kept;
+    kept.reserve(m_drawn.size());
+    for (const ItemId id : std::as_const(m_drawn)) {
+        const int row = m_storage->rowOf(id);
+        if (row < 0) {
+            continue;
+        }
+        swapPositions(kept.size(), positionOf(row));
+        kept.append(id);
+    }
+
+    m_drawn.swap(kept);
+    m_dirty = false;
+}
+
+/**
+ * @brief 将某行标记为本轮已抽出
+ */
+void ShuffleBag::markDrawn(int row)
+{
+    if (m_dirty) {
+        rebase();
+    }
+
+    const int position = positionOf(row);
+    if (position < m_drawn.size()) {
+        return;
+    }
+    swapPositions(m_drawn.size(), position);
+    m_drawn.append(m_storage->idAt(row));
+}
+
+/**
+ * @brief 用户手动切换条目时同步历史
+ *
+ * 当前条目不是历史中的当前位置时，丢弃“前进”部分并记入历史，
+ * 同时从本轮的袋中取出该条目。
+ */
+void ShuffleBag::syncHistory(ItemId current)
+{
+    if (current == PlaylistStorage::InvalidId) {
+        return;
+    }
+    if (m_historyCursor >= 0 && m_history[m_historyCursor] == current) {
+        return;
+    }
+
+    m_history.erase(m_history.begin() + (m_historyCursor + 1), m_history.end());
+    pushHistory(current);
+    m_lookahead.erase(std::remove(m_lookahead.begin(), m_lookahead.end(), current), m_lookahead.end());
+
+    const int row = m_storage->rowOf(current);
+    if (row >= 0) {
+        markDrawn(row);
+    }
+}
+
+/**
+ * @brief 追加到历史末尾
+ */
+void ShuffleBag::pushHistory(ItemId id)
+{
+    m_history.push_back(id);
+    if (static_cast<int>(m_history.size()) > kMaxHistory) {
+        m_history.pop_front();
+    }
+    m_historyCursor = static_cast<int>(m_history.size()) - 1;
+}
+
+/**
+ * @brief 条目是否仍在播放列表中
+ */
+bool ShuffleBag::exists(ItemId id) const
+{
+    return m_storage->rowOf(id) >= 0;
+}
+
+/**
+ * @brief 交换虚拟数组的两个位置
+ */
+void ShuffleBag::swapPositions(int a, int b)
+{
+    if (a == b) {
+        return;
+    }
+
+    const int valueA = valueAt(a);
+    const int valueB = valueAt(b);
+    m_valueAt.insert(a, valueB);
+    m_positionOf.insert(valueB, a);
+    m_valueAt.insert(b, valueA);
+    m_positionOf.insert(valueA, b);
+}
+
+/**
+ * @brief 虚拟数组位置上的行号
+ */
+int ShuffleBag::valueAt(int position) const
+{
+    return m_valueAt.value(position, position);
+}
+
+/**
+ * @brief 行号在虚拟数组中的位置
+ */
+int ShuffleBag::positionOf(int row) const
+{
+    return m_positionOf.value(row, row);
+}
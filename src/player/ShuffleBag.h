@@ -0,0 +1,149 @@
+/********************************************************************************
+ * @file   : ShuffleBag.h
+ * @brief  : 声明了 ShuffleBag 类。
+ *
+ * 该文件声明了随机播放模式使用的洗牌袋：惰性 Fisher–Yates 洗牌保证每一轮
+ * 中每个条目恰好出现一次，播放历史支持 O(1) 的上一首/下一首。
+ *
+ * @author : polarours
+ * @date   : 2026/10/18
+ ********************************************************************************/
+
+#ifndef AURORAPLAYER_SHUFFLEBAG_H
+#define AURORAPLAYER_SHUFFLEBAG_H
+
+#include <QHash>
+#include <QList>
+
+#include <deque>
+#include <random>
+
+#include "PlaylistStorage.h"
+
+/**
+ * @class ShuffleBag
+ * @brief 洗牌袋
+ *
+ * 把当前各行看作一个虚拟数组 a[i] = i，只在交换过的位置上用哈希表记录
+ * 实际值，前缀 [0, k) 为本轮已抽出的条目。每次抽取在 [k, n) 中选一个位置
+ * 与 k 交换，因此从不生成完整排列，内存只与已抽出的条目数成正比。
+ *
+ * 播放列表结构变化后只标记失效，下次抽取时按已抽出条目的 ID 重建前缀
+ * （代价与本轮已抽出数成正比）：被删除的条目自然消失，新加入的条目
+ * 进入未抽出部分。
+ */
+class ShuffleBag
+{
+public:
+    using ItemId = PlaylistStorage::ItemId;
+
+    /**
+     * @brief 构造函数
+     *
+     * @param storage 播放列表存储
+     */
+    explicit ShuffleBag(const PlaylistStorage* storage);
+
+    /**
+     * @brief 获取下一首
+     *
+     * 在历史中后退过时先沿历史前进，否则从袋中抽取；一轮抽完后开始
+     * 新一轮，新一轮的第一首不会与刚播放的条目相同。
+     *
+     * @param current 当前条目 ID（用户手动切换的条目会被记入历史）
+     * @return ItemId 下一首的条目 ID，播放列表为空时为 InvalidId
+     */
+    ItemId next(ItemId current);
+
+    /**
+     * @brief 获取上一首（沿播放历史后退）
+     *
+     * @param current 当前条目 ID
+     * @return ItemId 上一首的条目 ID，没有历史时为 InvalidId
+     */
+    ItemId previous(ItemId current);
+
+    /**
+     * @brief 预览接下来将要播放的条目（预先抽出，之后 next() 按相同顺序返回）
+     *
+     * @param current 当前条目 ID
+     * @param count   最多返回的数量
+     * @return QList<ItemId> 条目 ID 列表
+     */
+    QList<ItemId> upcoming(ItemId current, int count);
+
+    /**
+     * @brief 播放列表结构发生变化（插入、删除、移动）
+     */
+    void invalidate();
+
+    /**
+     * @brief 清空历史并开始新一轮
+     */
+    void reset();
+
+private:
+    /**
+     * @brief 从袋中抽取一个条目
+     *
+     * @param avoid 新一轮开始时需要避开的条目
+     */
+    ItemId draw(ItemId avoid);
+
+    /**
+     * @brief 按已抽出条目的 ID 重建虚拟数组前缀
+     */
+    void rebase();
+
+    /**
+     * @brief 将某行标记为本轮已抽出
+     */
+    void markDrawn(int row);
+
+    /**
+     * @brief 用户手动切换条目时同步历史
+     */
+    void syncHistory(ItemId current);
+
+    /**
+     * @brief 追加到历史末尾
+     */
+    void pushHistory(ItemId id);
+
+    /**
+     * @brief 条目是否仍在播放列表中
+     */
+    bool exists(ItemId id) const;
+
+    /**
+     * @brief 交换虚拟数组的两个位置
+     */
+    void swapPositions(int a, int b);
+
+    /**
+     * @brief 虚拟数组位置上的行号
+     */
+    int valueAt(int position) const;
+
+    /**
+     * @brief 行号在虚拟数组中的位置
+     */
+    int positionOf(int row) const;
+
+private:
+    const PlaylistStorage* m_storage;  ///< 播放列表存储
+    std::mt19937 m_rng;                ///< 随机数生成器
+
+    // --- 本轮 --- //
+    QHash<int, int> m_valueAt;         ///< 交换过的位置 → 行号
+    QHash<int, int> m_positionOf;      ///< 交换过的行号 → 位置
+    QList<ItemId> m_drawn;             ///< 本轮已抽出的条目（虚拟数组前缀）
+    bool m_dirty;                      ///< 结构变化后是否需要重建
+
+    // --- 历史 --- //
+    std::deque<ItemId> m_history;      ///< 播放历史
+    int m_historyCursor;               ///< 当前条目在历史中的位置
+    std::deque<ItemId> m_lookahead;    ///< 已预先抽出、尚未播放的条目
+};
+
+#endif // AURORAPLAYER_SHUFFLEBAG_H
@@ -0,0 +1,241 @@
+/********************************************************************************
+ * @file   : TrigramIndex.cpp
+ * @brief  : 实现了 TrigramIndex 类。
+ *
+ * @author : polarours
+ * @date   : 2026/10/18
+ ********************************************************************************/
+
+#include "TrigramIndex.h"
+
+#include <algorithm>
+
+namespace {
+
+    constexpr int kMinTombstonesToCompact = 1024; ///< 触发压缩的最少墓碑数
+
+} // namespace
+
+/**
+ * @brief 为条目添加一段可搜索文本
+ *
+ * @param id   条目 ID
+ * @param text 文本
+ */
+void TrigramIndex::addText(ItemId id, QStringView text)
+{
+    if (id == PlaylistStorage::InvalidId || text.size() < kGramLength) {
+        return;
+    }
+
+    quint32 doc;
+    const auto it = m_docOf.constFind(id);
+    if (it != m_docOf.constEnd()) {
+        doc = it.value();
+    } else {
+        doc = static_cast<quint32>(m_docIds.size());
+        m_docIds.push_back(id);
+        m_docOf.insert(id, doc);
+    }
+
+    for (const quint64 gram : gramsOf(fold(text))) {
+        std::vector<quint32>& list = m_postings[gram];
+        if (list.empty() || list.back() < doc) {
+            list.push_back(doc);
+        } else if (list.back() != doc) {
+            list.push_back(doc);
+            m_unsorted.insert(gram);
+        }
+    }
+}
+
+/**
+ * @brief 删除条目
+ *
+ * @param id 条目 ID
+ */
+void TrigramIndex::remove(ItemId id)
+{
+    const auto it = m_docOf.find(id);
+    if (it == m_docOf.end()) {
+        return;
+    }
+
+    m_docIds[it.value()] = PlaylistStorage::InvalidId;
+    m_docOf.erase(it);
+    ++m_tombstones;
+
+    if (m_tombstones >= kMinTombstonesToCompact && m_tombstones * 2 > static_cast<int>(m_docIds.size())) {
+        compact();
+    }
+}
+
+/**
+ * @brief 清空
+ */
+void TrigramIndex::clear()
+{
+    m_postings.clear();
+    m_unsorted.clear();
+    std::vector<ItemId>().swap(m_docIds);
+    m_docOf.clear();
+    m_tombstones = 0;
+}
+
+/**
+ * @brief 查询候选条目
+ *
+ * 从最短的倒排表开始，依次在更长的表中二分查找，代价取决于最短表的长度，
+ * 与播放列表总长度无关。
+ *
+ * @param query 查询串
+ * @return QList<ItemId> 候选条目 ID
+ */
+QList<TrigramIndex::ItemId> TrigramIndex::candidates(QStringView query)
+{
+    QList<ItemId> result;
+
+    const std::vector<quint64> grams = gramsOf(fold(query));
+    if (grams.empty()) {
+        return result;
+    }
+
+    std::vector<const std::vector<quint32>*> lists;
+    lists.reserve(grams.size());
+    for (const quint64 gram : grams) {
+        auto it = m_postings.find(gram);
+        if (it == m_postings.end()) {
+            return result;
+        }
+        if (m_unsorted.remove(gram)) {
+            std::vector<quint32>& list = it.value();
+            std::sort(list.begin(), list.end());
+            list.erase(std::unique(list.begin(), list.end()), list.end());
+        }
+        lists.push_back(&it.value());
+    }
+    std::sort(lists.begin(), lists.end(),
+              [](const std::vector<quint32>* a, const std::vector<quint32>* b) { return a->size() < b->size(); });
+
+    std::vector<quint32> docs = *lists.front();
+    for (size_t i = 1; i < lists.size() && !docs.empty(); ++i) {
+        const std::vector<quint32>& list = *lists[i];
+        auto from = list.begin();
+        size_t kept = 0;
+        for (const quint32 doc : docs) {
+            from = std::lower_bound(from, list.end(), doc);
+            if (from == list.end()) {
+                break;
+            }
+            if (*from == doc) {
+                docs[kept++] = doc;
+            }
+        }
+        docs.resize(kept);
+    }
+
+    result.reserve(static_cast<qsizetype>(docs.size()));
+    for (const quint32 doc : docs) {
+        const ItemId id = m_docIds[doc];
+        if (id != PlaylistStorage::InvalidId) {
+            result.append(id);
+        }
+    }
+    return result;
+}
+
+/**
+ * @brief 估算索引占用的内存
+ *
+ * @return qsizetype 字节数
+ */
+qsizetype TrigramIndex::memoryUsage() const
+{
+    qsizetype bytes = static_cast<qsizetype>(m_docIds.capacity() * sizeof(ItemId));
+    bytes += m_docOf.size() * static_cast<qsizetype>(sizeof(ItemId) + sizeof(quint32));
+    for (auto it = m_postings.cbegin(); it != m_postings.cend(); ++it) {
+        bytes += static_cast<qsizetype>(sizeof(quint64) + sizeof(std::vector<quint32>)
+                                        + it.value().capacity() * sizeof(quint32));
+    }
+    return bytes;
+}
+
+/**
+ * @brief 大小写折叠
+ *
+ * @param text 文本
+ * @return QString 折叠后的文本
+ */
+QString TrigramIndex::fold(QStringView text)
+{
+    return text.toString().toCaseFolded();
+}
+
+/**
+ * @brief 计算折叠文本中所有不重复的三元组
+ */
+std::vector<quint64> TrigramIndex::gramsOf(const QString& folded)
+{
+    std::vector<quint64> grams;
+    const qsizetype count = folded.size() - kGramLength + 1;
+    if (count <= 0) {
+        return grams;
+    }
+
+    grams.reserve(static_cast<size_t>(count));
+    const QChar* data = folded.constData();
+    for (qsizetype i = 0; i < count; ++i) {
+        grams.push_back((quint64(data[i].unicode()) << 32)
+                        | (quint64(data[i + 1].unicode()) << 16)
+                        | quint64(data[i + 2].unicode()));
+    }
+    std::sort(grams.begin(), grams.end());
+    grams.erase(std::unique(grams.begin(), grams.end()), grams.end());
+    return grams;
+}
+
+/**
+ * @brief 移除墓碑并重新编号文档
+ *
+ * 新编号保持原有顺序，已排序的倒排表压缩后仍然有序。
+ */
+void TrigramIndex::compact()
+{
+    constexpr quint32 kRemoved = ~quint32(0);
+
+    std::vector<quint32> remap(m_docIds.size(), kRemoved);
+    std::vector<ItemId> docIds;
+    docIds.reserve(m_docIds.size() - static_cast<size_t>(m_tombstones));
+    for (size_t doc = 0; doc < m_docIds.size(); ++doc) {
+        if (m_docIds[doc] != PlaylistStorage::InvalidId) {
+            remap[doc] = static_cast<quint32>(docIds.size());
+            docIds.push_back(m_docIds[doc]);
+        }
+    }
+
+    for (auto it = m_postings.begin(); it != m_postings.end();) {
+        std::vector<quint32>& list = it.value();
+        size_t kept = 0;
+        for (const quint32 doc : list) {
+            if (remap[doc] != kRemoved) {
+                list[kept++] = remap[doc];
+            }
+        }
+        list.resize(kept);
+        if (list.empty()) {
+            m_unsorted.remove(it.key());
+            it = m_postings.erase(it);
+        } else {
+            list.shrink_to_fit();
+            ++it;
+        }
+    }
+
+    m_docIds.swap(docIds);
+    m_docOf.clear();
+    m_docOf.reserve(static_cast<qsizetype>(m_docIds.size()));
+    for (size_t doc = 0; doc < m_docIds.size(); ++doc) {
+        m_docOf.insert(m_docIds[doc], static_cast<quint32>(doc));
+    }
+    m_tombstones = 0;
+}
@@ -0,0 +1,104 @@
+/********************************************************************************
+ * @file   : TrigramIndex.h
+ * @brief  : 声明了 TrigramIndex 类。
+ *
+ * 该文件声明了播放列表搜索使用的增量三元组（trigram）倒排索引。
+ *
+ * @author : polarours
+ * @date   : 2026/10/18
+ ********************************************************************************/
+
+#ifndef AURORAPLAYER_TRIGRAMINDEX_H
+#define AURORAPLAYER_TRIGRAMINDEX_H
+
+#include <QHash>
+#include <QList>
+#include <QSet>
+#include <QString>
+#include <QStringView>
+
+#include <vector>
+
+#include "PlaylistStorage.h"
+
+/**
+ * @class TrigramIndex
+ * @brief 三元组倒排索引
+ *
+ * 文本经大小写折叠后，每个连续三字符组映射到包含它的文档列表。文档号是
+ * 内部的稠密 32 位编号，按加入顺序递增，因此按文件名建索引时倒排表天然
+ * 有序；之后补充的标签可能打乱顺序，相应的倒排表在下次查询时才排序。
+ * 删除只留下墓碑，墓碑过半时整体压缩。
+ *
+ * 查询返回包含查询串全部三元组的候选条目，调用方需再做一次子串校验。
+ */
+class TrigramIndex
+{
+public:
+    using ItemId = PlaylistStorage::ItemId;
+
+    static constexpr int kGramLength = 3; ///< 可使用索引的最短查询长度
+
+    /**
+     * @brief 为条目添加一段可搜索文本（同一条目可多次调用，例如文件名和标签）
+     *
+     * @param id   条目 ID
+     * @param text 文本
+     */
+    void addText(ItemId id, QStringView text);
+
+    /**
+     * @brief 删除条目
+     *
+     * @param id 条目 ID
+     */
+    void remove(ItemId id);
+
+    /**
+     * @brief 清空
+     */
+    void clear();
+
+    /**
+     * @brief 查询候选条目
+     *
+     * @param query 查询串（长度不少于 kGramLength）
+     * @return QList<ItemId> 候选条目 ID（按加入顺序）
+     */
+    QList<ItemId> candidates(QStringView query);
+
+    /**
+     * @brief 估算索引占用的内存（字节）
+     *
+     * @return qsizetype 字节数
+     */
+    qsizetype memoryUsage() const;
+
+    /**
+     * @brief 大小写折叠
+     *
+     * @param text 文本
+     * @return QString 折叠后的文本
+     */
+    static QString fold(QStringView text);
+
+private:
+    /**
+     * @brief 计算折叠文本中所有不重复的三元组
+     */
+    static std::vector<quint64> gramsOf(const QString& folded);
+
+    /**
+     * @brief 移除墓碑并重新编号文档
+     */
+    void compact();
+
+private:
+    QHash<quint64, std::vector<quint32>> m_postings; ///< 三元组 → 文档号列表
+    QSet<quint64> m_unsorted;                        ///< 需要排序去重的倒排表
+    std::vector<ItemId> m_docIds;                    ///< 文档号 → 条目 ID（InvalidId 为墓碑）
+    QHash<ItemId, quint32> m_docOf;                  ///< 条目 ID → 文档号
+    int m_tombstones = 0;                            ///< 墓碑数量
+};
+
+#endif // AURORAPLAYER_TRIGRAMINDEX_H
@@ -0,0 +1,301 @@
+/********************************************************************************
+ * @file   : VideoWall.cpp
+ * @brief  : 实现了 VideoWall 类。
+ *
+ * @author : polarours
+ * @date   : 2026/10/18
+ ********************************************************************************/
+
+#include "VideoWall.h"
+#include "../core/MediaClock.h"
+#include "../core/MediaPlayer.h"
+
+/**
+ * @brief 构造函数
+ *
+ * @param parent 父对象
+ */
+VideoWall::VideoWall(QObject* parent)
+    : QObject(parent)
+    , m_clock(std::make_shared<MediaClock>())
+    , m_state(AuroraPlayer::State::PlayerState::Stopped)
+    , m_playRequested(false)
+{
+}
+
+/**
+ * @brief 析构函数
+ */
+VideoWall::~VideoWall()
+{
+    clear();
+}
+
+/**
+ * @brief 设置各路媒体并在后台打开
+ *
+ * @param files     媒体文件路径列表
+ * @param audioTile 输出声音的一路
+ */
+void VideoWall::setSources(const QStringList& files, int audioTile)
+{
+    clear();
+    m_clock->setRunning(false);
+    m_clock->setTimeUs(0);
+
+    const int count = qMin(files.size(), kMaxTiles);
+    m_tiles.reserve(count);
+    for (int i = 0; i < count; ++i) {
+        Tile tile;
+        tile.source = files.at(i);
+        tile.player = new MediaPlayer(this);
+        tile.player->setSharedClock(m_clock);
+        tile.player->setSharedDecoding(true);
+        tile.player->setAudioEnabled(i == audioTile);
+        connect(tile.player, &PlaybackBackend::mediaStatusChanged, this, [this, i](PlaybackBackend::MediaStatus status) {
+                    onTileStatusChanged(i, status);
+                });
+        m_tiles.append(tile);
+    }
+
+    // 全部建好后再打开，状态回调中的序号才有效
+    for (const Tile& tile : m_tiles) {
+        tile.player->setMedia(tile.source);
+    }
+}
+
+/**
+ * @brief 获取路数
+ */
+int VideoWall::count() const
+{
+    return m_tiles.size();
+}
+
+/**
+ * @brief 获取某一路的媒体文件路径
+ */
+QString VideoWall::sourceAt(int index) const
+{
+    return index >= 0 && index < m_tiles.size() ? m_tiles.at(index).source : QString();
+}
+
+/**
+ * @brief 获取某一路的时长（毫秒）
+ */
+qint64 VideoWall::durationAt(int index) const
+{
+    return index >= 0 && index < m_tiles.size() ? m_tiles.at(index).player->duration() : 0;
+}
+
+/**
+ * @brief 设置某一路的视频输出组件
+ *
+ * @param index  序号
+ * @param widget 视频输出组件
+ */
+void VideoWall::setVideoOutput(int index, QVideoWidget* widget)
+{
+    if (index >= 0 && index < m_tiles.size()) {
+        m_tiles.at(index).player->setVideoOutput(widget);
+    }
+}
+
+/**
+ * @brief 获取共同的播放位置（毫秒）
+ */
+qint64 VideoWall::position() const
+{
+    return qMax<qint64>(m_clock->timeUs() / 1000, 0);
+}
+
+/**
+ * @brief 获取当前状态
+ */
+AuroraPlayer::State::PlayerState VideoWall::state() const
+{
+    return m_state;
+}
+
+/**
+ * @brief 开始播放
+ */
+void VideoWall::play()
+{
+    if (m_tiles.isEmpty() || m_state == AuroraPlayer::State::PlayerState::Playing) {
+        return;
+    }
+
+    // 全部播完（或打开失败）后再按播放：先回到开头并重新打开，打开后再同时开始
+    bool anyPlayable = false;
+    bool allDone = true;
+    for (const Tile& tile : m_tiles) {
+        anyPlayable = anyPlayable || !tile.failed;
+        allDone = allDone && (tile.ended || tile.failed);
+    }
+    if (!anyPlayable) {
+        return;
+    }
+    if (allDone) {
+        stop();
+    }
+
+    m_playRequested = true;
+    startIfReady();
+}
+
+/**
+ * @brief 暂停所有路
+ */
+void VideoWall::pause()
+{
+    m_playRequested = false;
+    if (m_state != AuroraPlayer::State::PlayerState::Playing) {
+        return;
+    }
+    for (const Tile& tile : m_tiles) {
+        tile.player->pause();
+    }
+    m_clock->setRunning(false);
+    setState(AuroraPlayer::State::PlayerState::Paused);
+}
+
+/**
+ * @brief 停止所有路，回到开头
+ */
+void VideoWall::stop()
+{
+    m_playRequested = false;
+    for (Tile& tile : m_tiles) {
+        tile.player->stop();
+        tile.ended = false;
+        // stop() 关闭了会话，重新打开以便再次同时开始
+        tile.settled = tile.failed;
+        if (!tile.failed) {
+            tile.player->setMedia(tile.source);
+        }
+    }
+    m_clock->setRunning(false);
+    m_clock->setTimeUs(0);
+    setState(AuroraPlayer::State::PlayerState::Stopped);
+}
+
+/**
+ * @brief 所有路跳转到同一位置
+ *
+ * @param position 播放位置（毫秒）
+ */
+void VideoWall::setPosition(qint64 position)
+{
+    m_clock->setTimeUs(position * 1000);
+    for (Tile& tile : m_tiles) {
+        if (tile.failed || (tile.ended && position >= tile.player->duration())) {
+            continue;
+        }
+        tile.player->setPosition(position);
+        // 已结束的一路跳回片内后重新打开，从同一位置继续
+        if (tile.ended) {
+            tile.ended = false;
+            if (m_state == AuroraPlayer::State::PlayerState::Playing) {
+                tile.player->play();
+            }
+        }
+    }
+}
+
+/**
+ * @brief 处理某一路的媒体状态变化
+ *
+ * @param index  序号
+ * @param status 媒体状态
+ */
+void VideoWall::onTileStatusChanged(int index, PlaybackBackend::MediaStatus status)
+{
+    if (index < 0 || index >= m_tiles.size()) {
+        return;
+    }
+    Tile& tile = m_tiles[index];
+
+    switch (status) {
+        case PlaybackBackend::MediaStatus::Loaded:
+            tile.settled = true;
+            startIfReady();
+            break;
+        case PlaybackBackend::MediaStatus::Invalid:
+            tile.settled = true;
+            tile.failed = true;
+            startIfReady();
+            break;
+        case PlaybackBackend::MediaStatus::EndOfMedia: {
+            tile.ended = true;
+            bool allEnded = true;
+            for (const Tile& other : m_tiles) {
+                allEnded = allEnded && (other.ended || other.failed);
+            }
+            if (allEnded) {
+                m_clock->setRunning(false);
+                setState(AuroraPlayer::State::PlayerState::Stopped);
+                emit finished();
+            }
+            break;
+        }
+        default:
+            break;
+    }
+}
+
+/**
+ * @brief 所有路都已打开时，按请求同时开始播放
+ */
+void VideoWall::startIfReady()
+{
+    if (!m_playRequested) {
+        return;
+    }
+    for (const Tile& tile : m_tiles) {
+        if (!tile.settled) {
+            return;
+        }
+    }
+
+    m_playRequested = false;
+    bool started = false;
+    for (const Tile& tile : m_tiles) {
+        if (!tile.failed && !tile.ended) {
+            tile.player->play();
+            started = true;
+        }
+    }
+    // 没有一路能播放时不启动共享时钟，否则时钟会越过结尾继续走
+    if (!started) {
+        return;
+    }
+    m_clock->setRunning(true);
+    setState(AuroraPlayer::State::PlayerState::Playing);
+}
+
+/**
+ * @brief 设置状态并发出信号
+ *
+ * @param state 播放状态
+ */
+void VideoWall::setState(AuroraPlayer::State::PlayerState state)
+{
+    if (m_state != state) {
+        m_state = state;
+        emit stateChanged(state);
+    }
+}
+
+/**
+ * @brief 删除所有播放器
+ */
+void VideoWall::clear()
+{
+    for (const Tile& tile : m_tiles) {
+        delete tile.player;
+    }
+    m_tiles.clear();
+    m_playRequested = false;
+    setState(AuroraPlayer::State::PlayerState::Stopped);
+}
@@ -0,0 +1,183 @@
+/********************************************************************************
+ * @file   : VideoWall.h
+ * @brief  : 声明了 VideoWall 类。
+ *
+ * 该文件声明了视频墙：同一进程内同时播放多路媒体（如 3×3 监控画面）。所有
+ * MediaPlayer 共享一个 MediaClock，画面按同一时间轴显示；解码使用单线程解码器
+ * 并由进程内的 DecodeScheduler 限制并发，避免 N 路 × 每路线程池过度订阅 CPU。
+ * 只有一路输出声音，其余各路不解码音频。
+ *
+ * @author : polarours
+ * @date   : 2026/10/18
+ ********************************************************************************/
+
+#ifndef AURORAPLAYER_VIDEOWALL_H
+#define AURORAPLAYER_VIDEOWALL_H
+
+#include <QList>
+#include <QObject>
+#include <QStringList>
+
+#include <memory>
+
+#include "CommonState.h"
+#include "../core/PlaybackBackend.h"
+
+// --- 前向声明 --- //
+class MediaClock;
+class MediaPlayer;
+class QVideoWidget;
+
+class VideoWall : public QObject
+{
+    Q_OBJECT
+
+public:
+    static constexpr int kMaxTiles = 16; ///< 最多同时播放的路数
+
+    /**
+     * @brief 构造函数
+     *
+     * @param parent 父对象
+     */
+    explicit VideoWall(QObject* parent = nullptr);
+
+    /**
+     * @brief 析构函数，停止所有播放器
+     */
+    ~VideoWall() override;
+
+    /**
+     * @brief 设置各路媒体（超出 kMaxTiles 的部分被忽略）并在后台打开
+     *
+     * @param files     媒体文件路径列表
+     * @param audioTile 输出声音的一路，-1 表示全部静音
+     */
+    void setSources(const QStringList& files, int audioTile = 0);
+
+    /**
+     * @brief 获取路数
+     *
+     * @return int 路数
+     */
+    int count() const;
+
+    /**
+     * @brief 获取某一路的媒体文件路径
+     *
+     * @param index 序号
+     * @return QString 媒体文件路径
+     */
+    QString sourceAt(int index) const;
+
+    /**
+     * @brief 获取某一路的时长
+     *
+     * @param index 序号
+     * @return qint64 时长（毫秒），未打开时为 0
+     */
+    qint64 durationAt(int index) const;
+
+    /**
+     * @brief 设置某一路的视频输出组件
+     *
+     * @param index  序号
+     * @param widget 视频输出组件
+     */
+    void setVideoOutput(int index, QVideoWidget* widget);
+
+    /**
+     * @brief 获取共同的播放位置
+     *
+     * @return qint64 播放位置（毫秒）
+     */
+    qint64 position() const;
+
+    /**
+     * @brief 获取当前状态
+     *
+     * @return AuroraPlayer::State::PlayerState 播放状态
+     */
+    AuroraPlayer::State::PlayerState state() const;
+
+public slots:
+    /**
+     * @brief 开始播放（等所有路都打开后同时开始）
+     */
+    void play();
+
+    /**
+     * @brief 暂停所有路
+     */
+    void pause();
+
+    /**
+     * @brief 停止所有路，回到开头
+     */
+    void stop();
+
+    /**
+     * @brief 所有路跳转到同一位置
+     *
+     * @param position 播放位置（毫秒）
+     */
+    void setPosition(qint64 position);
+
+signals:
+    /**
+     * @brief 播放状态变化
+     *
+     * @param state 播放状态
+     */
+    void stateChanged(AuroraPlayer::State::PlayerState state);
+
+    /**
+     * @brief 所有路都已播放到结尾
+     */
+    void finished();
+
+private:
+    /**
+     * @brief 处理某一路的媒体状态变化
+     *
+     * @param index  序号
+     * @param status 媒体状态
+     */
+    void onTileStatusChanged(int index, PlaybackBackend::MediaStatus status);
+
+    /**
+     * @brief 所有路都已打开（或失败）时，按请求开始播放
+     */
+    void startIfReady();
+
+    /**
+     * @brief 设置状态并发出信号
+     *
+     * @param state 播放状态
+     */
+    void setState(AuroraPlayer::State::PlayerState state);
+
+    /**
+     * @brief 删除所有播放器
+     */
+    void clear();
+
+private:
+    /**
+     * @brief 每一路的状态
+     */
+    struct Tile {
+        QString source;                 ///< 媒体文件路径
+        MediaPlayer* player = nullptr;  ///< 播放器
+        bool settled = false;           ///< 已打开或已失败
+        bool failed = false;            ///< 打开失败
+        bool ended = false;             ///< 已播放到结尾
+    };
+
+    QList<Tile> m_tiles;                  ///< 各路
+    std::shared_ptr<MediaClock> m_clock;  ///< 共享时钟
+    AuroraPlayer::State::PlayerState m_state; ///< 播放状态
+    bool m_playRequested;                 ///< 已请求播放但尚未全部打开
+};
+
+#endif // AURORAPLAYER_VIDEOWALL_H
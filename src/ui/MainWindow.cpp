@@ -11,26 +11,46 @@
 #include "MainWindow.h"
 #include "../player/PlayerController.h"
 #include "../player/PlaylistManager.h"
+#include "../player/FolderImporter.h"
+#include "../player/PlaylistLoader.h"
+#include "../player/DuplicateFinder.h"
+#include "../player/MetadataService.h"
+#include "../core/LibraryIndex.h"
+#include "../player/PlaylistWriter.h"
+#include "../player/VideoWall.h"
+#include "../core/Tracer.h"
+#include "StatsOverlay.h"
+#include "VideoWallWindow.h"
+#include "PlaylistModel.h"
 #include "CommonUtils.h"
 
 #include <QApplication>
 #include <QMenuBar>
 #include <QMenu>
+#include <QActionGroup>
 #include <QToolBar>
 #include <QStatusBar>
 #include <QDir>
 #include <QFileDialog>
-#include <QFileInfo>
-#include <QListWidget>
+#include <QListView>
+#include <QLocale>
+#include <QItemSelectionModel>
 #include <QPushButton>
 #include <QSlider>
 #include <QLabel>
+#include <QLineEdit>
 #include <QTime>
 #include <QVBoxLayout>
 #include <QHBoxLayout>
 #include <QMessageBox>
+#include <QTimer>
+#include <QScreen>
+#include <QSet>
+#include <QGuiApplication>
 
 #include <QVideoWidget>
+#include <QWindow>
+#include <QEvent>
 
 /**
  * @brief MainWindow 的构造函数。
@@ -41,10 +61,23 @@
  */
 MainWindow::MainWindow(QWidget* parent)
     : QMainWindow(parent)
+    , statsOverlay(nullptr)
+    , statsTimer(new QTimer(this))
+    , m_displayedSecond(-1)
+    , m_durationText(formatTime(0))
     , playerController(new PlayerController(this))
+    , folderImporter(new FolderImporter(this))
+    , playlistLoader(new PlaylistLoader(this))
+    , duplicateFinder(new DuplicateFinder(this))
+    , m_duplicatesInPlaylist(false)
 {
     setupUI();
     setupConnections();
+
+    // 播放位置按显示刷新率合并通知
+    if (QScreen* screen = QGuiApplication::primaryScreen()) {
+        playerController->setPositionUpdateRate(screen->refreshRate());
+    }
     setWindowTitle(tr("AuroraPlayer"));
     resize(800, 600);
 }
@@ -56,7 +89,20 @@ MainWindow::MainWindow(QWidget* parent)
  */
 MainWindow::~MainWindow()
 {
-    // TODO: 释放播放器控制器
+    // 先于界面部件释放播放控制器：停止播放线程，之后不再有帧和信号送往正在销毁的部件
+    disconnect(playerController, nullptr, this, nullptr);
+    delete playerController;
+    playerController = nullptr;
+}
+
+/**
+ * @brief 获取播放控制器
+ *
+ * @return PlayerController* 播放控制器
+ */
+PlayerController* MainWindow::controller() const
+{
+    return playerController;
 }
 
 /**
@@ -80,10 +126,61 @@ void MainWindow::setupConnections()
     // --- Player connections --- //
     connect(playerController, &PlayerController::durationChanged, this, &MainWindow::updateDuration);
     connect(playerController, &PlayerController::positionChanged, this, &MainWindow::updateTimeDisplay);
+
+    // --- Statistics --- //
+    // 统计按固定低频率拉取，不随帧率变化
+    connect(statsTimer, &QTimer::timeout, this, &MainWindow::refreshStats);
+    statsTimer->start(500);
+    m_statsClock.start();
     
     // --- Playlist connections --- //
-    connect(playerController, &PlayerController::playlistChanged, this, &MainWindow::onPlaylistChanged);
-    connect(playlistWidget, &QListWidget::itemDoubleClicked, this, &MainWindow::onPlaylistItemDoubleClicked);
+    connect(playlistView, &QListView::activated, this, &MainWindow::onPlaylistActivated);
+
+    // --- Folder import connections --- //
+    connect(folderImporter, &FolderImporter::batchReady,
+            playerController->playlistManager(), &PlaylistManager::addFiles);
+    connect(folderImporter, &FolderImporter::progress, this, &MainWindow::onImportProgress);
+    connect(folderImporter, &FolderImporter::finished, this, &MainWindow::onImportFinished);
+    connect(cancelImportButton, &QPushButton::clicked, folderImporter, &FolderImporter::cancel);
+
+    // --- Playlist file connections --- //
+    connect(playlistLoader, &PlaylistLoader::batchReady,
+            playerController->playlistManager(), &PlaylistManager::addFiles);
+    connect(playlistLoader, &PlaylistLoader::progress, this, &MainWindow::onPlaylistLoadProgress);
+    connect(playlistLoader, &PlaylistLoader::finished, this, &MainWindow::onPlaylistLoadFinished);
+    connect(playlistLoader, &PlaylistLoader::failed, this, [this](const QString& message) {
+                cancelLoadButton->hide();
+                QMessageBox::warning(this, tr("Load Playlist"), tr("Failed to load playlist: %1").arg(message));
+            });
+    connect(cancelLoadButton, &QPushButton::clicked, playlistLoader, &PlaylistLoader::cancel);
+
+    // --- Duplicate finder connections --- //
+    connect(duplicateFinder, &DuplicateFinder::progress, this,
+            [this](DuplicateFinder::Stage stage, int done, int total, qint64 bytesRead) {
+                QString stageText;
+                switch (stage) {
+                    case DuplicateFinder::Stage::Size:
+                        stageText = tr("checking sizes");
+                        break;
+                    case DuplicateFinder::Stage::Sample:
+                        stageText = tr("sampling contents");
+                        break;
+                    case DuplicateFinder::Stage::Full:
+                        stageText = tr("confirming contents");
+                        break;
+                }
+                statusBar()->showMessage(tr("Finding duplicates: %1 %2/%3 (%4 read)")
+                                             .arg(stageText).arg(done).arg(total)
+                                             .arg(QLocale().formattedDataSize(bytesRead)));
+            });
+    connect(duplicateFinder, &DuplicateFinder::duplicatesFound, this, &MainWindow::onDuplicatesFound);
+    connect(duplicateFinder, &DuplicateFinder::finished, this, [this](bool cancelled) {
+                cancelDuplicatesButton->hide();
+                if (cancelled) {
+                    statusBar()->showMessage(tr("Duplicate search cancelled"), 5000);
+                }
+            });
+    connect(cancelDuplicatesButton, &QPushButton::clicked, duplicateFinder, &DuplicateFinder::cancel);
 }
 
 /**
@@ -104,15 +201,310 @@ void MainWindow::openFile()
         QDir::homePath(),
         tr("Media Files (*.mp3 *.mp4 *.avi *.mkv *.wav *.flv *.mov *.wmv)"));
     
-    if (!fileNames.isEmpty()) {
-        // 添加到播放列表
-        playerController->playlistManager()->addFiles(fileNames);
-        
-        // 如果是第一次添加文件，自动播放第一个
-        if (playerController->playlistManager()->count() == fileNames.size()) {
-            playerController->play();
-            playButton->setText(tr("Pause"));
+    openFiles(fileNames);
+}
+
+/**
+ * @brief 将文件加入播放列表
+ *
+ * @param fileNames 媒体文件路径列表
+ * @param playNow   是否立即播放新加入的第一个文件
+ */
+void MainWindow::openFiles(const QStringList& fileNames, bool playNow)
+{
+    if (fileNames.isEmpty()) {
+        return;
+    }
+
+    // 添加到播放列表
+    PlaylistManager* playlistManager = playerController->playlistManager();
+    const int firstNew = playlistManager->count();
+    playlistManager->addFiles(fileNames);
+
+    // 如果是第一次添加文件，自动播放第一个；否则按需切换到新加入的第一个
+    if (firstNew == 0) {
+        playerController->play();
+        playButton->setText(tr("Pause"));
+    } else if (playNow) {
+        playlistManager->setCurrentIndex(firstNew);
+        playerController->play();
+        playButton->setText(tr("Pause"));
+    }
+}
+
+/**
+ * @brief 窗口最小化/还原时更新画面可见状态
+ */
+void MainWindow::changeEvent(QEvent* event)
+{
+    QMainWindow::changeEvent(event);
+    if (event->type() == QEvent::WindowStateChange) {
+        updateVideoVisibility();
+    }
+}
+
+/**
+ * @brief 窗口显示时更新画面可见状态
+ */
+void MainWindow::showEvent(QShowEvent* event)
+{
+    QMainWindow::showEvent(event);
+    // 原生窗口在第一次显示时才创建；重复安装不会重复过滤
+    if (windowHandle()) {
+        windowHandle()->installEventFilter(this);
+    }
+    updateVideoVisibility();
+}
+
+/**
+ * @brief 窗口隐藏时更新画面可见状态
+ */
+void MainWindow::hideEvent(QHideEvent* event)
+{
+    QMainWindow::hideEvent(event);
+    updateVideoVisibility();
+}
+
+/**
+ * @brief 跟踪视频部件的显示/隐藏和窗口的暴露状态
+ */
+bool MainWindow::eventFilter(QObject* watched, QEvent* event)
+{
+    const QEvent::Type type = event->type();
+    if ((watched == videoWidget && (type == QEvent::Show || type == QEvent::Hide))
+        || (watched == windowHandle() && type == QEvent::Expose)) {
+        // 事件处理完后窗口和部件的状态才更新
+        QTimer::singleShot(0, this, &MainWindow::updateVideoVisibility);
+    }
+    return QMainWindow::eventFilter(watched, event);
+}
+
+/**
+ * @brief 计算画面是否可见并通知播放控制器
+ */
+void MainWindow::updateVideoVisibility()
+{
+    const QWindow* window = windowHandle();
+    const bool visible = isVisible()
+                      && !isMinimized()
+                      && videoWidget->isVisible()
+                      && (!window || window->isExposed());
+    playerController->setVideoVisible(visible);
+}
+
+/**
+ * @brief 选择文件夹并递归导入其中的媒体文件。
+ */
+void MainWindow::openFolder()
+{
+    const QString dirPath = QFileDialog::getExistingDirectory(
+        this,
+        tr("Import Folder"),
+        QDir::homePath());
+
+    if (dirPath.isEmpty()) {
+        return;
+    }
+
+    folderImporter->start(QStringList{dirPath});
+    cancelImportButton->show();
+    statusBar()->showMessage(tr("Importing %1...").arg(dirPath));
+}
+
+/**
+ * @brief 更新文件夹导入进度显示。
+ *
+ * @param scannedDirs  已扫描目录数
+ * @param scannedFiles 已检查文件数
+ * @param mediaFiles   已识别的媒体文件数
+ */
+void MainWindow::onImportProgress(int scannedDirs, int scannedFiles, int mediaFiles)
+{
+    statusBar()->showMessage(tr("Importing: %1 folders, %2 files scanned, %3 media files found")
+                                 .arg(scannedDirs).arg(scannedFiles).arg(mediaFiles));
+}
+
+/**
+ * @brief 文件夹导入结束。
+ *
+ * @param cancelled 是否被取消
+ */
+void MainWindow::onImportFinished(bool cancelled)
+{
+    cancelImportButton->hide();
+    statusBar()->showMessage((cancelled ? tr("Import cancelled") : tr("Import finished")) + pathMemorySummary(), 5000);
+}
+
+/**
+ * @brief 选择播放列表文件并替换当前播放列表。
+ */
+void MainWindow::loadPlaylist()
+{
+    const QString filePath = QFileDialog::getOpenFileName(
+        this,
+        tr("Load Playlist"),
+        QDir::homePath(),
+        tr("Playlists (*.m3u *.m3u8 *.apl);;All Files (*)"));
+
+    if (filePath.isEmpty()) {
+        return;
+    }
+
+    folderImporter->cancel();
+    playerController->playlistManager()->clear();
+    playlistLoader->start(filePath);
+    cancelLoadButton->show();
+    statusBar()->showMessage(tr("Loading %1...").arg(filePath));
+}
+
+/**
+ * @brief 将当前播放列表保存为 M3U8 或二进制格式。
+ */
+void MainWindow::savePlaylist()
+{
+    const QString filePath = QFileDialog::getSaveFileName(
+        this,
+        tr("Save Playlist"),
+        QDir::homePath(),
+        tr("M3U8 Playlist (*.m3u8);;Compact Binary Playlist (*.apl)"));
+
+    if (filePath.isEmpty()) {
+        return;
+    }
+
+    QString error;
+    if (!PlaylistWriter::save(filePath, *playerController->playlistManager(), &error)) {
+        QMessageBox::warning(this, tr("Save Playlist"), tr("Failed to save playlist: %1").arg(error));
+        return;
+    }
+    statusBar()->showMessage(tr("Playlist saved to %1").arg(filePath), 5000);
+}
+
+/**
+ * @brief 更新播放列表加载进度显示。
+ *
+ * @param processedBytes 已处理字节数
+ * @param totalBytes     文件总字节数
+ */
+void MainWindow::onPlaylistLoadProgress(qint64 processedBytes, qint64 totalBytes)
+{
+    const int percent = totalBytes > 0 ? static_cast<int>(processedBytes * 100 / totalBytes) : 0;
+    statusBar()->showMessage(tr("Loading playlist: %1% (%2 entries)")
+                                 .arg(percent).arg(playerController->playlistManager()->count()));
+}
+
+/**
+ * @brief 播放列表加载结束。
+ *
+ * @param cancelled 是否被取消
+ */
+void MainWindow::onPlaylistLoadFinished(bool cancelled)
+{
+    cancelLoadButton->hide();
+    statusBar()->showMessage(cancelled ? tr("Playlist loading cancelled")
+                                       : tr("Loaded %1 entries").arg(playerController->playlistManager()->count())
+                                             + pathMemorySummary(),
+                             5000);
+}
+
+/**
+ * @brief 生成播放列表路径内存占用摘要
+ *
+ * @return QString 形如 " (paths: x, y saved)" 的摘要
+ */
+QString MainWindow::pathMemorySummary() const
+{
+    const PlaylistStorage::MemoryStats stats = playerController->playlistManager()->pathMemoryStats();
+    const QLocale locale;
+    return tr(" (paths: %1, %2 saved)")
+        .arg(locale.formattedDataSize(stats.bytes),
+             locale.formattedDataSize(qMax<qsizetype>(0, stats.plainBytes - stats.bytes)));
+}
+
+/**
+ * @brief 在当前播放列表中查找内容重复的文件。
+ */
+void MainWindow::findDuplicatesInPlaylist()
+{
+    PlaylistManager* playlistManager = playerController->playlistManager();
+    QStringList paths;
+    paths.reserve(playlistManager->count());
+    for (int i = 0; i < playlistManager->count(); ++i) {
+        paths.append(playlistManager->filePathAt(i));
+    }
+
+    m_duplicatesInPlaylist = true;
+    duplicateFinder->start(paths);
+    cancelDuplicatesButton->show();
+}
+
+/**
+ * @brief 在媒体库索引中查找内容重复的文件。
+ */
+void MainWindow::findDuplicatesInLibrary()
+{
+    LibraryIndex* libraryIndex = playerController->metadataService()->libraryIndex();
+    if (!libraryIndex) {
+        statusBar()->showMessage(tr("Media library is not available"), 5000);
+        return;
+    }
+
+    m_duplicatesInPlaylist = false;
+    duplicateFinder->start(libraryIndex->filePaths());
+    cancelDuplicatesButton->show();
+}
+
+/**
+ * @brief 显示重复文件查找结果。
+ *
+ * 查找对象为播放列表时，可以只保留每组中最靠前的一份。
+ *
+ * @param groups         重复文件组
+ * @param redundantBytes 每组只保留一份时可节省的字节数
+ */
+void MainWindow::onDuplicatesFound(const QList<QStringList>& groups, qint64 redundantBytes)
+{
+    if (groups.isEmpty()) {
+        statusBar()->showMessage(tr("No duplicates found"), 5000);
+        return;
+    }
+
+    int redundantFiles = 0;
+    QStringList details;
+    for (const QStringList& group : groups) {
+        redundantFiles += group.size() - 1;
+        details.append(group.join(QLatin1Char('\n')));
+    }
+
+    const QString summary = tr("Found %1 groups of identical files (%2 redundant copies, %3).")
+                                .arg(groups.size()).arg(redundantFiles)
+                                .arg(QLocale().formattedDataSize(redundantBytes));
+    statusBar()->showMessage(summary, 5000);
+
+    QMessageBox box(QMessageBox::Information, tr("Find Duplicates"), summary, QMessageBox::Close, this);
+    box.setDetailedText(details.join(QStringLiteral("\n\n")));
+    QPushButton* removeButton = nullptr;
+    if (m_duplicatesInPlaylist) {
+        removeButton = box.addButton(tr("Remove Extra Copies"), QMessageBox::DestructiveRole);
+    }
+    box.exec();
+
+    if (removeButton && box.clickedButton() == removeButton) {
+        QSet<QString> extras;
+        for (const QStringList& group : groups) {
+            for (qsizetype i = 1; i < group.size(); ++i) {
+                extras.insert(group.at(i));
+            }
+        }
+
+        PlaylistManager* playlistManager = playerController->playlistManager();
+        QList<int> rows;
+        for (int i = 0; i < playlistManager->count(); ++i) {
+            if (extras.contains(playlistManager->filePathAt(i))) {
+                rows.append(i);
+            }
         }
+        playlistManager->removeFiles(rows);
     }
 }
 
@@ -172,9 +564,17 @@ void MainWindow::setVolume(int volume)
  */
 void MainWindow::updateTimeDisplay(qint64 position)
 {
-    qint64 duration = playerController->duration();
-    timeLabel->setText(formatTime(position) + " / " + formatTime(duration));
-    seekSlider->setValue(static_cast<int>(position));
+    // 标签只显示到秒，秒数不变时不重建文本
+    const qint64 second = position / 1000;
+    if (second != m_displayedSecond) {
+        m_displayedSecond = second;
+        timeLabel->setText(formatTime(position) + " / " + m_durationText);
+    }
+
+    // 用户拖动时不覆盖滑块位置
+    if (!seekSlider->isSliderDown()) {
+        seekSlider->setValue(static_cast<int>(position));
+    }
 }
 
 /**
@@ -186,7 +586,9 @@ void MainWindow::updateDuration(qint64 duration)
 {
     seekSlider->setRange(0, static_cast<int>(duration));
     seekSlider->setEnabled(duration > 0);
-    timeLabel->setText("00:00 / " + formatTime(duration));
+    m_durationText = formatTime(duration);
+    m_displayedSecond = 0;
+    timeLabel->setText(formatTime(0) + " / " + m_durationText);
 }
 
 /**
@@ -206,33 +608,137 @@ void MainWindow::previousMedia()
 }
 
 /**
- * @brief 处理播放列表变化
+ * @brief 处理播放列表项激活（双击或回车）
+ *
+ * @param index 被激活的项
+ */
+void MainWindow::onPlaylistActivated(const QModelIndex& index)
+{
+    if (!index.isValid()) {
+        return;
+    }
+    playerController->playlistManager()->setCurrentIndex(playlistModel->sourceRow(index));
+    playerController->play();
+    playButton->setText(tr("Pause"));
+}
+
+/**
+ * @brief 从播放列表中移除选中的项
+ */
+void MainWindow::removeSelectedFromPlaylist()
+{
+    QList<int> rows;
+    const QModelIndexList selected = playlistView->selectionModel()->selectedRows();
+    rows.reserve(selected.size());
+    for (const QModelIndex& index : selected) {
+        rows.append(playlistModel->sourceRow(index));
+    }
+    playerController->playlistManager()->removeFiles(rows);
+}
+
+/**
+ * @brief 运行期启用/关闭分阶段追踪
+ *
+ * @param enabled 是否启用
+ */
+void MainWindow::setTracingEnabled(bool enabled)
+{
+    Tracer::setEnabled(enabled);
+    statusBar()->showMessage(enabled ? tr("Tracing enabled") : tr("Tracing disabled"), 3000);
+}
+
+/**
+ * @brief 将已记录的追踪事件导出为 Chrome trace JSON 文件
+ */
+void MainWindow::saveTrace()
+{
+    QString fileName = QFileDialog::getSaveFileName(
+        this,
+        tr("Save Trace"),
+        QDir::homePath() + "/aurora-trace.json",
+        tr("Chrome Trace (*.json)"));
+
+    if (fileName.isEmpty()) {
+        return;
+    }
+
+    if (Tracer::writeChromeTrace(fileName)) {
+        statusBar()->showMessage(tr("Trace saved to %1").arg(fileName), 5000);
+    } else {
+        QMessageBox::warning(this, tr("Save Trace"), tr("Failed to write %1").arg(fileName));
+    }
+}
+
+/**
+ * @brief 以视频墙同时播放选中的播放列表项
  */
-void MainWindow::onPlaylistChanged()
+void MainWindow::openVideoWall()
 {
-    playlistWidget->clear();
     PlaylistManager* playlistManager = playerController->playlistManager();
-    
-    for (int i = 0; i < playlistManager->count(); ++i) {
-        QString filePath = playlistManager->filePathAt(i);
-        QFileInfo fileInfo(filePath);
-        QListWidgetItem* item = new QListWidgetItem(fileInfo.fileName());
-        item->setToolTip(filePath);
-        playlistWidget->addItem(item);
+    QStringList files;
+    const QModelIndexList selected = playlistView->selectionModel()->selectedRows();
+    if (selected.size() > 1) {
+        for (const QModelIndex& index : selected) {
+            files.append(playlistManager->filePathAt(playlistModel->sourceRow(index)));
+        }
+    } else {
+        for (int i = 0; i < playlistManager->count() && files.size() < VideoWall::kMaxTiles; ++i) {
+            files.append(playlistManager->filePathAt(i));
+        }
     }
+    files = files.mid(0, VideoWall::kMaxTiles);
+    if (files.isEmpty()) {
+        statusBar()->showMessage(tr("Playlist is empty"), 3000);
+        return;
+    }
+
+    // 视频墙自带音频输出，主播放器先暂停
+    if (playerController->isPlaying()) {
+        togglePlayPause();
+    }
+    auto* window = new VideoWallWindow(files);
+    window->show();
 }
 
 /**
- * @brief 处理播放列表项双击事件
+ * @brief 显示/隐藏播放统计悬浮面板
  *
- * @param item 被双击的项
+ * @param visible 是否显示
  */
-void MainWindow::onPlaylistItemDoubleClicked(QListWidgetItem* item)
+void MainWindow::setStatsOverlayVisible(bool visible)
 {
-    int index = playlistWidget->row(item);
-    playerController->playlistManager()->setCurrentIndex(index);
-    playerController->play();
-    playButton->setText(tr("Pause"));
+    // 面板大多数时候不显示，第一次打开时才创建
+    if (!statsOverlay) {
+        if (!visible) {
+            return;
+        }
+        statsOverlay = new StatsOverlay(videoWidget, this);
+    }
+    statsOverlay->setVisible(visible);
+    if (visible) {
+        refreshStats();
+    }
+}
+
+/**
+ * @brief 按固定频率刷新播放统计
+ */
+void MainWindow::refreshStats()
+{
+    const PlaybackStats::Snapshot current = playerController->stats().snapshot();
+    const qint64 elapsedMs = m_statsClock.restart();
+
+    if (statsOverlay && statsOverlay->isVisible()) {
+        statsOverlay->updateStats(current, m_lastStats, elapsedMs);
+    }
+
+    // 状态栏标明当前后端，便于在同一媒体上对比
+    const QString summary = QLatin1Char('[') + PlaybackBackend::typeName(playerController->backendType())
+                          + QStringLiteral("] ") + StatsOverlay::summary(current, m_lastStats, elapsedMs);
+    if (statsLabel->text() != summary) {
+        statsLabel->setText(summary);
+    }
+    m_lastStats = current;
 }
 
 /**
@@ -318,18 +824,18 @@ void MainWindow::setupUI()
             color: #E0E0E0;
         }
         
-        QListWidget {
+        QListView {
             background-color: #3A3A3A;
             color: white;
             border: 1px solid #5A5A5A;
             alternate-background-color: #4A4A4A;
         }
         
-        QListWidget::item {
+        QListView::item {
             padding: 4px;
         }
         
-        QListWidget::item:selected {
+        QListView::item:selected {
             background-color: #87CEFA;
             color: black;
         }
@@ -352,6 +858,7 @@ void MainWindow::setupUI()
     // --- Video widget --- //
     videoWidget = new QVideoWidget(this);
     videoWidget->setStyleSheet("background-color: black;");
+    videoWidget->installEventFilter(this);
     playerController->setVideoOutput(videoWidget);
 
     // --- Control buttons --- //
@@ -383,20 +890,55 @@ void MainWindow::setupUI()
     QLabel* volumeLabel = new QLabel(tr("Volume"), this);
     QLabel* playlistLabel = new QLabel(tr("Playlist"), this);
 
-    // --- Playlist widget --- //
-    playlistWidget = new QListWidget(this);
+    // --- Playlist view --- //
+    // 统一行高让视图只为可见行布局和取数，百万级条目也无需遍历
+    playlistModel = new PlaylistModel(playerController->playlistManager(), playerController->metadataService(), this);
+    playlistView = new QListView(this);
+    playlistView->setModel(playlistModel);
+    playlistView->setUniformItemSizes(true);
+    playlistView->setSelectionMode(QAbstractItemView::ExtendedSelection);
+    playlistView->setEditTriggers(QAbstractItemView::NoEditTriggers);
+
+    QAction* removeAction = new QAction(tr("Remove from Playlist"), playlistView);
+    removeAction->setShortcut(QKeySequence::Delete);
+    removeAction->setShortcutContext(Qt::WidgetShortcut);
+    playlistView->addAction(removeAction);
+    connect(removeAction, &QAction::triggered, this, &MainWindow::removeSelectedFromPlaylist);
+
+    // 每次按键直接查询搜索索引，无需延迟合并；不足三个字符时不过滤，只给出提示
+    filterEdit = new QLineEdit(this);
+    filterEdit->setPlaceholderText(tr("Filter by name, title, artist or album (3+ characters)"));
+    filterEdit->setClearButtonEnabled(true);
+    connect(filterEdit, &QLineEdit::textChanged, playlistModel, &PlaylistModel::setFilter);
+    connect(filterEdit, &QLineEdit::textChanged, this, [this](const QString& text) {
+                if (!text.isEmpty() && !PlaylistManager::isSearchable(text)) {
+                    statusBar()->showMessage(tr("Type at least 3 characters to filter"), 2000);
+                }
+            });
+
+    QAction* findAction = new QAction(tr("Filter Playlist"), this);
+    findAction->setShortcut(QKeySequence::Find);
+    addAction(findAction);
+    connect(findAction, &QAction::triggered, this, [this]() {
+                filterEdit->setFocus();
+                filterEdit->selectAll();
+            });
 
     // --- Layouts --- //
     QVBoxLayout* mainLayout = new QVBoxLayout;
     QHBoxLayout* sliderLayout = new QHBoxLayout;
     QHBoxLayout* controlLayout = new QHBoxLayout;
+    QHBoxLayout* playlistHeaderLayout = new QHBoxLayout;
 
     // --- Assemble layouts --- //
     mainLayout->addWidget(videoWidget, 3);
     mainLayout->addLayout(sliderLayout);
     mainLayout->addLayout(controlLayout);
-    mainLayout->addWidget(playlistLabel);
-    mainLayout->addWidget(playlistWidget, 1);
+    mainLayout->addLayout(playlistHeaderLayout);
+    mainLayout->addWidget(playlistView, 1);
+
+    playlistHeaderLayout->addWidget(playlistLabel);
+    playlistHeaderLayout->addWidget(filterEdit, 1);
 
     sliderLayout->addWidget(seekSlider);
     sliderLayout->addWidget(timeLabel);
@@ -416,6 +958,86 @@ void MainWindow::setupUI()
     QAction* openAction = fileMenu->addAction(tr("&Open..."));
     openAction->setShortcut(QKeySequence::Open);
     connect(openAction, &QAction::triggered, this, &MainWindow::openFile);
+    QAction* openFolderAction = fileMenu->addAction(tr("Open &Folder..."));
+    openFolderAction->setShortcut(QKeySequence(Qt::CTRL | Qt::SHIFT | Qt::Key_O));
+    connect(openFolderAction, &QAction::triggered, this, &MainWindow::openFolder);
+    fileMenu->addSeparator();
+    QAction* loadPlaylistAction = fileMenu->addAction(tr("&Load Playlist..."));
+    loadPlaylistAction->setShortcut(QKeySequence(Qt::CTRL | Qt::Key_L));
+    connect(loadPlaylistAction, &QAction::triggered, this, &MainWindow::loadPlaylist);
+    QAction* savePlaylistAction = fileMenu->addAction(tr("&Save Playlist..."));
+    savePlaylistAction->setShortcut(QKeySequence::Save);
+    connect(savePlaylistAction, &QAction::triggered, this, &MainWindow::savePlaylist);
+
+    QMenu* playlistMenu = menuBar()->addMenu(tr("&Playlist"));
+    QMenu* sortMenu = playlistMenu->addMenu(tr("&Sort By"));
+    QAction* descendingAction = new QAction(tr("&Descending"), sortMenu);
+    descendingAction->setCheckable(true);
+    const QList<QPair<QString, PlaylistManager::SortKey>> sortKeys{
+        {tr("File &Name"), PlaylistManager::SortKey::FileName},
+        {tr("File &Path"), PlaylistManager::SortKey::FilePath},
+        {tr("D&uration"), PlaylistManager::SortKey::Duration},
+        {tr("&Modified Date"), PlaylistManager::SortKey::ModifiedTime},
+        {tr("File Si&ze"), PlaylistManager::SortKey::FileSize},
+        {tr("&Title"), PlaylistManager::SortKey::Title},
+        {tr("&Artist"), PlaylistManager::SortKey::Artist},
+        {tr("Al&bum"), PlaylistManager::SortKey::Album},
+    };
+    for (const auto& sortKey : sortKeys) {
+        QAction* sortAction = sortMenu->addAction(sortKey.first);
+        const PlaylistManager::SortKey key = sortKey.second;
+        connect(sortAction, &QAction::triggered, this, [this, key, descendingAction]() {
+                    QElapsedTimer timer;
+                    timer.start();
+                    playerController->playlistManager()->sort(
+                        key, descendingAction->isChecked() ? Qt::DescendingOrder : Qt::AscendingOrder);
+                    statusBar()->showMessage(tr("Sorted %1 entries in %2 ms")
+                                                 .arg(playerController->playlistManager()->count())
+                                                 .arg(timer.elapsed()), 5000);
+                });
+    }
+    sortMenu->addSeparator();
+    sortMenu->addAction(descendingAction);
+
+    QMenu* toolsMenu = menuBar()->addMenu(tr("&Tools"));
+    QAction* tracingAction = toolsMenu->addAction(tr("Enable &Tracing"));
+    tracingAction->setCheckable(true);
+    tracingAction->setChecked(Tracer::isEnabled());
+    connect(tracingAction, &QAction::toggled, this, &MainWindow::setTracingEnabled);
+    QAction* saveTraceAction = toolsMenu->addAction(tr("&Save Trace..."));
+    connect(saveTraceAction, &QAction::triggered, this, &MainWindow::saveTrace);
+    toolsMenu->addSeparator();
+    QMenu* duplicatesMenu = toolsMenu->addMenu(tr("Find &Duplicates"));
+    QAction* playlistDuplicatesAction = duplicatesMenu->addAction(tr("In &Playlist"));
+    connect(playlistDuplicatesAction, &QAction::triggered, this, &MainWindow::findDuplicatesInPlaylist);
+    QAction* libraryDuplicatesAction = duplicatesMenu->addAction(tr("In &Library"));
+    connect(libraryDuplicatesAction, &QAction::triggered, this, &MainWindow::findDuplicatesInLibrary);
+    QAction* videoWallAction = toolsMenu->addAction(tr("Video &Wall"));
+    connect(videoWallAction, &QAction::triggered, this, &MainWindow::openVideoWall);
+    toolsMenu->addSeparator();
+    QMenu* backendMenu = toolsMenu->addMenu(tr("Playback &Engine"));
+    QActionGroup* backendGroup = new QActionGroup(backendMenu);
+    const QList<QPair<QString, PlaybackBackend::Type>> backends{
+        {tr("&Qt Multimedia"), PlaybackBackend::Type::QtMultimedia},
+        {tr("&FFmpeg"), PlaybackBackend::Type::FFmpeg},
+    };
+    for (const auto& backend : backends) {
+        QAction* backendAction = backendMenu->addAction(backend.first);
+        backendAction->setCheckable(true);
+        backendAction->setChecked(playerController->backendType() == backend.second);
+        backendGroup->addAction(backendAction);
+        const PlaybackBackend::Type type = backend.second;
+        connect(backendAction, &QAction::triggered, this, [this, type]() {
+                    playerController->setBackend(type);
+                    statusBar()->showMessage(tr("Playback engine: %1").arg(PlaybackBackend::typeName(type)), 5000);
+                });
+    }
+
+    QMenu* viewMenu = menuBar()->addMenu(tr("&View"));
+    QAction* statsAction = viewMenu->addAction(tr("&Statistics"));
+    statsAction->setCheckable(true);
+    statsAction->setShortcut(QKeySequence(Qt::CTRL | Qt::Key_I));
+    connect(statsAction, &QAction::toggled, this, &MainWindow::setStatsOverlayVisible);
 
     // --- Create toolbar --- //
     QToolBar* toolbar = addToolBar(tr("Playback"));
@@ -426,6 +1048,18 @@ void MainWindow::setupUI()
     toolbar->addWidget(stopButton);
 
     // --- Create status bar --- //
+    statsLabel = new QLabel(this);
+    statusBar()->addPermanentWidget(statsLabel);
+    // 每个后台操作各有一个取消按钮，点击只中止对应的操作
+    cancelImportButton = new QPushButton(tr("Cancel Import"), this);
+    cancelImportButton->hide();
+    statusBar()->addPermanentWidget(cancelImportButton);
+    cancelLoadButton = new QPushButton(tr("Cancel Loading"), this);
+    cancelLoadButton->hide();
+    statusBar()->addPermanentWidget(cancelLoadButton);
+    cancelDuplicatesButton = new QPushButton(tr("Cancel Duplicate Search"), this);
+    cancelDuplicatesButton->hide();
+    statusBar()->addPermanentWidget(cancelDuplicatesButton);
     statusBar()->showMessage(tr("Ready"));
     
     // 设置窗口大小
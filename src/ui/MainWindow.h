@@ -12,16 +12,26 @@
 #define MAINWINDOW_H
 
 #include <QMainWindow>
-#include <QListWidgetItem>
+#include <QElapsedTimer>
+
+#include "../core/PlaybackStats.h"
 
 // 前向声明
 class QWidget;
 class QPushButton;
 class QSlider;
 class QLabel;
-class QListWidget;
+class QLineEdit;
+class QListView;
+class QModelIndex;
 class QVideoWidget;
+class QTimer;
 class PlayerController;
+class PlaylistModel;
+class FolderImporter;
+class PlaylistLoader;
+class DuplicateFinder;
+class StatsOverlay;
 
 class MainWindow : public QMainWindow
 {
@@ -40,6 +50,42 @@ public:
      */
     ~MainWindow();
 
+    /**
+     * @brief 获取播放控制器
+     *
+     * @return PlayerController* 播放控制器
+     */
+    PlayerController* controller() const;
+
+    /**
+     * @brief 将文件加入播放列表；播放列表原本为空时自动播放第一个
+     *
+     * @param fileNames 媒体文件路径列表
+     * @param playNow   是否立即播放新加入的第一个文件（即使播放列表原本不为空）
+     */
+    void openFiles(const QStringList& fileNames, bool playNow = false);
+
+protected:
+    /**
+     * @brief 窗口最小化/还原时更新画面可见状态
+     */
+    void changeEvent(QEvent* event) override;
+
+    /**
+     * @brief 窗口显示时更新画面可见状态，并开始跟踪窗口的暴露状态
+     */
+    void showEvent(QShowEvent* event) override;
+
+    /**
+     * @brief 窗口隐藏时更新画面可见状态
+     */
+    void hideEvent(QHideEvent* event) override;
+
+    /**
+     * @brief 跟踪视频部件的显示/隐藏和窗口的暴露状态（被完全遮挡时不暴露）
+     */
+    bool eventFilter(QObject* watched, QEvent* event) override;
+
 private slots:
     /**
      * @brief 打开文件对话框以选择媒体文件。
@@ -48,6 +94,72 @@ private slots:
      */
     void openFile();
 
+    /**
+     * @brief 选择文件夹并递归导入其中的媒体文件。
+     *
+     * 扫描在后台线程进行，结果分批加入播放列表，可随时取消。
+     */
+    void openFolder();
+
+    /**
+     * @brief 更新文件夹导入进度显示。
+     *
+     * @param scannedDirs  已扫描目录数
+     * @param scannedFiles 已检查文件数
+     * @param mediaFiles   已识别的媒体文件数
+     */
+    void onImportProgress(int scannedDirs, int scannedFiles, int mediaFiles);
+
+    /**
+     * @brief 文件夹导入结束。
+     *
+     * @param cancelled 是否被取消
+     */
+    void onImportFinished(bool cancelled);
+
+    /**
+     * @brief 选择播放列表文件并替换当前播放列表
+     */
+    void loadPlaylist();
+
+    /**
+     * @brief 将当前播放列表保存为 M3U8 或二进制格式
+     */
+    void savePlaylist();
+
+    /**
+     * @brief 更新播放列表加载进度显示
+     *
+     * @param processedBytes 已处理字节数
+     * @param totalBytes     文件总字节数
+     */
+    void onPlaylistLoadProgress(qint64 processedBytes, qint64 totalBytes);
+
+    /**
+     * @brief 播放列表加载结束
+     *
+     * @param cancelled 是否被取消
+     */
+    void onPlaylistLoadFinished(bool cancelled);
+
+    /**
+     * @brief 在当前播放列表中查找内容重复的文件
+     */
+    void findDuplicatesInPlaylist();
+
+    /**
+     * @brief 在媒体库索引中查找内容重复的文件
+     */
+    void findDuplicatesInLibrary();
+
+    /**
+     * @brief 显示重复文件查找结果
+     *
+     * @param groups         重复文件组
+     * @param redundantBytes 每组只保留一份时可节省的字节数
+     */
+    void onDuplicatesFound(const QList<QStringList>& groups, qint64 redundantBytes);
+
     /**
      * @brief 切换播放/暂停状态。
      */
@@ -97,16 +209,45 @@ private slots:
     void previousMedia();
 
     /**
-     * @brief 处理播放列表变化
+     * @brief 处理播放列表项激活（双击或回车）
+     *
+     * @param index 被激活的项
+     */
+    void onPlaylistActivated(const QModelIndex& index);
+
+    /**
+     * @brief 从播放列表中移除选中的项
+     */
+    void removeSelectedFromPlaylist();
+
+    /**
+     * @brief 运行期启用/关闭分阶段追踪
+     *
+     * @param enabled 是否启用
+     */
+    void setTracingEnabled(bool enabled);
+
+    /**
+     * @brief 将已记录的追踪事件导出为 Chrome trace JSON 文件
      */
-    void onPlaylistChanged();
+    void saveTrace();
 
     /**
-     * @brief 处理播放列表项双击事件
+     * @brief 以视频墙同时播放选中的播放列表项（未选中时取前 16 项）
+     */
+    void openVideoWall();
+
+    /**
+     * @brief 显示/隐藏播放统计悬浮面板
      *
-     * @param item 被双击的项
+     * @param visible 是否显示
+     */
+    void setStatsOverlayVisible(bool visible);
+
+    /**
+     * @brief 按固定频率刷新播放统计（悬浮面板和状态栏）
      */
-    void onPlaylistItemDoubleClicked(QListWidgetItem* item);
+    void refreshStats();
 
 private:
     /**
@@ -127,6 +268,21 @@ private:
      */
     QString formatTime(qint64 duration) const;
 
+    /**
+     * @brief 生成播放列表路径内存占用摘要（附加在状态栏消息后）
+     *
+     * @return QString 摘要
+     */
+    QString pathMemorySummary() const;
+
+    /**
+     * @brief 计算画面是否可见并通知播放控制器
+     *
+     * 窗口最小化、隐藏、被完全遮挡或视频部件隐藏时画面不可见，播放引擎停止
+     * 视频解码和显示，音频照常播放。
+     */
+    void updateVideoVisibility();
+
 private:
     QWidget*      centralWidget;   ///< 中心部件
     QVideoWidget* videoWidget;     ///< 视频显示部件
@@ -138,9 +294,27 @@ private:
     QSlider*      seekSlider;      ///< 播放进度滑块
     QSlider*      volumeSlider;    ///< 音量控制滑块
     QLabel*       timeLabel;       ///< 时间显示标签
-    QListWidget*  playlistWidget;  ///< 播放列表控件
+    QListView*    playlistView;    ///< 播放列表视图
+    QLineEdit*    filterEdit;      ///< 播放列表过滤框
+    PlaylistModel* playlistModel;  ///< 播放列表模型
+    QLabel*       statsLabel;      ///< 状态栏统计摘要
+    QPushButton*  cancelImportButton; ///< 取消文件夹导入按钮
+    QPushButton*  cancelLoadButton;   ///< 取消播放列表加载按钮
+    QPushButton*  cancelDuplicatesButton; ///< 取消重复文件查找按钮
+    StatsOverlay* statsOverlay;    ///< 播放统计悬浮面板（第一次显示时创建）
+    QTimer*       statsTimer;      ///< 统计刷新定时器
+
+    qint64  m_displayedSecond;           ///< 时间标签当前显示的秒数
+    QString m_durationText;              ///< 已格式化的总时长文本
+
+    PlaybackStats::Snapshot m_lastStats; ///< 上一次统计快照
+    QElapsedTimer m_statsClock;          ///< 统计快照计时
 
     PlayerController* playerController;  ///< 播放控制器
+    FolderImporter*   folderImporter;    ///< 文件夹导入器
+    PlaylistLoader*   playlistLoader;    ///< 播放列表加载器
+    DuplicateFinder*  duplicateFinder;   ///< 重复文件查找器
+    bool m_duplicatesInPlaylist;         ///< 当前查找的对象是否为播放列表
 };
 
 #endif // MAINWINDOW_H
\ No newline at end of file
@@ -0,0 +1,315 @@
+/********************************************************************************
+ * @file   : PlaylistModel.cpp
+ * @brief  : 实现了 PlaylistModel 类。
+ *
+ * @author : polarours
+ * @date   : 2026/10/18
+ ********************************************************************************/
+
+#include "PlaylistModel.h"
+#include "../player/MetadataService.h"
+#include "CommonUtils.h"
+
+#include <QFont>
+
+#include <algorithm>
+#include <utility>
+
+/**
+ * @brief 构造函数
+ *
+ * @param playlistManager 播放列表管理器
+ * @param metadataService 元数据服务
+ * @param parent          父对象
+ */
+PlaylistModel::PlaylistModel(PlaylistManager* playlistManager, MetadataService* metadataService, QObject* parent)
+    : QAbstractListModel(parent)
+    , m_playlistManager(playlistManager)
+    , m_metadataService(metadataService)
+    , m_currentItem(playlistManager->itemIdAt(playlistManager->currentIndex()))
+{
+    // --- 行信号 --- //
+    connect(m_playlistManager, &PlaylistManager::rowsAboutToBeInserted, this, [this](int first, int last) {
+                if (m_filter.isEmpty()) {
+                    beginInsertRows(QModelIndex(), first, last);
+                } else {
+                    beginStructureChange();
+                }
+            });
+    connect(m_playlistManager, &PlaylistManager::rowsInserted, this, [this]() {
+                if (m_filter.isEmpty()) {
+                    endInsertRows();
+                } else {
+                    endStructureChange();
+                }
+            });
+    connect(m_playlistManager, &PlaylistManager::rowsAboutToBeRemoved, this, [this](int first, int last) {
+                if (m_filter.isEmpty()) {
+                    beginRemoveRows(QModelIndex(), first, last);
+                } else {
+                    beginStructureChange();
+                }
+            });
+    connect(m_playlistManager, &PlaylistManager::rowsRemoved, this, [this]() {
+                if (m_filter.isEmpty()) {
+                    endRemoveRows();
+                } else {
+                    endStructureChange();
+                }
+            });
+    connect(m_playlistManager, &PlaylistManager::rowsAboutToBeMoved, this, [this](int first, int last, int destination) {
+                if (m_filter.isEmpty()) {
+                    beginMoveRows(QModelIndex(), first, last, QModelIndex(), destination);
+                } else {
+                    beginStructureChange();
+                }
+            });
+    connect(m_playlistManager, &PlaylistManager::rowsMoved, this, [this]() {
+                if (m_filter.isEmpty()) {
+                    endMoveRows();
+                } else {
+                    endStructureChange();
+                }
+            });
+    connect(m_playlistManager, &PlaylistManager::playlistAboutToBeReset, this, [this]() {
+                beginResetModel();
+            });
+    connect(m_playlistManager, &PlaylistManager::playlistReset, this, [this]() {
+                m_currentItem = PlaylistStorage::InvalidId;
+                m_filterRows.clear();
+                endResetModel();
+            });
+
+    connect(m_playlistManager, &PlaylistManager::layoutAboutToBeChanged, this, &PlaylistModel::onLayoutAboutToBeChanged);
+    connect(m_playlistManager, &PlaylistManager::layoutChanged, this, &PlaylistModel::onLayoutChanged);
+
+    // --- 元数据 --- //
+    connect(m_playlistManager, &PlaylistManager::metadataChanged, this, [this](int first, int last) {
+                if (!m_filter.isEmpty()) {
+                    // 过滤结果不随元数据更新而变化，避免后台探测不断重置视图
+                    if (m_filterRows.isEmpty()) {
+                        return;
+                    }
+                    first = 0;
+                    last = m_filterRows.size() - 1;
+                }
+                emit dataChanged(index(first), index(last), {Qt::DisplayRole, Qt::ToolTipRole});
+            });
+
+    // --- 当前项 --- //
+    connect(m_playlistManager, &PlaylistManager::currentIndexChanged, this, &PlaylistModel::onCurrentIndexChanged);
+}
+
+/**
+ * @brief 获取行数
+ */
+int PlaylistModel::rowCount(const QModelIndex& parent) const
+{
+    if (parent.isValid()) {
+        return 0;
+    }
+    return m_filter.isEmpty() ? m_playlistManager->count() : m_filterRows.size();
+}
+
+/**
+ * @brief 获取指定行的数据
+ */
+QVariant PlaylistModel::data(const QModelIndex& index, int role) const
+{
+    const int row = sourceRow(index);
+    if (row < 0 || row >= m_playlistManager->count()) {
+        return QVariant();
+    }
+
+    switch (role) {
+        case Qt::DisplayRole: {
+            const MediaMetadata* metadata = m_playlistManager->metadataAt(row);
+            if (!metadata) {
+                // 只有视图实际需要绘制的行会走到这里
+                if (m_metadataService) {
+                    m_metadataService->request(m_playlistManager->itemIdAt(row), MetadataService::Priority::Visible);
+                }
+                return AuroraPlayer::Utils::getFileNameFromPath(m_playlistManager->filePathAt(row));
+            }
+
+            QString text = metadata->displayTitle();
+            if (text.isEmpty()) {
+                text = AuroraPlayer::Utils::getFileNameFromPath(m_playlistManager->filePathAt(row));
+            }
+            if (metadata->durationMs >= 0) {
+                text += QStringLiteral("  [") + AuroraPlayer::Utils::formatTime(metadata->durationMs) + QLatin1Char(']');
+            }
+            return text;
+        }
+        case Qt::ToolTipRole: {
+            QString tip = m_playlistManager->filePathAt(row);
+            const MediaMetadata* metadata = m_playlistManager->metadataAt(row);
+            if (metadata && metadata->valid) {
+                if (!metadata->album.isEmpty()) {
+                    tip += QStringLiteral("\n") + tr("Album: %1").arg(metadata->album);
+                }
+                if (!metadata->videoCodec.isEmpty()) {
+                    tip += QStringLiteral("\n") + tr("Video: %1 %2x%3")
+                               .arg(metadata->videoCodec).arg(metadata->width).arg(metadata->height);
+                }
+                if (!metadata->audioCodec.isEmpty()) {
+                    tip += QStringLiteral("\n") + tr("Audio: %1").arg(metadata->audioCodec);
+                }
+            }
+            return tip;
+        }
+        case FilePathRole:
+            return m_playlistManager->filePathAt(row);
+        case ItemIdRole:
+            return QVariant::fromValue(m_playlistManager->itemIdAt(row));
+        case Qt::FontRole:
+            if (row == m_playlistManager->currentIndex()) {
+                QFont font;
+                font.setBold(true);
+                return font;
+            }
+            return QVariant();
+        default:
+            return QVariant();
+    }
+}
+
+/**
+ * @brief 设置过滤串
+ *
+ * 不满足 PlaylistManager::isSearchable() 的短过滤串视为空，显示全部文件。
+ *
+ * @param text 过滤串，为空时显示全部文件
+ */
+void PlaylistModel::setFilter(const QString& text)
+{
+    const QString filter = PlaylistManager::isSearchable(text) ? text : QString();
+    if (filter == m_filter) {
+        return;
+    }
+
+    beginResetModel();
+    m_filter = filter;
+    m_filterRows = m_filter.isEmpty() ? QList<int>() : m_playlistManager->search(m_filter);
+    endResetModel();
+}
+
+/**
+ * @brief 获取当前过滤串
+ *
+ * @return QString 过滤串
+ */
+QString PlaylistModel::filter() const
+{
+    return m_filter;
+}
+
+/**
+ * @brief 将模型索引映射为播放列表索引
+ *
+ * @param index 模型索引
+ * @return int 播放列表索引，无效时为 -1
+ */
+int PlaylistModel::sourceRow(const QModelIndex& index) const
+{
+    return index.isValid() ? sourceRow(index.row()) : -1;
+}
+
+/**
+ * @brief 当前播放项变化时刷新新旧两行的高亮
+ */
+void PlaylistModel::onCurrentIndexChanged()
+{
+    const int oldRow = modelRow(m_playlistManager->indexOfItem(m_currentItem));
+    const int newSourceRow = m_playlistManager->currentIndex();
+    const int newRow = modelRow(newSourceRow);
+    m_currentItem = m_playlistManager->itemIdAt(newSourceRow);
+
+    const QList<int> roles{Qt::FontRole};
+    if (oldRow >= 0) {
+        emit dataChanged(index(oldRow), index(oldRow), roles);
+    }
+    if (newRow >= 0 && newRow != oldRow) {
+        emit dataChanged(index(newRow), index(newRow), roles);
+    }
+}
+
+/**
+ * @brief 播放列表即将重排：记录持久索引对应的条目
+ */
+void PlaylistModel::onLayoutAboutToBeChanged()
+{
+    emit layoutAboutToBeChanged({}, QAbstractItemModel::VerticalSortHint);
+
+    m_layoutIndexes = persistentIndexList();
+    m_layoutItems.clear();
+    m_layoutItems.reserve(m_layoutIndexes.size());
+    for (const QModelIndex& index : std::as_const(m_layoutIndexes)) {
+        m_layoutItems.append(m_playlistManager->itemIdAt(sourceRow(index)));
+    }
+}
+
+/**
+ * @brief 播放列表已重排：按条目 ID 更新持久索引
+ */
+void PlaylistModel::onLayoutChanged()
+{
+    if (!m_filter.isEmpty()) {
+        m_filterRows = m_playlistManager->search(m_filter);
+    }
+
+    QModelIndexList newIndexes;
+    newIndexes.reserve(m_layoutIndexes.size());
+    for (qsizetype i = 0; i < m_layoutIndexes.size(); ++i) {
+        const int row = modelRow(m_playlistManager->indexOfItem(m_layoutItems.at(i)));
+        newIndexes.append(row >= 0 ? index(row, m_layoutIndexes.at(i).column()) : QModelIndex());
+    }
+    changePersistentIndexList(m_layoutIndexes, newIndexes);
+    m_layoutIndexes.clear();
+    m_layoutItems.clear();
+
+    m_currentItem = m_playlistManager->itemIdAt(m_playlistManager->currentIndex());
+    emit layoutChanged({}, QAbstractItemModel::VerticalSortHint);
+}
+
+/**
+ * @brief 将模型行映射为播放列表索引
+ */
+int PlaylistModel::sourceRow(int row) const
+{
+    if (m_filter.isEmpty()) {
+        return row;
+    }
+    return row >= 0 && row < m_filterRows.size() ? m_filterRows.at(row) : -1;
+}
+
+/**
+ * @brief 将播放列表索引映射为模型行
+ */
+int PlaylistModel::modelRow(int sourceRow) const
+{
+    if (m_filter.isEmpty() || sourceRow < 0) {
+        return sourceRow;
+    }
+    const auto it = std::lower_bound(m_filterRows.cbegin(), m_filterRows.cend(), sourceRow);
+    return it != m_filterRows.cend() && *it == sourceRow ? static_cast<int>(it - m_filterRows.cbegin()) : -1;
+}
+
+/**
+ * @brief 开始一次结构变化（过滤期间转换为模型重置）
+ */
+void PlaylistModel::beginStructureChange()
+{
+    beginResetModel();
+}
+
+/**
+ * @brief 结束过滤期间的结构变化并重新过滤
+ *
+ * 过滤结果通常远小于播放列表，重新查询索引的代价与之相当。
+ */
+void PlaylistModel::endStructureChange()
+{
+    m_filterRows = m_playlistManager->search(m_filter);
+    endResetModel();
+}
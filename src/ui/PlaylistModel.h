@@ -0,0 +1,135 @@
+/********************************************************************************
+ * @file   : PlaylistModel.h
+ * @brief  : 声明了 PlaylistModel 类。
+ *
+ * 该文件声明了基于 PlaylistManager 的列表模型，供 QListView 虚拟化显示。
+ *
+ * @author : polarours
+ * @date   : 2026/10/18
+ ********************************************************************************/
+
+#ifndef AURORAPLAYER_PLAYLISTMODEL_H
+#define AURORAPLAYER_PLAYLISTMODEL_H
+
+#include <QAbstractListModel>
+
+#include "../player/PlaylistManager.h"
+
+class MetadataService;
+
+/**
+ * @class PlaylistModel
+ * @brief 播放列表模型
+ *
+ * 模型本身不保存任何逐行数据：行数和路径直接取自 PlaylistManager，
+ * 显示名在 data() 中按需计算，因此只有可见行会产生开销。
+ * PlaylistManager 的细粒度行信号被直接转换为对应的模型信号。
+ * 视图绘制尚无元数据的行时，以可见优先级向 MetadataService 请求探测。
+ *
+ * 设置过滤串（至少三个字符）后模型只显示 PlaylistManager::search() 的结果，模型行通过
+ * sourceRow() 映射回播放列表索引；过滤期间的结构变化一律转换为模型重置。
+ * 排序转换为一次 layoutChanged，选中项等持久索引按条目 ID 跟随。
+ */
+class PlaylistModel : public QAbstractListModel
+{
+    Q_OBJECT
+
+public:
+    /**
+     * @brief 自定义数据角色
+     */
+    enum Roles {
+        FilePathRole = Qt::UserRole + 1, ///< 完整文件路径
+        ItemIdRole                       ///< 稳定条目 ID
+    };
+
+    /**
+     * @brief 构造函数
+     *
+     * @param playlistManager 播放列表管理器
+     * @param metadataService 元数据服务，可为空
+     * @param parent          父对象
+     */
+    explicit PlaylistModel(PlaylistManager* playlistManager, MetadataService* metadataService = nullptr,
+                           QObject* parent = nullptr);
+
+    /**
+     * @brief 获取行数
+     */
+    int rowCount(const QModelIndex& parent = QModelIndex()) const override;
+
+    /**
+     * @brief 获取指定行的数据
+     */
+    QVariant data(const QModelIndex& index, int role = Qt::DisplayRole) const override;
+
+    /**
+     * @brief 设置过滤串，为空时显示全部文件
+     *
+     * @param text 过滤串
+     */
+    void setFilter(const QString& text);
+
+    /**
+     * @brief 获取当前过滤串
+     *
+     * @return QString 过滤串
+     */
+    QString filter() const;
+
+    /**
+     * @brief 将模型索引映射为播放列表索引
+     *
+     * @param index 模型索引
+     * @return int 播放列表索引，无效时为 -1
+     */
+    int sourceRow(const QModelIndex& index) const;
+
+private slots:
+    /**
+     * @brief 当前播放项变化时刷新新旧两行的高亮
+     */
+    void onCurrentIndexChanged();
+
+    /**
+     * @brief 播放列表即将重排：记录持久索引对应的条目
+     */
+    void onLayoutAboutToBeChanged();
+
+    /**
+     * @brief 播放列表已重排：按条目 ID 更新持久索引
+     */
+    void onLayoutChanged();
+
+private:
+    /**
+     * @brief 将模型行映射为播放列表索引
+     */
+    int sourceRow(int row) const;
+
+    /**
+     * @brief 将播放列表索引映射为模型行，不在过滤结果中时为 -1
+     */
+    int modelRow(int sourceRow) const;
+
+    /**
+     * @brief 开始一次结构变化（过滤期间转换为模型重置）
+     */
+    void beginStructureChange();
+
+    /**
+     * @brief 结束过滤期间的结构变化并重新过滤
+     */
+    void endStructureChange();
+
+private:
+    PlaylistManager* m_playlistManager;  ///< 播放列表管理器
+    MetadataService* m_metadataService;  ///< 元数据服务
+    PlaylistManager::ItemId m_currentItem; ///< 当前高亮的条目 ID
+    QString m_filter;                    ///< 过滤串
+    QList<int> m_filterRows;             ///< 过滤结果（升序的播放列表索引）
+    QModelIndexList m_layoutIndexes;     ///< 重排前的持久索引
+    QList<PlaylistManager::ItemId> m_layoutItems; ///< 持久索引对应的条目 ID
+};
+
+#endif // AURORAPLAYER_PLAYLISTMODEL_H
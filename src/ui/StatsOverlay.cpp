@@ -0,0 +1,148 @@
+/********************************************************************************
+ * @file   : StatsOverlay.cpp
+ * @brief  : 实现了 StatsOverlay 类。
+ *
+ * 该文件实现了悬浮在视频区域上方的播放统计面板。
+ *
+ * @author : polarours
+ * @date   : 2026/10/18
+ ********************************************************************************/
+
+#include "StatsOverlay.h"
+
+#include <QEvent>
+#include <QFontDatabase>
+
+extern "C" {
+#include <libavutil/pixdesc.h>
+}
+
+namespace {
+
+    /**
+     * @brief 计算两次快照之间的帧率
+     */
+    double rate(quint64 current, quint64 previous, qint64 elapsedMs)
+    {
+        if (elapsedMs <= 0 || current < previous) {
+            return 0.0;
+        }
+        return (current - previous) * 1000.0 / elapsedMs;
+    }
+
+    /**
+     * @brief 获取像素格式名称
+     */
+    QString pixelFormatName(int format)
+    {
+        const char* name = format >= 0 ? av_get_pix_fmt_name(static_cast<AVPixelFormat>(format)) : nullptr;
+        return name ? QString::fromLatin1(name) : QStringLiteral("-");
+    }
+
+} // namespace
+
+/**
+ * @brief 构造函数
+ *
+ * @param target 要覆盖的控件
+ * @param parent 父窗口
+ */
+StatsOverlay::StatsOverlay(QWidget* target, QWidget* parent)
+    : QLabel(parent, Qt::Tool | Qt::FramelessWindowHint | Qt::WindowDoesNotAcceptFocus)
+    , m_target(target)
+{
+    setAttribute(Qt::WA_ShowWithoutActivating);
+    setAttribute(Qt::WA_TransparentForMouseEvents);
+    setFont(QFontDatabase::systemFont(QFontDatabase::FixedFont));
+    setStyleSheet("QLabel { background-color: rgba(0, 0, 0, 180); color: #E0E0E0; padding: 6px; }");
+    setTextFormat(Qt::PlainText);
+    setWindowOpacity(0.85);
+
+    if (m_target) {
+        m_target->installEventFilter(this);
+        if (m_target->window()) {
+            m_target->window()->installEventFilter(this);
+        }
+    }
+}
+
+/**
+ * @brief 使用两次快照之间的差值刷新面板内容
+ */
+void StatsOverlay::updateStats(const PlaybackStats::Snapshot& current,
+                               const PlaybackStats::Snapshot& previous,
+                               qint64 elapsedMs)
+{
+    QString text;
+    text += tr("Decode fps:   %1\n").arg(current.framesDecoded > 0
+                                          ? QString::number(rate(current.framesDecoded, previous.framesDecoded, elapsedMs), 'f', 1)
+                                          : QStringLiteral("n/a"));
+    text += tr("Present fps:  %1\n").arg(rate(current.framesPresented, previous.framesPresented, elapsedMs), 0, 'f', 1);
+    text += tr("Dropped:      %1\n").arg(current.framesDropped);
+    text += tr("Late:         %1\n").arg(current.framesLate);
+    text += tr("Queues:       video %1 / audio %2 ms\n").arg(current.videoQueueDepth).arg(current.audioQueueDepth);
+    text += tr("A/V drift:    %1 ms\n").arg(current.avDriftMs);
+    text += tr("Decoder thr.: %1\n").arg(current.decoderThreads > 0 ? QString::number(current.decoderThreads)
+                                                                     : QStringLiteral("n/a"));
+    text += tr("Format:       %1 %2x%3\n").arg(pixelFormatName(current.pixelFormat))
+                                          .arg(current.videoWidth).arg(current.videoHeight);
+    text += tr("Bitrate:      %1 kbit/s").arg(current.bitrate / 1000);
+    setText(text);
+    adjustSize();
+}
+
+/**
+ * @brief 生成状态栏使用的单行摘要
+ */
+QString StatsOverlay::summary(const PlaybackStats::Snapshot& current,
+                              const PlaybackStats::Snapshot& previous,
+                              qint64 elapsedMs)
+{
+    if (current.framesPresented == 0 && current.bitrate == 0) {
+        return QString();
+    }
+    return tr("%1x%2 %3 | %4 fps | dropped %5 | late %6")
+        .arg(current.videoWidth)
+        .arg(current.videoHeight)
+        .arg(pixelFormatName(current.pixelFormat))
+        .arg(rate(current.framesPresented, previous.framesPresented, elapsedMs), 0, 'f', 1)
+        .arg(current.framesDropped)
+        .arg(current.framesLate);
+}
+
+/**
+ * @brief 跟踪目标控件及其窗口的移动和尺寸变化
+ */
+bool StatsOverlay::eventFilter(QObject* watched, QEvent* event)
+{
+    switch (event->type()) {
+        case QEvent::Move:
+        case QEvent::Resize:
+            if (isVisible()) {
+                reposition();
+            }
+            break;
+        default:
+            break;
+    }
+    return QLabel::eventFilter(watched, event);
+}
+
+/**
+ * @brief 显示时重新定位
+ */
+void StatsOverlay::showEvent(QShowEvent* event)
+{
+    QLabel::showEvent(event);
+    reposition();
+}
+
+/**
+ * @brief 将面板移动到目标控件左上角
+ */
+void StatsOverlay::reposition()
+{
+    if (m_target) {
+        move(m_target->mapToGlobal(QPoint(8, 8)));
+    }
+}
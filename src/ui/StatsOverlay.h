@@ -0,0 +1,84 @@
+/********************************************************************************
+ * @file   : StatsOverlay.h
+ * @brief  : 声明了 StatsOverlay 类。
+ *
+ * 该文件声明了悬浮在视频区域上方的播放统计面板。
+ *
+ * @author : polarours
+ * @date   : 2026/10/18
+ ********************************************************************************/
+
+#ifndef AURORAPLAYER_STATSOVERLAY_H
+#define AURORAPLAYER_STATSOVERLAY_H
+
+#include <QLabel>
+#include <QPointer>
+
+#include "../core/PlaybackStats.h"
+
+/**
+ * @class StatsOverlay
+ * @brief 播放统计悬浮面板
+ *
+ * QVideoWidget 内部是原生窗口，同级控件无法叠加在其上方，因此面板使用无边框
+ * 工具窗口，并跟随目标控件移动。面板本身不订阅任何逐帧信号，由主窗口按固定
+ * 低频率推送快照。
+ */
+class StatsOverlay : public QLabel
+{
+    Q_OBJECT
+
+public:
+    /**
+     * @brief 构造函数
+     *
+     * @param target 要覆盖的控件（通常是视频显示部件）
+     * @param parent 父窗口
+     */
+    explicit StatsOverlay(QWidget* target, QWidget* parent = nullptr);
+
+    /**
+     * @brief 使用两次快照之间的差值刷新面板内容
+     *
+     * @param current   当前快照
+     * @param previous  上一次快照
+     * @param elapsedMs 两次快照之间的时间（毫秒）
+     */
+    void updateStats(const PlaybackStats::Snapshot& current,
+                     const PlaybackStats::Snapshot& previous,
+                     qint64 elapsedMs);
+
+    /**
+     * @brief 生成状态栏使用的单行摘要
+     *
+     * @param current   当前快照
+     * @param previous  上一次快照
+     * @param elapsedMs 两次快照之间的时间（毫秒）
+     * @return QString 摘要文本
+     */
+    static QString summary(const PlaybackStats::Snapshot& current,
+                           const PlaybackStats::Snapshot& previous,
+                           qint64 elapsedMs);
+
+protected:
+    /**
+     * @brief 跟踪目标控件及其窗口的移动和尺寸变化
+     */
+    bool eventFilter(QObject* watched, QEvent* event) override;
+
+    /**
+     * @brief 显示时重新定位
+     */
+    void showEvent(QShowEvent* event) override;
+
+private:
+    /**
+     * @brief 将面板移动到目标控件左上角
+     */
+    void reposition();
+
+private:
+    QPointer<QWidget> m_target; ///< 被覆盖的控件
+};
+
+#endif // AURORAPLAYER_STATSOVERLAY_H
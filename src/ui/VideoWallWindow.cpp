@@ -0,0 +1,123 @@
+/********************************************************************************
+ * @file   : VideoWallWindow.cpp
+ * @brief  : 实现了 VideoWallWindow 类。
+ *
+ * @author : polarours
+ * @date   : 2026/10/18
+ ********************************************************************************/
+
+#include "VideoWallWindow.h"
+#include "../core/DecodeScheduler.h"
+#include "../player/VideoWall.h"
+
+#include <QFileInfo>
+#include <QGridLayout>
+#include <QHBoxLayout>
+#include <QLabel>
+#include <QPushButton>
+#include <QSlider>
+#include <QTimer>
+#include <QVBoxLayout>
+#include <QVideoWidget>
+
+#include <cmath>
+
+namespace {
+
+    constexpr int kRefreshIntervalMs = 500; ///< 进度条和状态的刷新间隔
+
+} // namespace
+
+/**
+ * @brief 构造函数
+ *
+ * @param files  媒体文件路径列表
+ * @param parent 父窗口
+ */
+VideoWallWindow::VideoWallWindow(const QStringList& files, QWidget* parent)
+    : QWidget(parent, Qt::Window)
+    , m_wall(new VideoWall(this))
+    , m_playButton(new QPushButton(tr("Play"), this))
+    , m_stopButton(new QPushButton(tr("Stop"), this))
+    , m_positionSlider(new QSlider(Qt::Horizontal, this))
+    , m_statusLabel(new QLabel(this))
+    , m_refreshTimer(new QTimer(this))
+{
+    setAttribute(Qt::WA_DeleteOnClose);
+    setWindowTitle(tr("Video Wall"));
+    resize(1280, 720);
+
+    m_wall->setSources(files);
+
+    // --- 画面网格：列数取 ceil(sqrt(n))，3×3、4×4 等排列 --- //
+    auto* grid = new QGridLayout;
+    grid->setSpacing(2);
+    const int count = m_wall->count();
+    const int columns = qMax(1, static_cast<int>(std::ceil(std::sqrt(static_cast<double>(count)))));
+    for (int i = 0; i < count; ++i) {
+        auto* video = new QVideoWidget(this);
+        video->setToolTip(QFileInfo(m_wall->sourceAt(i)).fileName());
+        grid->addWidget(video, i / columns, i % columns);
+        m_wall->setVideoOutput(i, video);
+    }
+
+    // --- 控制栏 --- //
+    m_positionSlider->setRange(0, 0);
+    auto* controls = new QHBoxLayout;
+    controls->addWidget(m_playButton);
+    controls->addWidget(m_stopButton);
+    controls->addWidget(m_positionSlider, 1);
+    controls->addWidget(m_statusLabel);
+
+    auto* layout = new QVBoxLayout(this);
+    layout->addLayout(grid, 1);
+    layout->addLayout(controls);
+
+    connect(m_playButton, &QPushButton::clicked, this, [this]() {
+                if (m_wall->state() == AuroraPlayer::State::PlayerState::Playing) {
+                    m_wall->pause();
+                } else {
+                    m_wall->play();
+                }
+            });
+    connect(m_stopButton, &QPushButton::clicked, m_wall, &VideoWall::stop);
+    connect(m_positionSlider, &QSlider::sliderReleased, this, [this]() {
+                m_wall->setPosition(m_positionSlider->value());
+            });
+    connect(m_wall, &VideoWall::stateChanged, this, [this](AuroraPlayer::State::PlayerState state) {
+                m_playButton->setText(state == AuroraPlayer::State::PlayerState::Playing ? tr("Pause") : tr("Play"));
+            });
+
+    m_refreshTimer->setInterval(kRefreshIntervalMs);
+    connect(m_refreshTimer, &QTimer::timeout, this, &VideoWallWindow::refresh);
+    m_refreshTimer->start();
+
+    m_wall->play();
+}
+
+/**
+ * @brief 析构函数
+ */
+VideoWallWindow::~VideoWallWindow() = default;
+
+/**
+ * @brief 刷新进度条和调度器状态
+ */
+void VideoWallWindow::refresh()
+{
+    qint64 longest = 0;
+    for (int i = 0; i < m_wall->count(); ++i) {
+        longest = qMax(longest, m_wall->durationAt(i));
+    }
+    m_positionSlider->setMaximum(static_cast<int>(longest));
+    if (!m_positionSlider->isSliderDown()) {
+        m_positionSlider->setValue(static_cast<int>(m_wall->position()));
+    }
+
+    const DecodeScheduler& scheduler = DecodeScheduler::instance();
+    m_statusLabel->setText(tr("%1 streams | decode %2/%3 busy, %4 waiting")
+                               .arg(m_wall->count())
+                               .arg(scheduler.active())
+                               .arg(scheduler.concurrency())
+                               .arg(scheduler.waiting()));
+}
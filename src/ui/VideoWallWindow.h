@@ -0,0 +1,58 @@
+/********************************************************************************
+ * @file   : VideoWallWindow.h
+ * @brief  : 声明了 VideoWallWindow 类。
+ *
+ * 该文件声明了视频墙窗口：按网格排列各路画面，提供播放/暂停、停止和进度条，
+ * 并显示共享解码调度器的占用情况。
+ *
+ * @author : polarours
+ * @date   : 2026/10/18
+ ********************************************************************************/
+
+#ifndef AURORAPLAYER_VIDEOWALLWINDOW_H
+#define AURORAPLAYER_VIDEOWALLWINDOW_H
+
+#include <QStringList>
+#include <QWidget>
+
+// --- 前向声明 --- //
+class QLabel;
+class QPushButton;
+class QSlider;
+class QTimer;
+class VideoWall;
+
+class VideoWallWindow : public QWidget
+{
+    Q_OBJECT
+
+public:
+    /**
+     * @brief 构造函数（关闭时自动删除）
+     *
+     * @param files  媒体文件路径列表（最多 VideoWall::kMaxTiles 路）
+     * @param parent 父窗口
+     */
+    explicit VideoWallWindow(const QStringList& files, QWidget* parent = nullptr);
+
+    /**
+     * @brief 析构函数
+     */
+    ~VideoWallWindow() override;
+
+private:
+    /**
+     * @brief 刷新进度条和调度器状态
+     */
+    void refresh();
+
+private:
+    VideoWall* m_wall;            ///< 视频墙
+    QPushButton* m_playButton;    ///< 播放/暂停按钮
+    QPushButton* m_stopButton;    ///< 停止按钮
+    QSlider* m_positionSlider;    ///< 进度条（按最长一路计算）
+    QLabel* m_statusLabel;        ///< 调度器状态
+    QTimer* m_refreshTimer;       ///< 刷新定时器
+};
+
+#endif // AURORAPLAYER_VIDEOWALLWINDOW_H
@@ -0,0 +1,224 @@
+/********************************************************************************
+ * @file   : ContentHash.cpp
+ * @brief  : 实现了文件内容哈希函数。
+ *
+ * @author : polarours
+ * @date   : 2026/10/18
+ ********************************************************************************/
+
+#include "ContentHash.h"
+
+#include <QByteArray>
+#include <QFile>
+
+#include <cstring>
+
+namespace {
+
+    constexpr quint64 kPrime1 = 11400714785074694791ull;
+    constexpr quint64 kPrime2 = 14029467366897019727ull;
+    constexpr quint64 kPrime3 = 1609587929392839161ull;
+    constexpr quint64 kPrime4 = 9650029242287828579ull;
+    constexpr quint64 kPrime5 = 2870177450012600261ull;
+
+    constexpr qint64 kSampleSize = 64 * 1024;     ///< 抽样块大小
+    constexpr qint64 kFullBlockSize = 1 << 20;    ///< 完整哈希的读取块大小
+
+    inline quint64 rotl(quint64 value, int bits)
+    {
+        return (value << bits) | (value >> (64 - bits));
+    }
+
+    /**
+     * @brief 按小端读取（哈希值与平台字节序无关）
+     */
+    inline quint64 read64(const uchar* p)
+    {
+        quint64 value = 0;
+        for (int i = 7; i >= 0; --i) {
+            value = (value << 8) | p[i];
+        }
+        return value;
+    }
+
+    inline quint32 read32(const uchar* p)
+    {
+        return quint32(p[0]) | (quint32(p[1]) << 8) | (quint32(p[2]) << 16) | (quint32(p[3]) << 24);
+    }
+
+    inline quint64 mixRound(quint64 acc, quint64 input)
+    {
+        acc += input * kPrime2;
+        acc = rotl(acc, 31);
+        return acc * kPrime1;
+    }
+
+    inline quint64 mergeRound(quint64 acc, quint64 value)
+    {
+        acc ^= mixRound(0, value);
+        return acc * kPrime1 + kPrime4;
+    }
+
+    /**
+     * @brief 读取 [offset, offset + length) 并累加到链式哈希
+     */
+    bool hashRange(QFile& file, qint64 offset, qint64 length, QByteArray& buffer, quint64* hash,
+                   std::atomic<qint64>* bytesRead)
+    {
+        if (!file.seek(offset)) {
+            return false;
+        }
+        buffer.resize(length);
+        const qint64 read = file.read(buffer.data(), length);
+        if (read != length) {
+            return false;
+        }
+        *hash = AuroraPlayer::Utils::xxHash64(buffer.constData(), static_cast<size_t>(read), *hash);
+        if (bytesRead) {
+            bytesRead->fetch_add(read, std::memory_order_relaxed);
+        }
+        return true;
+    }
+
+} // namespace
+
+namespace AuroraPlayer {
+    namespace Utils {
+
+        /**
+         * @brief 计算内存块的 xxHash64
+         *
+         * @param data   数据
+         * @param length 字节数
+         * @param seed   种子
+         * @return quint64 哈希值
+         */
+        quint64 xxHash64(const void* data, size_t length, quint64 seed)
+        {
+            const uchar* p = static_cast<const uchar*>(data);
+            const uchar* const end = p + length;
+            quint64 hash;
+
+            if (length >= 32) {
+                const uchar* const limit = end - 32;
+                quint64 v1 = seed + kPrime1 + kPrime2;
+                quint64 v2 = seed + kPrime2;
+                quint64 v3 = seed;
+                quint64 v4 = seed - kPrime1;
+                do {
+                    v1 = mixRound(v1, read64(p));
+                    v2 = mixRound(v2, read64(p + 8));
+                    v3 = mixRound(v3, read64(p + 16));
+                    v4 = mixRound(v4, read64(p + 24));
+                    p += 32;
+                } while (p <= limit);
+
+                hash = rotl(v1, 1) + rotl(v2, 7) + rotl(v3, 12) + rotl(v4, 18);
+                hash = mergeRound(hash, v1);
+                hash = mergeRound(hash, v2);
+                hash = mergeRound(hash, v3);
+                hash = mergeRound(hash, v4);
+            } else {
+                hash = seed + kPrime5;
+            }
+
+            hash += static_cast<quint64>(length);
+
+            while (p + 8 <= end) {
+                hash ^= mixRound(0, read64(p));
+                hash = rotl(hash, 27) * kPrime1 + kPrime4;
+                p += 8;
+            }
+            if (p + 4 <= end) {
+                hash ^= quint64(read32(p)) * kPrime1;
+                hash = rotl(hash, 23) * kPrime2 + kPrime3;
+                p += 4;
+            }
+            while (p < end) {
+                hash ^= quint64(*p) * kPrime5;
+                hash = rotl(hash, 11) * kPrime1;
+                ++p;
+            }
+
+            hash ^= hash >> 33;
+            hash *= kPrime2;
+            hash ^= hash >> 29;
+            hash *= kPrime3;
+            hash ^= hash >> 32;
+            return hash;
+        }
+
+        /**
+         * @brief 计算文件的抽样哈希
+         *
+         * @param filePath  文件路径
+         * @param fileSize  文件大小
+         * @param hash      输出哈希值
+         * @param complete  输出是否覆盖了全部内容
+         * @param bytesRead 累加读取的字节数
+         * @return bool 是否读取成功
+         */
+        bool sampledFileHash(const QString& filePath, qint64 fileSize, quint64* hash,
+                             bool* complete, std::atomic<qint64>* bytesRead)
+        {
+            QFile file(filePath);
+            if (!file.open(QIODevice::ReadOnly)) {
+                return false;
+            }
+
+            QByteArray buffer;
+            quint64 value = static_cast<quint64>(fileSize);
+            const bool whole = fileSize <= 3 * kSampleSize;
+            bool ok;
+            if (whole) {
+                ok = hashRange(file, 0, fileSize, buffer, &value, bytesRead);
+            } else {
+                ok = hashRange(file, 0, kSampleSize, buffer, &value, bytesRead)
+                     && hashRange(file, (fileSize - kSampleSize) / 2, kSampleSize, buffer, &value, bytesRead)
+                     && hashRange(file, fileSize - kSampleSize, kSampleSize, buffer, &value, bytesRead);
+            }
+
+            if (ok) {
+                *hash = value;
+                if (complete) {
+                    *complete = whole;
+                }
+            }
+            return ok;
+        }
+
+        /**
+         * @brief 计算文件完整内容的哈希
+         *
+         * @param filePath  文件路径
+         * @param hash      输出哈希值
+         * @param cancelled 取消标志
+         * @param bytesRead 累加读取的字节数
+         * @return bool 是否读取成功
+         */
+        bool fullFileHash(const QString& filePath, quint64* hash,
+                          const std::atomic<bool>* cancelled, std::atomic<qint64>* bytesRead)
+        {
+            QFile file(filePath);
+            if (!file.open(QIODevice::ReadOnly)) {
+                return false;
+            }
+
+            const qint64 fileSize = file.size();
+            QByteArray buffer;
+            quint64 value = static_cast<quint64>(fileSize);
+            for (qint64 offset = 0; offset < fileSize; offset += kFullBlockSize) {
+                if (cancelled && cancelled->load(std::memory_order_relaxed)) {
+                    return false;
+                }
+                if (!hashRange(file, offset, qMin(kFullBlockSize, fileSize - offset), buffer, &value, bytesRead)) {
+                    return false;
+                }
+            }
+
+            *hash = value;
+            return true;
+        }
+
+    } // namespace Utils
+} // namespace AuroraPlayer
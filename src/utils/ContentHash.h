@@ -0,0 +1,63 @@
+/********************************************************************************
+ * @file   : ContentHash.h
+ * @brief  : 声明了文件内容哈希函数。
+ *
+ * 该文件声明了非加密的 64 位内容哈希（xxHash64 算法）以及基于它的
+ * 文件抽样哈希和完整哈希，用于查找内容重复的文件。
+ *
+ * @author : polarours
+ * @date   : 2026/10/18
+ ********************************************************************************/
+
+#ifndef AURORAPLAYER_CONTENTHASH_H
+#define AURORAPLAYER_CONTENTHASH_H
+
+#include <QString>
+
+#include <atomic>
+#include <cstddef>
+
+namespace AuroraPlayer {
+    namespace Utils {
+
+        /**
+         * @brief 计算内存块的 xxHash64
+         *
+         * @param data   数据
+         * @param length 字节数
+         * @param seed   种子
+         * @return quint64 哈希值
+         */
+        quint64 xxHash64(const void* data, size_t length, quint64 seed = 0);
+
+        /**
+         * @brief 计算文件的抽样哈希：开头、中间、结尾各一块，种子为文件大小
+         *
+         * 文件不大于三块时等同于完整内容的哈希（*complete 置为 true）。
+         *
+         * @param filePath  文件路径
+         * @param fileSize  文件大小
+         * @param hash      输出哈希值
+         * @param complete  输出是否覆盖了全部内容，可为空
+         * @param bytesRead 累加读取的字节数，可为空
+         * @return bool 是否读取成功
+         */
+        bool sampledFileHash(const QString& filePath, qint64 fileSize, quint64* hash,
+                             bool* complete = nullptr, std::atomic<qint64>* bytesRead = nullptr);
+
+        /**
+         * @brief 计算文件完整内容的哈希（逐块链式计算，种子为文件大小）
+         *
+         * @param filePath  文件路径
+         * @param hash      输出哈希值
+         * @param cancelled 取消标志，可为空
+         * @param bytesRead 累加读取的字节数，可为空
+         * @return bool 是否读取成功（取消时返回 false）
+         */
+        bool fullFileHash(const QString& filePath, quint64* hash,
+                          const std::atomic<bool>* cancelled = nullptr, std::atomic<qint64>* bytesRead = nullptr);
+
+    } // namespace Utils
+} // namespace AuroraPlayer
+
+#endif // AURORAPLAYER_CONTENTHASH_H
@@ -0,0 +1,194 @@
+/********************************************************************************
+ * @file   : MediaSniffer.cpp
+ * @brief  : 实现了媒体文件类型嗅探函数。
+ *
+ * @author : polarours
+ * @date   : 2026/10/18
+ ********************************************************************************/
+
+#include "MediaSniffer.h"
+
+#include <QFile>
+
+#include <cstring>
+
+extern "C" {
+#include <libavformat/avformat.h>
+}
+
+namespace {
+
+    constexpr qint64 kProbeSize = 2048; ///< 读取的文件头字节数
+
+    bool startsWith(const QByteArray& data, int offset, const char* magic)
+    {
+        const int length = static_cast<int>(std::strlen(magic));
+        return data.size() >= offset + length && std::memcmp(data.constData() + offset, magic, length) == 0;
+    }
+
+    unsigned char byteAt(const QByteArray& data, int offset)
+    {
+        return static_cast<unsigned char>(data.at(offset));
+    }
+
+    /**
+     * @brief 判断文件头是否为合法的 MPEG 音频帧头或 ADTS 头
+     *
+     * 只看同步字会把 UTF-16LE 的 BOM（FF FE）误判为音频，因此还要检查
+     * 版本、层、码率和采样率字段不是保留值。
+     */
+    bool isAudioFrameSync(const QByteArray& data)
+    {
+        const unsigned char b1 = byteAt(data, 1);
+        const unsigned char b2 = byteAt(data, 2);
+        if (byteAt(data, 0) != 0xFF || (b1 & 0xE0) != 0xE0 || b1 == 0xFE) {
+            return false;
+        }
+
+        const int layer = (b1 >> 1) & 0x03;
+        if (layer == 0) {
+            // ADTS：12 位同步字，采样率索引 0~12 有效
+            return (b1 & 0xF0) == 0xF0 && ((b2 >> 2) & 0x0F) <= 12;
+        }
+
+        const int version = (b1 >> 3) & 0x03;
+        const int bitrateIndex = (b2 >> 4) & 0x0F;
+        const int sampleRateIndex = (b2 >> 2) & 0x03;
+        return version != 1 && bitrateIndex != 0x0F && sampleRateIndex != 0x03;
+    }
+
+    /**
+     * @brief 常见容器的魔数判断
+     */
+    AuroraPlayer::Utils::MediaKind sniffMagic(const QByteArray& data)
+    {
+        using AuroraPlayer::Utils::MediaKind;
+
+        if (data.size() < 12) {
+            return MediaKind::Unknown;
+        }
+
+        // --- 音频 --- //
+        if (startsWith(data, 0, "ID3") || startsWith(data, 0, "fLaC") || startsWith(data, 0, "OggS")
+            || startsWith(data, 0, "MAC ") || startsWith(data, 0, "wvpk") || startsWith(data, 0, "#!AMR")
+            || startsWith(data, 0, "caff")) {
+            return MediaKind::Audio;
+        }
+        if (startsWith(data, 0, "RIFF") && (startsWith(data, 8, "WAVE") || startsWith(data, 8, "RF64"))) {
+            return MediaKind::Audio;
+        }
+        if (startsWith(data, 0, "RF64") || startsWith(data, 0, "riff")) {
+            return MediaKind::Audio;
+        }
+        if (startsWith(data, 0, "FORM") && (startsWith(data, 8, "AIFF") || startsWith(data, 8, "AIFC"))) {
+            return MediaKind::Audio;
+        }
+        // MPEG 音频帧同步字 / ADTS AAC
+        if (isAudioFrameSync(data)) {
+            return MediaKind::Audio;
+        }
+
+        // --- 视频 --- //
+        if (startsWith(data, 4, "ftyp")) {
+            return startsWith(data, 8, "M4A ") || startsWith(data, 8, "M4B ") ? MediaKind::Audio : MediaKind::Video;
+        }
+        if (startsWith(data, 4, "moov") || startsWith(data, 4, "mdat") || startsWith(data, 4, "wide")) {
+            return MediaKind::Video;
+        }
+        if (byteAt(data, 0) == 0x1A && byteAt(data, 1) == 0x45 && byteAt(data, 2) == 0xDF && byteAt(data, 3) == 0xA3) {
+            return MediaKind::Video; // Matroska / WebM
+        }
+        if (startsWith(data, 0, "RIFF") && startsWith(data, 8, "AVI ")) {
+            return MediaKind::Video;
+        }
+        if (startsWith(data, 0, "FLV")) {
+            return MediaKind::Video;
+        }
+        static const char kAsfGuid[] = "\x30\x26\xB2\x75\x8E\x66\xCF\x11";
+        if (data.size() >= 8 && std::memcmp(data.constData(), kAsfGuid, 8) == 0) {
+            return MediaKind::Video; // ASF (wmv/wma)
+        }
+        if (byteAt(data, 0) == 0x00 && byteAt(data, 1) == 0x00 && byteAt(data, 2) == 0x01
+            && (byteAt(data, 3) == 0xBA || byteAt(data, 3) == 0xB3)) {
+            return MediaKind::Video; // MPEG-PS / MPEG-1/2 ES
+        }
+        if (byteAt(data, 0) == 0x47 && data.size() > 188 && byteAt(data, 188) == 0x47) {
+            return MediaKind::Video; // MPEG-TS
+        }
+
+        return MediaKind::Unknown;
+    }
+
+    /**
+     * @brief 使用 FFmpeg 探测（魔数无法识别时的回退）
+     */
+    AuroraPlayer::Utils::MediaKind sniffWithFFmpeg(const QByteArray& data, const QString& filePath)
+    {
+        using AuroraPlayer::Utils::MediaKind;
+
+        // av_probe_input_format 要求缓冲区末尾有零填充
+        QByteArray buffer = data;
+        buffer.append(QByteArray(AVPROBE_PADDING_SIZE, '\0'));
+        const QByteArray fileName = filePath.toUtf8();
+
+        AVProbeData probeData;
+        std::memset(&probeData, 0, sizeof(probeData));
+        probeData.filename = fileName.constData();
+        probeData.buf = reinterpret_cast<unsigned char*>(buffer.data());
+        probeData.buf_size = static_cast<int>(data.size());
+
+        int score = AVPROBE_SCORE_RETRY;
+        const AVInputFormat* format = av_probe_input_format2(&probeData, 1, &score);
+        // 只凭扩展名命中（内容探测没有给出更高分数）的不算媒体文件
+        if (!format || score <= AVPROBE_SCORE_EXTENSION) {
+            return MediaKind::Unknown;
+        }
+
+        // 排除图片（*_pipe）、字幕（含 VobSub .idx、PGS .sup）、纯文本等非播放类格式（按名称子串匹配）
+        const QByteArray name(format->name);
+        static const char* const kRejected[] = {
+            "pipe", "image2", "tty", "srt", "ass", "webvtt", "subviewer", "microdvd", "jacosub",
+            "mpl2", "pjs", "realtext", "sami", "stl", "vplayer", "lrc", "ffmetadata", "gif", "apng",
+            "vobsub", "sup", "scc", "mcc", "aqtitle", "dvbsub", "dvbtxt"
+        };
+        for (const char* rejected : kRejected) {
+            if (name.contains(rejected)) {
+                return MediaKind::Unknown;
+            }
+        }
+
+        static const char* const kAudioFormats[] = {
+            "mp3", "wav", "flac", "aac", "ac3", "eac3", "dts", "aiff", "ape", "wv", "tta", "amr",
+            "mpc", "caf", "w64", "truehd", "mlp", "ogg", "opus"
+        };
+        for (const char* audio : kAudioFormats) {
+            if (name == audio) {
+                return MediaKind::Audio;
+            }
+        }
+        return MediaKind::Video;
+    }
+
+} // namespace
+
+namespace AuroraPlayer {
+    namespace Utils {
+
+        MediaKind sniffMediaFile(const QString& filePath) {
+            QFile file(filePath);
+            if (!file.open(QIODevice::ReadOnly | QIODevice::Unbuffered)) {
+                return MediaKind::Unknown;
+            }
+            return sniffMediaHeader(file.read(kProbeSize), filePath);
+        }
+
+        MediaKind sniffMediaHeader(const QByteArray& header, const QString& filePath) {
+            const MediaKind kind = sniffMagic(header);
+            if (kind != MediaKind::Unknown || header.isEmpty()) {
+                return kind;
+            }
+            return sniffWithFFmpeg(header, filePath);
+        }
+
+    } // namespace Utils
+}// namespace AuroraPlayer
@@ -0,0 +1,51 @@
+/********************************************************************************
+ * @file   : MediaSniffer.h
+ * @brief  : 声明了媒体文件类型嗅探函数。
+ *
+ * 该文件声明了根据文件开头字节（魔数）判断媒体类型的函数，魔数无法识别时
+ * 回退到 FFmpeg 的 av_probe_input_format。
+ *
+ * @author : polarours
+ * @date   : 2026/10/18
+ ********************************************************************************/
+
+#ifndef AURORAPLAYER_MEDIASNIFFER_H
+#define AURORAPLAYER_MEDIASNIFFER_H
+
+#include <QString>
+
+namespace AuroraPlayer {
+    namespace Utils {
+
+        /**
+         * @brief 嗅探得到的媒体类型
+         */
+        enum class MediaKind {
+            Unknown, ///< 非媒体文件或无法识别
+            Audio,   ///< 音频容器
+            Video    ///< 视频容器（或可能包含视频的容器）
+        };
+
+        /**
+         * @brief 根据文件内容嗅探媒体类型
+         *
+         * 只读取文件开头的少量字节，可在任意线程调用。
+         *
+         * @param filePath 文件路径
+         * @return MediaKind 媒体类型
+         */
+        MediaKind sniffMediaFile(const QString& filePath);
+
+        /**
+         * @brief 根据已读取的文件开头字节嗅探媒体类型
+         *
+         * @param header   文件开头字节
+         * @param filePath 文件路径（仅供 FFmpeg 探测参考扩展名）
+         * @return MediaKind 媒体类型
+         */
+        MediaKind sniffMediaHeader(const QByteArray& header, const QString& filePath);
+
+    } // namespace Utils
+}// namespace AuroraPlayer
+
+#endif // AURORAPLAYER_MEDIASNIFFER_H
@@ -0,0 +1,124 @@
+/********************************************************************************
+ * @file   : ParallelSort.h
+ * @brief  : 声明并实现了并行稳定排序和分块并行循环。
+ *
+ * 该文件实现了分块并行排序再两两并行归并的稳定排序，以及排序前提取排序键
+ * 使用的分块并行循环，用于处理大数组。各块作为交互优先级任务在共享的
+ * TaskScheduler 上执行，调用线程同时参与，不另建线程池。
+ *
+ * @author : polarours
+ * @date   : 2026/10/18
+ ********************************************************************************/
+
+#ifndef AURORAPLAYER_PARALLELSORT_H
+#define AURORAPLAYER_PARALLELSORT_H
+
+#include <QThread>
+
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
+#include "../core/TaskScheduler.h"
+
+namespace AuroraPlayer {
+    namespace Utils {
+
+        /**
+         * @brief 分块并行循环
+         *
+         * 将 [0, count) 切成与线程数相同的连续区间，在任务调度器上对每个区间
+         * 调用 body(begin, end)，返回时全部区间已处理完毕。
+         *
+         * @param count      元素数
+         * @param body       区间处理函数，须可在多个线程同时调用
+         * @param maxThreads 最多使用的线程数
+         */
+        template <typename Body>
+        void parallelFor(size_t count, Body body, int maxThreads = QThread::idealThreadCount())
+        {
+            constexpr size_t kMinChunk = 1 << 14; ///< 值得单独开一个任务的最少元素数
+
+            const int chunks = static_cast<int>(qBound<size_t>(1, count / kMinChunk, static_cast<size_t>(qMax(1, maxThreads))));
+            if (chunks <= 1) {
+                body(size_t(0), count);
+                return;
+            }
+
+            TaskScheduler::instance().runParallel(TaskScheduler::Priority::Interactive, chunks, [&body, count, chunks](int i) {
+                const size_t begin = count * static_cast<size_t>(i) / static_cast<size_t>(chunks);
+                const size_t end = count * static_cast<size_t>(i + 1) / static_cast<size_t>(chunks);
+                body(begin, end);
+            });
+        }
+
+        /**
+         * @brief 并行稳定排序
+         *
+         * 数组被切成与线程数相同的块，各块在任务调度器上 std::stable_sort，
+         * 然后逐轮两两归并（同一轮的归并互不相交，并行执行），每轮在数组和
+         * 同样大小的缓冲区之间来回移动元素。元素较少时退化为单线程排序。
+         *
+         * @param items      待排序数组
+         * @param compare    严格弱序比较函数，须可在多个线程同时调用
+         * @param maxThreads 最多使用的线程数
+         */
+        template <typename T, typename Compare>
+        void parallelStableSort(std::vector<T>& items, Compare compare, int maxThreads = QThread::idealThreadCount())
+        {
+            constexpr size_t kMinChunk = 1 << 15; ///< 值得单独开一个任务的最少元素数
+
+            const size_t count = items.size();
+            const int chunks = static_cast<int>(qBound<size_t>(1, count / kMinChunk, static_cast<size_t>(qMax(1, maxThreads))));
+            if (chunks <= 1) {
+                std::stable_sort(items.begin(), items.end(), compare);
+                return;
+            }
+
+            std::vector<size_t> bounds(static_cast<size_t>(chunks) + 1);
+            for (int i = 0; i <= chunks; ++i) {
+                bounds[static_cast<size_t>(i)] = count * static_cast<size_t>(i) / static_cast<size_t>(chunks);
+            }
+
+            TaskScheduler& scheduler = TaskScheduler::instance();
+            scheduler.runParallel(TaskScheduler::Priority::Interactive, chunks, [&items, &compare, &bounds](int i) {
+                std::stable_sort(items.begin() + bounds[i], items.begin() + bounds[i + 1], compare);
+            });
+
+            std::vector<T> buffer(count);
+            std::vector<T>* source = &items;
+            std::vector<T>* target = &buffer;
+            while (bounds.size() > 2) {
+                const size_t segments = bounds.size() - 1;
+                const int pairs = static_cast<int>((segments + 1) / 2);
+                scheduler.runParallel(TaskScheduler::Priority::Interactive, pairs,
+                                      [source, target, &compare, &bounds, segments](int pair) {
+                    const size_t s = static_cast<size_t>(pair) * 2;
+                    const size_t low = bounds[s];
+                    const size_t middle = bounds[s + 1];
+                    const size_t high = s + 1 < segments ? bounds[s + 2] : middle;
+                    auto from = source->begin();
+                    std::merge(std::make_move_iterator(from + low), std::make_move_iterator(from + middle),
+                               std::make_move_iterator(from + middle), std::make_move_iterator(from + high),
+                               target->begin() + low, compare);
+                });
+
+                std::vector<size_t> merged;
+                for (size_t s = 0; s < segments; s += 2) {
+                    merged.push_back(bounds[s]);
+                }
+                merged.push_back(count);
+
+                std::swap(source, target);
+                bounds.swap(merged);
+            }
+
+            if (source != &items) {
+                items.swap(buffer);
+            }
+        }
+
+    } // namespace Utils
+} // namespace AuroraPlayer
+
+#endif // AURORAPLAYER_PARALLELSORT_H
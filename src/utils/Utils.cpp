@@ -9,6 +9,9 @@
  ********************************************************************************/
 
 #include "Utils.h"
+#include "CommonUtils.h"
+
+#include <mutex>
 
 extern "C" {
 #include <libavutil/error.h>
@@ -30,16 +33,39 @@ namespace AuroraPlayer {
         {
             // 设置日志级别
             av_log_set_level(AV_LOG_INFO);
-            
-            // 注册所有可用的编解码器、解复用器等
-            avformat_network_init();
-            
+
+            // 网络模块推迟到打开网络流时再初始化（见 ensureNetworkInitialized）
+
 #if LIBAVFORMAT_VERSION_INT < AV_VERSION_INT(58, 9, 100)
             // 旧版本需要显式注册
             av_register_all();
 #endif
         }
 
+        void ensureNetworkInitialized()
+        {
+            static std::once_flag once;
+            std::call_once(once, []() {
+                avformat_network_init();
+            });
+        }
+
+        bool isNetworkUrl(const QString& path)
+        {
+            // 本地路径没有 "协议://" 前缀；Windows 盘符（C:\）只有一个字母
+            const qsizetype scheme = path.indexOf(QLatin1String("://"));
+            return scheme > 1;
+        }
+
+        QString getFileNameFromPath(const QString& filePath) {
+            return filePath.mid(fileNameOffset(filePath));
+        }
+
+        qsizetype fileNameOffset(QStringView filePath) {
+            // 纯字符串处理，不访问文件系统
+            return qMax(filePath.lastIndexOf(QLatin1Char('/')), filePath.lastIndexOf(QLatin1Char('\\'))) + 1;
+        }
+
         QString formatTime(qint64 timeInMs) {
             qint64 seconds = timeInMs / 1000;
             qint64 minutes = seconds / 60;
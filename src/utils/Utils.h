@@ -20,6 +20,21 @@ namespace AuroraPlayer {
          */
         void initializeFFmpeg();
 
+        /**
+         * @brief 按需初始化 FFmpeg 网络模块（线程安全，只执行一次）
+         *
+         * 网络初始化会加载 TLS 库，只在真正打开网络流时才调用，不占用启动时间。
+         */
+        void ensureNetworkInitialized();
+
+        /**
+         * @brief 判断路径是否为网络地址（如 http://、rtsp://）
+         *
+         * @param path 媒体路径
+         * @return bool 是否为网络地址
+         */
+        bool isNetworkUrl(const QString& path);
+
         /**
          * @brief 获取 FFmpeg 错误信息
          *